@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+
+#include "arena.h"
+
+// One malloc'd block; small allocations are carved off the front of data, a large one fills it
+struct ArenaBlock {
+    ArenaBlock *next;
+    ArenaBlock *prev;       // Large blocks only, so a block that moves can be relinked
+    size_t size;
+    size_t used;
+    _Alignas(ARENA_ALIGN) unsigned char data[];
+};
+
+// Function to round a size up to the allocation boundary
+static size_t alignArena(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+// Function to count a change in the memory held, keeping the peak; the lock must be held
+static void countReserved(Arena *arena, size_t added, size_t removed) {
+    arena->reserved = arena->reserved + added - removed;
+    if (arena->reserved > arena->peak) {
+        arena->peak = arena->reserved;
+    }
+}
+
+// Function to create an empty arena; the first block is only taken when something is allocated
+Arena *createArena(void) {
+    Arena *arena = calloc(1, sizeof(Arena));
+    if (!arena) {
+        printf("Error: Out of memory while starting a job.\n");
+        return NULL;
+    }
+    arena->nextBlockSize = ARENA_FIRST_BLOCK;
+    pthread_mutex_init(&arena->lock, NULL);
+    return arena;
+}
+
+// Function to free a list of blocks
+static void freeBlocks(ArenaBlock *block) {
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+// Function to release an arena and everything allocated from it
+void destroyArena(Arena *arena) {
+    if (!arena) {
+        return;
+    }
+    // Small blocks double in size and large allocations are few, so this is a handful of frees whatever the job
+    freeBlocks(arena->blocks);
+    freeBlocks(arena->large);
+    pthread_mutex_destroy(&arena->lock);
+    free(arena);
+}
+
+// Function to give a large allocation a block of its own; the lock must be held
+static void *allocLarge(Arena *arena, size_t size) {
+    ArenaBlock *block = malloc(sizeof(ArenaBlock) + size);
+    if (!block) {
+        return NULL;
+    }
+    block->next = arena->large;
+    block->prev = NULL;
+    block->size = size;
+    block->used = size;
+    if (arena->large) {
+        arena->large->prev = block;
+    }
+    arena->large = block;
+    countReserved(arena, size, 0);
+    return block->data;
+}
+
+// Function to carve a small allocation off the newest block, adding a block if it is full; the lock must be held
+static void *allocLocked(Arena *arena, size_t size) {
+    size = alignArena(size ? size : 1);
+    if (size >= ARENA_LARGE) {
+        return allocLarge(arena, size);
+    }
+
+    ArenaBlock *block = arena->blocks;
+    if (!block || block->size - block->used < size) {
+        ArenaBlock *fresh = malloc(sizeof(ArenaBlock) + arena->nextBlockSize);
+        if (!fresh) {
+            return NULL;
+        }
+        fresh->next = block;
+        fresh->prev = NULL;
+        fresh->size = arena->nextBlockSize;
+        fresh->used = 0;
+        arena->blocks = fresh;
+        countReserved(arena, fresh->size, 0);
+        if (arena->nextBlockSize < ARENA_MAX_BLOCK) {
+            arena->nextBlockSize *= 2;
+        }
+        block = fresh;
+    }
+    void *memory = block->data + block->used;
+    block->used += size;
+    arena->last = memory;
+    return memory;
+}
+
+// Function to allocate from the arena
+void *arenaAlloc(Arena *arena, size_t size) {
+    pthread_mutex_lock(&arena->lock);
+    void *memory = allocLocked(arena, size);
+    pthread_mutex_unlock(&arena->lock);
+    return memory;
+}
+
+// Function to grow a large allocation with realloc, which can often extend it without copying; the lock must be held
+static void *resizeLarge(Arena *arena, void *old, size_t size) {
+    ArenaBlock *block = (ArenaBlock *)((unsigned char *)old - offsetof(ArenaBlock, data));
+    size_t oldBlockSize = block->size;
+    ArenaBlock *moved = realloc(block, sizeof(ArenaBlock) + size);
+    if (!moved) {
+        return NULL;
+    }
+    moved->size = size;
+    moved->used = size;
+    if (moved->prev) {
+        moved->prev->next = moved;
+    } else {
+        arena->large = moved;
+    }
+    if (moved->next) {
+        moved->next->prev = moved;
+    }
+    countReserved(arena, size, oldBlockSize);
+    return moved->data;
+}
+
+// Function to grow (or shrink) an allocation; large ones are reallocated, the newest small one grows in place while its block has room
+void *arenaResize(Arena *arena, void *old, size_t oldSize, size_t newSize) {
+    if (!old) {
+        return arenaAlloc(arena, newSize);
+    }
+
+    size_t size = alignArena(newSize ? newSize : 1);
+    pthread_mutex_lock(&arena->lock);
+    if (alignArena(oldSize ? oldSize : 1) >= ARENA_LARGE && size >= ARENA_LARGE) {
+        void *memory = resizeLarge(arena, old, size);
+        pthread_mutex_unlock(&arena->lock);
+        return memory;
+    }
+    ArenaBlock *block = arena->blocks;
+    if (old == arena->last && block && size < ARENA_LARGE) {
+        size_t start = (size_t)((unsigned char *)old - block->data);
+        if (start + size <= block->size) {
+            block->used = start + size;
+            pthread_mutex_unlock(&arena->lock);
+            return old;
+        }
+    }
+    void *memory = allocLocked(arena, newSize);
+    pthread_mutex_unlock(&arena->lock);
+
+    // A small allocation that moves leaves its old space behind until the job ends
+    if (memory) {
+        memcpy(memory, old, oldSize < newSize ? oldSize : newSize);
+    }
+    return memory;
+}
+
+// Function to note the current end of the arena
+ArenaMark arenaMark(Arena *arena) {
+    pthread_mutex_lock(&arena->lock);
+    ArenaMark mark = {arena->blocks, arena->blocks ? arena->blocks->used : 0, arena->large};
+    pthread_mutex_unlock(&arena->lock);
+    return mark;
+}
+
+// Function to give back everything allocated since a mark, including any blocks added after it
+void arenaRewind(Arena *arena, ArenaMark mark) {
+    pthread_mutex_lock(&arena->lock);
+    while (arena->blocks && arena->blocks != mark.block) {
+        ArenaBlock *block = arena->blocks;
+        arena->blocks = block->next;
+        countReserved(arena, 0, block->size);
+        free(block);
+    }
+    if (arena->blocks) {
+        arena->blocks->used = mark.used;
+    }
+    while (arena->large && arena->large != mark.large) {
+        ArenaBlock *block = arena->large;
+        arena->large = block->next;
+        countReserved(arena, 0, block->size);
+        free(block);
+    }
+    if (arena->large) {
+        arena->large->prev = NULL;
+    }
+    arena->last = NULL;
+    pthread_mutex_unlock(&arena->lock);
+}
+
+// Function to report the most memory the arena has held
+size_t arenaPeakBytes(const Arena *arena) {
+    return arena ? arena->peak : 0;
+}
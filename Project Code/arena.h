@@ -0,0 +1,43 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <pthread.h>
+
+
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+
+#define ARENA_FIRST_BLOCK (64 * 1024)       // Size of a job's first block; each further block doubles
+#define ARENA_MAX_BLOCK (4 * 1024 * 1024)   // ... up to this
+#define ARENA_LARGE (256 * 1024)            // Allocations this big get a block of their own, which can grow in place
+#define ARENA_ALIGN 16                      // Every allocation starts on this boundary
+
+typedef struct ArenaBlock ArenaBlock;
+
+// Bump allocator owning everything one job builds, released in one go when the job ends
+typedef struct {
+    ArenaBlock *blocks;         // Newest block first; small allocations come from its free end
+    ArenaBlock *large;          // One block per large allocation, newest first
+    void *last;                 // Most recent small allocation, which can grow in place
+    size_t nextBlockSize;
+    size_t reserved;            // Bytes held in blocks
+    size_t peak;                // Most bytes held at once
+    pthread_mutex_t lock;       // The encoding threads share the job's arena
+} Arena;
+
+// Point in an arena to rewind to, for scratch space that is done with before the job is
+typedef struct {
+    ArenaBlock *block;
+    size_t used;
+    ArenaBlock *large;
+} ArenaMark;
+
+Arena *createArena(void);                       // NULL if memory ran out
+void destroyArena(Arena *arena);                // Frees every allocation at once; NULL is ignored
+void *arenaAlloc(Arena *arena, size_t size);    // NULL if memory ran out
+void *arenaResize(Arena *arena, void *old, size_t oldSize, size_t newSize);  // Like realloc, oldSize must be what was asked for; NULL if memory ran out
+ArenaMark arenaMark(Arena *arena);
+void arenaRewind(Arena *arena, ArenaMark mark); // Frees everything allocated since the mark
+size_t arenaPeakBytes(const Arena *arena);      // Most memory the arena has held, 0 for NULL
+
+#endif // ARENA_H_INCLUDED
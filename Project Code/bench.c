@@ -0,0 +1,528 @@
+#if defined(__linux__)
+#define _GNU_SOURCE                 // posix_openpt(), ptsname() and cfmakeraw()
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+
+#include "font.h"
+#include "gcode.h"
+#include "stats.h"
+#include "bench.h"
+#include "jobqueue.h"
+
+#define MAX_BASELINE 64
+#define BENCH_MIN_MICROS 200000     // Each repetition runs the body for at least this long
+#define QUEUE_THREADS 4             // Producers, and as many consumers, in the job queue benchmarks
+#define QUEUE_ITEMS 100000          // Jobs passed through the queue per call
+
+// Body of a benchmark, called repeatedly with its context
+typedef void (*BenchBody)(void *context);
+
+// One benchmark result read back from a baseline file
+typedef struct {
+    char name[64];
+    double nsPerOp;
+} BaselineEntry;
+
+static BaselineEntry baseline[MAX_BASELINE];
+static int numBaseline = 0;
+static int regressions = 0;
+static FILE *resultsFile = NULL;
+
+// Function to load a previous results file to compare against
+static void loadBaseline(const char *filename) {
+    FILE *file = fopen(filename, "r");
+    char line[512];
+    if (!file) {
+        printf("Warning: No baseline at %s, nothing to compare against.\n", filename);
+        return;
+    }
+    while (numBaseline < MAX_BASELINE && fgets(line, sizeof(line), file)) {
+        BaselineEntry *entry = &baseline[numBaseline];
+        if (sscanf(line, "{\"name\":\"%63[^\"]\",\"ns_per_op\":%lf", entry->name, &entry->nsPerOp) == 2) {
+            numBaseline++;
+        }
+    }
+    fclose(file);
+}
+
+// Function to sort timings, fastest first
+static int compareTimes(const void *a, const void *b) {
+    long long left = *(const long long *)a, right = *(const long long *)b;
+    return (left > right) - (left < right);
+}
+
+// Function to report one benchmark: best time per operation and, for text, input throughput
+static void recordResult(const char *name, long long *micros, int repetitions, long ops, double inputBytes) {
+    qsort(micros, (size_t)repetitions, sizeof(long long), compareTimes);
+    double best = (double)micros[0];  // Interference only ever makes a run slower
+    double nsPerOp = best * 1000.0 / (double)ops;
+    double mbPerSecond = best > 0.0 ? inputBytes / best : 0.0;  // bytes per microsecond = MB/s
+
+    char line[256];
+    snprintf(line, sizeof(line), "{\"name\":\"%s\",\"ns_per_op\":%.4g,\"ops\":%ld,\"mb_per_s\":%.4g}", name, nsPerOp, ops, mbPerSecond);
+    printf("%s", line);
+    if (resultsFile) {
+        fprintf(resultsFile, "%s\n", line);
+    }
+
+    for (int i = 0; i < numBaseline; i++) {
+        if (strcmp(baseline[i].name, name) == 0 && baseline[i].nsPerOp > 0.0) {
+            double change = nsPerOp / baseline[i].nsPerOp - 1.0;
+            printf("  %+.1f%%", change * 100.0);
+            if (change > BENCH_REGRESSION) {
+                printf(" REGRESSION");
+                regressions++;
+            }
+        }
+    }
+    printf("\n");
+}
+
+// Function to time a benchmark body: warm up, pick a call count that fills BENCH_MIN_MICROS, then keep the best of several repetitions
+static void runTimed(const char *name, BenchBody body, void *context, long opsPerCall, double bytesPerCall, int repetitions) {
+    long long micros[BENCH_REPETITIONS];
+    long calls = 0;
+
+    long long start = getMonotonicMicros();
+    if (repetitions == 1) {
+        body(context);  // Long benchmarks are timed in one go, without a warm-up
+        micros[0] = getMonotonicMicros() - start;
+        recordResult(name, micros, 1, opsPerCall, bytesPerCall);
+        return;
+    }
+    while (getMonotonicMicros() - start < BENCH_MIN_MICROS || calls == 0) {
+        body(context);
+        calls++;
+    }
+
+    for (int r = 0; r < repetitions; r++) {
+        start = getMonotonicMicros();
+        for (long i = 0; i < calls; i++) {
+            body(context);
+        }
+        micros[r] = getMonotonicMicros() - start;
+    }
+    recordResult(name, micros, repetitions, opsPerCall * calls, bytesPerCall * (double)calls);
+}
+
+// Function to build a repeatable synthetic text of the given size; NULL if there is not enough memory
+static char *makeCorpus(size_t size) {
+    static const char *words[] = {"The", "waves", "crashed", "into", "the", "side", "of", "cliff,", "quick", "brown",
+                                  "fox", "jumps", "over", "a", "lazy", "dog.", "Robot", "writer", "AV", "To", "1024"};
+    char *text = malloc(size + 1);
+    unsigned int seed = 12345u;
+    size_t length = 0;
+    int wordsOnLine = 0;
+
+    if (!text) {
+        printf("Error: Out of memory building a %zu byte corpus.\n", size);
+        return NULL;
+    }
+    while (length < size) {
+        seed = seed * 1103515245u + 12345u;  // Fixed LCG so every run sees the same text
+        const char *word = words[(seed >> 16) % (sizeof(words) / sizeof(words[0]))];
+        size_t wordLength = strlen(word);
+        if (length + wordLength + 1 > size) {
+            break;
+        }
+        memcpy(text + length, word, wordLength);
+        length += wordLength;
+        text[length++] = (++wordsOnLine % 12 == 0) ? '\n' : ' ';
+    }
+    while (length < size) {
+        text[length++] = ' ';
+    }
+    text[length] = '\0';
+    return text;
+}
+
+// Benchmark body: parse the font file
+static void fontLoadBody(void *context) {
+    (void)context;
+    loadFontData("SingleStrokeFont.txt");
+}
+
+// Benchmark body: unpack the font built into the program
+static void fontBuiltinBody(void *context) {
+    (void)context;
+    loadFontData(NULL);
+}
+
+// Benchmark body: scale the font to a new height
+static void fontScaleBody(void *context) {
+    (void)context;
+    scaleFontData(5.0f);
+}
+
+// Benchmark body: emit one word's G-code through processWord()
+static void glyphEmitBody(void *context) {
+    static const char word[] = "TheQuickBrownFoxJumpsOverTheLazyDog";
+    GCodeBuffer *out = context;
+    Layout layout = {0};
+    int penState = 0;
+    layout.font = currentFont();
+    layout.charWidth = 5;
+    layout.penDown = 1000;
+    out->length = 0;
+    processWord(word, (int)(sizeof(word) - 1), 0, -5, &penState, &layout, out);
+}
+
+// Context for the generation benchmarks
+typedef struct {
+    char *text;
+    size_t size;
+    size_t sliceSize;        // Huge corpora are generated in slices so the program fits in memory
+    int threads;
+    int freshJobs;           // Each slice is a job of its own: 1 on the heap, 2 in a fresh arena
+    LayoutOptions options;
+    GCodeBuffer program;
+} GenerateContext;
+
+// Benchmark body: generate the whole corpus, slice by slice
+static void generateBody(void *context) {
+    GenerateContext *job = context;
+    for (size_t offset = 0; offset < job->size; ) {
+        size_t end = offset + job->sliceSize < job->size ? offset + job->sliceSize : job->size;
+        while (end < job->size && job->text[end] != ' ' && job->text[end] != '\n') {
+            end++;  // Cut between words
+        }
+        char saved = job->text[end];
+        job->text[end] = '\0';
+        if (job->freshJobs) {
+            Arena *arena = job->freshJobs == 2 ? createArena() : NULL;
+            GCodeBuffer program;
+            initGCodeBufferInArena(&program, arena);
+            generateGCode(job->text + offset, &job->options, &program, job->threads);
+            freeGCodeBuffer(&program);
+            destroyArena(arena);
+        } else {
+            job->program.length = 0;
+            generateGCode(job->text + offset, &job->options, &job->program, job->threads);
+        }
+        job->text[end] = saved;
+        offset = end + (end < job->size ? 1 : 0);
+    }
+}
+
+// Function to time full generation over a synthetic corpus
+static void benchGenerate(const char *name, size_t size, size_t sliceSize, int threads, int freshJobs, int repetitions) {
+    GenerateContext job;
+    job.text = makeCorpus(size);
+    if (!job.text) {
+        printf("Skipping %s\n", name);
+        return;
+    }
+    job.size = size;
+    job.sliceSize = sliceSize;
+    job.threads = threads;
+    job.freshJobs = freshJobs;
+    defaultLayoutOptions(&job.options, 5.0f);
+    initGCodeBuffer(&job.program);
+
+    runTimed(name, generateBody, &job, 1, (double)size, repetitions);
+
+    freeGCodeBuffer(&job.program);
+    free(job.text);
+}
+
+// Context for the re-render benchmark
+typedef struct {
+    char *text;
+    size_t editAt;           // Character changed before each render
+    LayoutOptions options;
+    RenderCache cache;
+    GCodeBuffer program;
+} RerenderContext;
+
+// Benchmark body: change one letter of the text and regenerate it from the render cache
+static void rerenderBody(void *context) {
+    RerenderContext *job = context;
+    job->text[job->editAt] = job->text[job->editAt] == 'a' ? 'e' : 'a';
+    job->program.length = 0;
+    generateGCodeCached(job->text, &job->options, &job->cache, &job->program);
+}
+
+// Function to time regenerating a document after a one letter edit, against regenerating it in full
+static void benchRerender(const char *name, size_t size, int repetitions) {
+    RerenderContext job;
+    job.text = makeCorpus(size);
+    if (!job.text) {
+        printf("Skipping %s\n", name);
+        return;
+    }
+    job.editAt = size / 2;
+    while (job.editAt < size && (job.text[job.editAt] == ' ' || job.text[job.editAt] == '\n')) {
+        job.editAt++;
+    }
+    defaultLayoutOptions(&job.options, 5.0f);
+    initRenderCache(&job.cache);
+    initGCodeBuffer(&job.program);
+    generateGCodeCached(job.text, &job.options, &job.cache, &job.program);  // The document as it was before the edit
+
+    runTimed(name, rerenderBody, &job, 1, (double)size, repetitions);
+
+    freeGCodeBuffer(&job.program);
+    freeRenderCache(&job.cache);
+    free(job.text);
+}
+
+// The queue jobs went through before the lock-free one, kept to compare against
+typedef struct {
+    pthread_mutex_t lock;
+    void *slots[JOB_QUEUE_SLOTS];
+    size_t head;
+    size_t tail;
+} LockedQueue;
+
+// Context for the job queue benchmarks
+typedef struct {
+    int locked;              // 1 to use the mutex queue
+    JobQueue queue;
+    LockedQueue lockedQueue;
+    atomic_long taken;       // Jobs popped so far in this call
+} QueueContext;
+
+// Function to push onto the mutex queue; -1 if it is full
+static int pushLocked(LockedQueue *queue, void *job) {
+    int result = -1;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->tail - queue->head < JOB_QUEUE_SLOTS) {
+        queue->slots[queue->tail++ & (JOB_QUEUE_SLOTS - 1)] = job;
+        result = 0;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+
+// Function to pop from the mutex queue; NULL if it is empty
+static void *popLocked(LockedQueue *queue) {
+    void *job = NULL;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->head != queue->tail) {
+        job = queue->slots[queue->head++ & (JOB_QUEUE_SLOTS - 1)];
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return job;
+}
+
+// Thread pushing its share of the jobs, waiting whenever the queue is full
+static void *queueProducer(void *arg) {
+    QueueContext *bench = arg;
+    for (uintptr_t i = 1; i <= QUEUE_ITEMS / QUEUE_THREADS; i++) {
+        while ((bench->locked ? pushLocked(&bench->lockedQueue, (void *)i) : pushJob(&bench->queue, (void *)i, PRIORITY_NORMAL)) != 0) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// Thread popping jobs until every job pushed in this call has been taken
+static void *queueConsumer(void *arg) {
+    QueueContext *bench = arg;
+    while (atomic_load(&bench->taken) < (QUEUE_ITEMS / QUEUE_THREADS) * QUEUE_THREADS) {
+        void *job = bench->locked ? popLocked(&bench->lockedQueue) : popJob(&bench->queue, NULL);
+        if (job) {
+            atomic_fetch_add(&bench->taken, 1);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// Benchmark body: pass a burst of jobs from several producers to several consumers
+static void queueBody(void *context) {
+    QueueContext *bench = context;
+    pthread_t producers[QUEUE_THREADS], consumers[QUEUE_THREADS];
+    atomic_store(&bench->taken, 0);
+    for (int t = 0; t < QUEUE_THREADS; t++) {
+        pthread_create(&consumers[t], NULL, queueConsumer, bench);
+        pthread_create(&producers[t], NULL, queueProducer, bench);
+    }
+    for (int t = 0; t < QUEUE_THREADS; t++) {
+        pthread_join(producers[t], NULL);
+        pthread_join(consumers[t], NULL);
+    }
+}
+
+// Function to time the lock-free job queue against the mutex queue under the same bursty load
+static void benchJobQueue(void) {
+    QueueContext *bench = malloc(sizeof(QueueContext));
+    if (!bench) {
+        printf("Skipping job queue benchmarks\n");
+        return;
+    }
+    initJobQueue(&bench->queue);
+    pthread_mutex_init(&bench->lockedQueue.lock, NULL);
+    bench->lockedQueue.head = 0;
+    bench->lockedQueue.tail = 0;
+    long ops = (QUEUE_ITEMS / QUEUE_THREADS) * QUEUE_THREADS;
+
+    bench->locked = 0;
+    runTimed("job_queue_lockfree_4x4", queueBody, bench, ops, 0.0, BENCH_REPETITIONS);
+    bench->locked = 1;
+    runTimed("job_queue_locked_4x4", queueBody, bench, ops, 0.0, BENCH_REPETITIONS);
+
+    pthread_mutex_destroy(&bench->lockedQueue.lock);
+    free(bench);
+}
+
+#if defined(__linux__) || defined(__FreeBSD__)
+
+// Thread standing in for GRBL: acknowledges every line it receives
+static void *mockController(void *arg) {
+    int master = *(int *)arg;
+    char buffer[4096];
+    ssize_t n;
+    while ((n = read(master, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            if (buffer[i] == '\n' && write(master, "ok\r\n", 4) != 4) {
+                return NULL;
+            }
+        }
+    }
+    return NULL;  // The sender closed its end
+}
+
+// Context for the transport benchmark
+typedef struct {
+    int port;                // Our end of the pseudo terminal
+    const GCodeBuffer *program;
+} TransportContext;
+
+// Benchmark body: send the program line by line, waiting for each ok the way WaitForReply() does but without the sleeps
+static void transportBody(void *context) {
+    TransportContext *link = context;
+    const GCodeBuffer *program = link->program;
+    size_t offset = 0;
+
+    while (offset < program->length) {
+        const char *end = memchr(program->data + offset, '\n', program->length - offset);
+        size_t lineLength = (size_t)(end - (program->data + offset)) + 1;
+        if (write(link->port, program->data + offset, lineLength) != (ssize_t)lineLength) {
+            return;
+        }
+        offset += lineLength;
+
+        char reply[64];
+        size_t got = 0;
+        while (got < 4) {
+            ssize_t n = read(link->port, reply + got, sizeof(reply) - got);
+            if (n <= 0) {
+                return;
+            }
+            got += (size_t)n;
+        }
+    }
+}
+
+// Function to time the line protocol against a mock controller on a pseudo terminal
+static void benchTransport(void) {
+    char *text = makeCorpus(1024);
+    GCodeBuffer program;
+    LayoutOptions options;
+    long lines = 0;
+
+    defaultLayoutOptions(&options, 5.0f);
+    initGCodeBuffer(&program);
+    if (!text || generateGCode(text, &options, &program, 1) != 0) {
+        printf("Skipping transport benchmark: unable to generate a program\n");
+        free(text);
+        freeGCodeBuffer(&program);
+        return;
+    }
+    free(text);
+    for (size_t i = 0; i < program.length; i++) {
+        lines += program.data[i] == '\n';
+    }
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0) {
+        printf("Skipping transport benchmark: no pseudo terminals available\n");
+        freeGCodeBuffer(&program);
+        return;
+    }
+    TransportContext link;
+    link.program = &program;
+    link.port = open(ptsname(master), O_RDWR | O_NOCTTY);
+    struct termios settings;
+    tcgetattr(link.port, &settings);
+    cfmakeraw(&settings);
+    tcsetattr(link.port, TCSANOW, &settings);
+
+    pthread_t controller;
+    pthread_create(&controller, NULL, mockController, &master);
+
+    runTimed("transport_pty_line", transportBody, &link, lines, (double)program.length, BENCH_REPETITIONS);
+
+    close(link.port);
+    pthread_join(controller, NULL);  // Sees EIO once our end is closed
+    close(master);
+    freeGCodeBuffer(&program);
+}
+
+#else
+
+// Function standing in for the transport benchmark where there are no pseudo terminals
+static void benchTransport(void) {
+    printf("Skipping transport benchmark: pseudo terminals are not available on this platform\n");
+}
+
+#endif
+
+// Function to run the whole suite, write the results and compare them with a baseline
+int runBenchmarks(const char *baselineFile, int large) {
+    if (loadFontData("SingleStrokeFont.txt") != 0) {
+        return 1;  // Every benchmark after font_load needs the font
+    }
+    if (baselineFile) {
+        loadBaseline(baselineFile);
+    }
+    resultsFile = fopen(BENCH_RESULTS_FILE, "w");
+    if (!resultsFile) {
+        printf("Error opening file: %s\n", BENCH_RESULTS_FILE);
+    }
+
+    GCodeBuffer out;
+    initGCodeBuffer(&out);
+    runTimed("font_load", fontLoadBody, NULL, 1, 0.0, BENCH_REPETITIONS);
+    runTimed("font_builtin", fontBuiltinBody, NULL, 1, 0.0, BENCH_REPETITIONS);
+    runTimed("font_scale", fontScaleBody, NULL, 1, 0.0, BENCH_REPETITIONS);
+    runTimed("glyph_emit", glyphEmitBody, &out, 35, 0.0, BENCH_REPETITIONS);  // 35 glyphs per word
+    freeGCodeBuffer(&out);
+    benchGenerate("generate_1KB_serial", 1024, 1024, 1, 0, BENCH_REPETITIONS);
+    benchGenerate("generate_1MB_serial", 1 << 20, 1 << 20, 1, 0, BENCH_REPETITIONS);
+    benchGenerate("generate_1MB_parallel", 1 << 20, 1 << 20, 0, 0, BENCH_REPETITIONS);
+    benchGenerate("generate_1MB_heap_jobs", 1 << 20, 16 << 10, 1, 1, BENCH_REPETITIONS);  // 64 jobs of 16KB
+    benchGenerate("generate_1MB_arena_jobs", 1 << 20, 16 << 10, 1, 2, BENCH_REPETITIONS);
+    benchGenerate("generate_256KB_serial", 256 << 10, 256 << 10, 1, 0, BENCH_REPETITIONS);
+    benchRerender("rerender_256KB_one_edit", 256 << 10, BENCH_REPETITIONS);  // Compare with generate_256KB_serial
+    if (large) {
+        benchGenerate("generate_100MB_parallel", 100u << 20, 1 << 20, 0, 0, 1);  // One repetition, it takes minutes
+    }
+    benchJobQueue();
+    benchTransport();
+
+    if (resultsFile) {
+        fclose(resultsFile);
+        resultsFile = NULL;
+    }
+    printf("Results written to %s", BENCH_RESULTS_FILE);
+    if (numBaseline > 0) {
+        printf(", %d regression%s against %s", regressions, regressions == 1 ? "" : "s", baselineFile);
+    }
+    printf("\n");
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,20 @@
+#include <stdio.h>
+
+
+#ifndef BENCH_H_INCLUDED
+#define BENCH_H_INCLUDED
+
+
+#define BENCH_RESULTS_FILE "bench_results.jsonl"  // Written by every benchmark run
+#define BENCH_REPETITIONS 5         // Each benchmark reports the best of this many runs
+#define BENCH_REGRESSION 0.15       // Slowdown against the baseline that fails the run
+
+/*
+ Results are JSON lines, one benchmark per line, e.g.
+     {"name":"generate_1MB_serial","ns_per_op":1.83e+09,"ops":1,"mb_per_s":0.55}
+ Keep a copy as the baseline and pass it to the next run to catch regressions.
+*/
+
+int runBenchmarks(const char *baselineFile, int large);   // Returns 1 if anything regressed
+
+#endif // BENCH_H_INCLUDED
@@ -0,0 +1,556 @@
+// The built-in font, made from SingleStrokeFont.txt by --embed-font; make it again rather than editing it
+#include "font.h"
+
+static const EmbeddedMovement movements[] = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {19, 0, 0}, {3, 0, 1}, {0, 3, 1}, {0, 24, 1},
+    {3, 27, 1}, {14, 27, 1}, {20, 27, 0}, {42, 27, 1}, {45, 24, 1}, {45, 3, 1}, {42, 0, 1}, {25, 0, 1},
+    {13, 9, 0}, {17, 27, 1}, {15, 18, 0}, {19, 18, 1}, {21, 16, 1}, {20, 9, 1}, {22, 0, 0}, {26, 18, 1},
+    {30, 18, 1}, {32, 16, 1}, {31, 11, 1}, {29, 9, 1}, {24, 9, 1}, {54, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -7, 0}, {1, 7, 1}, {3, 16, 1},
+    {7, 18, 1}, {12, 16, 1}, {12, 10, 1}, {8, 8, 1}, {2, 8, 1}, {8, 8, 0}, {11, 7, 1}, {12, 3, 1},
+    {9, 0, 1}, {5, 0, 1}, {1, 3, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -4, 1}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {-4, 0, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {4, 0, 1}, {0, 0, 0}, {0, 0, 0}, {-18, 0, 0}, {0, 0, 0}, {0, -9, 0},
+    {0, 0, 0}, {0, -36, 0}, {0, 0, 0}, {0, 36, 0}, {0, 0, 0}, {0, 9, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {-4, 0, 0}, {4, 0, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 4, 0}, {0, -4, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4, 4, 0}, {-4, -4, 1}, {0, -5, 0},
+    {0, 5, 1}, {-4, 4, 0}, {4, -4, 1}, {5, 0, 0}, {-5, 0, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {-2, -5, 0}, {-5, -2, 1}, {-5, 2, 1}, {-2, 5, 1}, {2, 5, 1}, {5, 2, 1}, {5, -2, 1}, {2, -5, 1},
+    {-2, -5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 10, 0}, {6, 18, 1}, {12, 10, 1}, {6, 18, 0}, {6, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 3, 0}, {0, 9, 1}, {6, 15, 1}, {0, 9, 0},
+    {12, 9, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 8, 0}, {6, 0, 1}, {12, 8, 1}, {6, 0, 0}, {6, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 3, 0}, {12, 9, 1}, {6, 15, 1}, {0, 9, 0},
+    {12, 9, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 3, 0},
+    {3, 0, 1}, {6, 20, 1}, {13, 20, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3, 0, 0}, {4, 12, 1}, {9, 0, 0},
+    {9, 12, 1}, {0, 10, 0}, {4, 12, 1}, {9, 12, 1}, {12, 14, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 15, 1}, {12, 0, 1}, {0, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, -7, 0}, {2, 11, 1}, {1, 2, 0}, {6, 0, 1}, {10, 2, 1}, {11, 11, 1}, {10, 2, 0},
+    {13, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 16, 0}, {4, 18, 1}, {4, 21, 1}, {6, 23, 1},
+    {9, 23, 1}, {11, 21, 1}, {11, 18, 1}, {9, 16, 1}, {6, 16, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {4, 0, 1}, {1, 7, 1}, {1, 12, 1}, {4, 16, 1}, {9, 16, 1}, {12, 12, 1},
+    {12, 7, 1}, {9, 0, 1}, {13, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -7, 0}, {3, 9, 1},
+    {7, 12, 1}, {11, 11, 1}, {13, 8, 1}, {13, 4, 1}, {10, 0, 1}, {5, 0, 1}, {2, 3, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4, 0, 1}, {2, 0, 0}, {2, 18, 1}, {0, 18, 0}, {12, 18, 1}, {12, 14, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {7, 0, 0}, {2, 0, 1},
+    {0, 4, 1}, {0, 10, 1}, {2, 15, 1}, {5, 18, 1}, {10, 18, 1}, {12, 14, 1}, {12, 8, 1}, {10, 3, 1},
+    {7, 0, 1}, {0, 9, 0}, {12, 9, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 10, 1}, {0, 17, 0}, {3, 18, 1}, {9, 2, 1},
+    {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {6, 0, 0}, {6, 0, 1}, {6, 5, 0}, {6, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3, 14, 0}, {4, 18, 1}, {7, 14, 0}, {8, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {2, 0, 0}, {4, 18, 1}, {8, 0, 0}, {10, 18, 1}, {0, 13, 0}, {12, 13, 1}, {0, 5, 0},
+    {12, 5, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 3, 0}, {3, 1, 1}, {9, 1, 1}, {12, 3, 1}, {12, 7, 1}, {9, 9, 1}, {3, 9, 1},
+    {0, 11, 1}, {0, 15, 1}, {3, 17, 1}, {9, 17, 1}, {12, 15, 1}, {6, 19, 0}, {6, -1, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 18, 1}, {6, 14, 0},
+    {3, 10, 1}, {0, 14, 1}, {3, 18, 1}, {6, 14, 1}, {9, 8, 0}, {12, 4, 1}, {9, 0, 1}, {6, 4, 1},
+    {9, 8, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 5, 0}, {8, 0, 1}, {2, 0, 1}, {0, 4, 1},
+    {9, 14, 1}, {7, 18, 1}, {3, 18, 1}, {1, 14, 1}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {5, 14, 0}, {7, 18, 1}, {7, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, -2, 0}, {6, 4, 1}, {6, 14, 1}, {12, 20, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -2, 0}, {6, 4, 1}, {6, 14, 1},
+    {0, 20, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {3, 2, 0}, {9, 16, 1}, {3, 16, 0}, {9, 2, 1}, {0, 9, 0}, {12, 9, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 2, 0}, {6, 16, 1}, {0, 9, 0},
+    {12, 9, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {4, -4, 0}, {6, 1, 1},
+    {6, 1, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 9, 0}, {12, 9, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 0, 0}, {6, 0, 1}, {6, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {1, 2, 0}, {11, 16, 1}, {12, 12, 0}, {12, 6, 1}, {9, 0, 1}, {3, 0, 1},
+    {0, 6, 1}, {0, 12, 1}, {3, 18, 1}, {9, 18, 1}, {12, 12, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3, 0, 0}, {9, 0, 1}, {6, 0, 0}, {6, 18, 1},
+    {3, 15, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 15, 0}, {3, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 11, 1},
+    {2, 5, 1}, {0, 0, 1}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 16, 0}, {3, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 11, 1}, {9, 9, 1},
+    {3, 9, 1}, {9, 9, 0}, {12, 7, 1}, {12, 3, 1}, {9, 0, 1}, {3, 0, 1}, {0, 2, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {9, 0, 0}, {9, 18, 1}, {0, 6, 1},
+    {12, 6, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 2, 0}, {3, 0, 1}, {9, 0, 1},
+    {12, 2, 1}, {12, 8, 1}, {9, 10, 1}, {3, 10, 1}, {0, 9, 1}, {2, 18, 1}, {12, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 7, 0}, {3, 10, 1}, {9, 10, 1}, {12, 7, 1},
+    {12, 3, 1}, {9, 0, 1}, {3, 0, 1}, {0, 3, 1}, {0, 10, 1}, {3, 15, 1}, {7, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 0}, {12, 18, 1}, {4, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {3, 10, 0}, {0, 13, 1}, {0, 16, 1}, {3, 19, 1}, {9, 19, 1}, {12, 16, 1}, {12, 13, 1},
+    {9, 10, 1}, {3, 10, 1}, {0, 7, 1}, {0, 3, 1}, {3, 0, 1}, {9, 0, 1}, {12, 3, 1}, {12, 7, 1},
+    {9, 10, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {5, 0, 0}, {9, 3, 1},
+    {12, 8, 1}, {12, 15, 1}, {9, 18, 1}, {3, 18, 1}, {0, 15, 1}, {0, 11, 1}, {3, 8, 1}, {9, 8, 1},
+    {12, 11, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 4, 0},
+    {6, 4, 1}, {6, 14, 0}, {6, 14, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {5, -4, 0}, {7, 0, 1}, {7, 0, 1}, {7, 10, 0}, {7, 10, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 0, 0}, {0, 9, 1}, {12, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 4, 0}, {12, 4, 1}, {0, 14, 0},
+    {12, 14, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 9, 1},
+    {0, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 15, 0}, {3, 18, 1}, {9, 18, 1}, {12, 15, 1},
+    {12, 11, 1}, {6, 7, 1}, {6, 4, 1}, {6, 0, 0}, {6, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 2, 0}, {10, 0, 1}, {3, 0, 1}, {0, 3, 1}, {0, 15, 1},
+    {3, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 6, 1}, {5, 6, 1}, {5, 13, 1}, {12, 13, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 18, 1},
+    {12, 0, 1}, {3, 9, 0}, {9, 9, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 12, 1}, {9, 9, 1}, {0, 9, 1},
+    {9, 9, 0}, {12, 6, 1}, {12, 3, 1}, {9, 0, 1}, {0, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 3, 0},
+    {9, 0, 1}, {3, 0, 1}, {0, 3, 1}, {0, 15, 1}, {3, 18, 1}, {9, 18, 1}, {12, 15, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 3, 1}, {9, 0, 1}, {0, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 18, 1}, {12, 18, 1}, {0, 9, 0}, {9, 9, 1}, {0, 0, 0}, {12, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1},
+    {12, 18, 1}, {0, 9, 0}, {9, 9, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 15, 0},
+    {9, 18, 1}, {3, 18, 1}, {0, 15, 1}, {0, 3, 1}, {3, 0, 1}, {9, 0, 1}, {12, 3, 1}, {12, 8, 1},
+    {5, 8, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {12, 0, 0}, {12, 18, 1}, {0, 9, 0}, {12, 9, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {2, 0, 0},
+    {10, 0, 1}, {6, 0, 0}, {6, 18, 1}, {2, 18, 0}, {10, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 2, 0}, {3, 0, 1},
+    {5, 0, 1}, {8, 2, 1}, {8, 18, 1}, {4, 18, 0}, {12, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {12, 18, 0},
+    {0, 6, 1}, {3, 9, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {0, 0, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {6, 5, 1}, {12, 18, 1},
+    {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 18, 1}, {12, 0, 1}, {12, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3, 0, 0}, {0, 3, 1},
+    {0, 15, 1}, {3, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 3, 1}, {9, 0, 1}, {3, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 11, 1}, {9, 8, 1}, {0, 8, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {3, 0, 0}, {0, 3, 1}, {0, 15, 1}, {3, 18, 1},
+    {9, 18, 1}, {12, 15, 1}, {12, 3, 1}, {9, 0, 1}, {3, 0, 1}, {7, 5, 0}, {14, -2, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {9, 18, 1}, {12, 15, 1}, {12, 11, 1}, {9, 8, 1},
+    {0, 8, 1}, {7, 8, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 2, 0}, {3, 0, 1}, {9, 0, 1}, {12, 3, 1}, {12, 6, 1}, {9, 9, 1}, {3, 9, 1},
+    {0, 12, 1}, {0, 15, 1}, {3, 18, 1}, {9, 18, 1}, {12, 16, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 0, 0}, {6, 18, 1}, {0, 18, 0}, {12, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 0},
+    {0, 3, 1}, {3, 0, 1}, {9, 0, 1}, {12, 3, 1}, {12, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 18, 0}, {6, 0, 1}, {12, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 0}, {3, 0, 1}, {6, 14, 1}, {9, 0, 1},
+    {12, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {12, 18, 1}, {0, 18, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {6, 0, 0}, {6, 7, 1}, {0, 18, 1}, {6, 7, 0}, {12, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 18, 1},
+    {0, 18, 1}, {12, 0, 0}, {0, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {12, 20, 0}, {6, 20, 1}, {6, -2, 1}, {12, -2, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 18, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, -2, 0}, {6, -2, 1}, {6, 20, 1}, {0, 20, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 7, 0}, {6, 16, 1}, {12, 7, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {-18, -5, 0}, {0, -5, 1}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {5, 18, 0}, {5, 18, 1}, {7, 14, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 10, 0}, {5, 12, 1}, {11, 10, 1}, {11, 2, 1}, {8, 0, 1}, {4, 0, 1}, {0, 2, 1}, {0, 5, 1},
+    {11, 6, 1}, {11, 2, 0}, {13, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {0, 9, 0},
+    {6, 11, 1}, {12, 9, 1}, {12, 2, 1}, {6, 0, 1}, {0, 2, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11, 9, 0}, {6, 11, 1}, {0, 9, 1},
+    {0, 2, 1}, {6, 0, 1}, {11, 2, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 2, 0}, {6, 0, 1}, {0, 2, 1},
+    {0, 9, 1}, {6, 11, 1}, {12, 9, 1}, {12, 18, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 6, 0}, {12, 7, 1}, {9, 12, 1}, {3, 12, 1}, {0, 9, 1}, {0, 2, 1}, {3, 0, 1}, {9, 0, 1},
+    {12, 2, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {4, 0, 0}, {4, 16, 1}, {8, 18, 1}, {12, 16, 1}, {0, 9, 0}, {8, 9, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11, 2, 0}, {6, 0, 1}, {0, 2, 1}, {0, 9, 1}, {6, 11, 1},
+    {11, 9, 1}, {11, 11, 0}, {11, -5, 1}, {6, -7, 1}, {0, -5, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {0, 9, 0},
+    {6, 11, 1}, {12, 9, 1}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {7, 0, 0}, {7, 11, 1}, {4, 11, 1}, {7, 18, 0}, {7, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -5, 0},
+    {4, -7, 1}, {8, -5, 1}, {8, 11, 1}, {8, 18, 0}, {8, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {0, 5, 0},
+    {12, 11, 1}, {4, 7, 0}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {3, 0, 0}, {9, 0, 1}, {6, 0, 0}, {6, 18, 1}, {3, 18, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 12, 1}, {0, 9, 0}, {4, 12, 1}, {6, 9, 1},
+    {6, 0, 1}, {6, 9, 0}, {10, 12, 1}, {12, 9, 1}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 11, 1}, {0, 8, 0},
+    {6, 11, 1}, {12, 8, 1}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {6, 0, 0}, {0, 2, 1}, {0, 9, 1}, {6, 11, 1},
+    {12, 9, 1}, {12, 2, 1}, {6, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -7, 0}, {0, 11, 1}, {0, 9, 0},
+    {6, 11, 1}, {12, 9, 1}, {12, 2, 1}, {6, 0, 1}, {0, 2, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {11, 2, 0}, {6, 0, 1}, {0, 2, 1}, {0, 9, 1}, {6, 11, 1}, {11, 9, 1}, {11, 11, 0}, {11, -6, 1},
+    {13, -8, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 11, 1}, {0, 8, 0}, {6, 11, 1}, {12, 8, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 2, 0},
+    {6, 0, 1}, {12, 2, 1}, {12, 5, 1}, {0, 7, 1}, {0, 10, 1}, {6, 12, 1}, {12, 10, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, 2, 0},
+    {8, 0, 1}, {4, 2, 1}, {4, 18, 1}, {0, 11, 0}, {8, 11, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 11, 0}, {0, 2, 1}, {6, 0, 1}, {12, 2, 1},
+    {12, 11, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 11, 0}, {6, 0, 1},
+    {12, 11, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 11, 0}, {3, 0, 1}, {6, 8, 1}, {9, 0, 1}, {12, 11, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {11, 11, 1}, {0, 11, 0}, {11, 0, 1}, {18, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 11, 0}, {7, 1, 1}, {3, -7, 0},
+    {12, 11, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 11, 0},
+    {12, 11, 1}, {0, 0, 1}, {12, 0, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {12, -2, 0}, {7, 1, 1}, {7, 6, 1}, {4, 9, 1},
+    {7, 12, 1}, {7, 17, 1}, {12, 20, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {6, 0, 0}, {6, 6, 1}, {6, 12, 0}, {6, 18, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, -2, 0}, {5, 1, 1},
+    {5, 6, 1}, {8, 9, 1}, {5, 12, 1}, {5, 17, 1}, {0, 20, 1}, {18, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 53, 1}, {53, 53, 1}, {53, 0, 1},
+    {0, 0, 1}, {56, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {0, 0, 0}, {0, 18, 1}, {12, 9, 1}, {0, 0, 1}, {0, 3, 0}, {4, 3, 1}, {4, 15, 1},
+    {0, 15, 1}, {0, 6, 0}, {8, 6, 1},
+};
+
+static const EmbeddedGlyph glyphs[MAX_CHARACTERS] = {
+    {0, 2, 0, 0, 0, 0, 0},  // 0
+    {2, 52, 0, 0, 1, 0, 45},  // 1
+    {54, 30, -7, 0, 1, 0, 12},  // 2
+    {84, 0, 0, -1, 0, 0, 0},  // 3
+    {84, 6, 0, 0, 1, 0, 0},  // 4
+    {90, 6, -4, 0, 1, 0, 0},  // 5
+    {96, 6, 0, 0, 1, -4, 0},  // 6
+    {102, 6, 0, 0, 1, 0, 4},  // 7
+    {108, 2, 0, 0, 0, 0, 0},  // 8
+    {110, 2, -9, 0, 0, 0, 0},  // 9
+    {112, 2, -36, 0, 0, 0, 0},  // 10
+    {114, 2, 0, 0, 0, 0, 0},  // 11
+    {116, 2, 0, 0, 0, 0, 0},  // 12
+    {118, 2, 0, 0, 0, 0, 0},  // 13
+    {120, 6, 0, 0, 1, -4, 4},  // 14
+    {126, 6, -4, 0, 1, 0, 0},  // 15
+    {132, 18, -5, 0, 1, -5, 5},  // 16
+    {150, 20, -5, 0, 1, -5, 5},  // 17
+    {170, 12, 0, 0, 1, 0, 12},  // 18
+    {182, 12, 0, 0, 1, 0, 12},  // 19
+    {194, 12, 0, 0, 1, 0, 12},  // 20
+    {206, 12, 0, 0, 1, 0, 12},  // 21
+    {218, 10, 0, 0, 1, 0, 13},  // 22
+    {228, 18, 0, 0, 1, 0, 12},  // 23
+    {246, 10, 0, 0, 1, 0, 12},  // 24
+    {256, 18, -7, 0, 1, 0, 13},  // 25
+    {274, 20, 0, 0, 1, 4, 11},  // 26
+    {294, 22, 0, 0, 1, 0, 13},  // 27
+    {316, 20, -7, 0, 1, 0, 13},  // 28
+    {336, 16, 0, 0, 1, 0, 12},  // 29
+    {352, 28, 0, 0, 1, 0, 12},  // 30
+    {380, 14, 0, 0, 1, 0, 12},  // 31
+    {394, 2, 0, 0, 0, 0, 0},  // 32
+    {396, 10, 0, 0, 1, 6, 6},  // 33 '!'
+    {406, 10, 0, 0, 1, 3, 8},  // 34 '"'
+    {416, 18, 0, 0, 1, 0, 12},  // 35 '#'
+    {434, 30, -1, 0, 1, 0, 12},  // 36 '$'
+    {464, 26, 0, 0, 1, 0, 12},  // 37 '%'
+    {490, 20, 0, 0, 1, 0, 12},  // 38 '&'
+    {510, 8, 0, 0, 1, 5, 7},  // 39 '''
+    {518, 10, -2, 0, 1, 6, 12},  // 40 '('
+    {528, 10, -2, 0, 1, 0, 6},  // 41 ')'
+    {538, 14, 0, 0, 1, 0, 12},  // 42 '*'
+    {552, 10, 0, 0, 1, 0, 12},  // 43 '+'
+    {562, 8, -4, 0, 1, 4, 6},  // 44 ','
+    {570, 6, 0, 0, 1, 0, 12},  // 45 '-'
+    {576, 8, 0, 0, 1, 6, 6},  // 46 '.'
+    {584, 6, 0, 0, 1, 0, 12},  // 47 '/'
+    {590, 24, 0, 0, 1, 0, 12},  // 48 '0'
+    {614, 12, 0, 0, 1, 3, 9},  // 49 '1'
+    {626, 18, 0, 0, 1, 0, 12},  // 50 '2'
+    {644, 28, 0, 0, 1, 0, 12},  // 51 '3'
+    {672, 10, 0, 0, 1, 0, 12},  // 52 '4'
+    {682, 22, 0, 0, 1, 0, 12},  // 53 '5'
+    {704, 24, 0, 0, 1, 0, 12},  // 54 '6'
+    {728, 8, 0, 0, 1, 0, 12},  // 55 '7'
+    {736, 34, 0, 0, 1, 0, 12},  // 56 '8'
+    {770, 24, 0, 0, 1, 0, 12},  // 57 '9'
+    {794, 10, 0, 0, 1, 6, 6},  // 58 ':'
+    {804, 12, -4, 0, 1, 5, 7},  // 59 ';'
+    {816, 8, 0, 0, 1, 0, 12},  // 60 '<'
+    {824, 10, 0, 0, 1, 0, 12},  // 61 '='
+    {834, 8, 0, 0, 1, 0, 12},  // 62 '>'
+    {842, 20, 0, 0, 1, 0, 12},  // 63 '?'
+    {862, 26, 0, 0, 1, 0, 12},  // 64 '@'
+    {888, 12, 0, 0, 1, 0, 12},  // 65 'A'
+    {900, 26, 0, 0, 1, 0, 12},  // 66 'B'
+    {926, 18, 0, 0, 1, 0, 12},  // 67 'C'
+    {944, 16, 0, 0, 1, 0, 12},  // 68 'D'
+    {960, 16, 0, 0, 1, 0, 12},  // 69 'E'
+    {976, 12, 0, 0, 1, 0, 12},  // 70 'F'
+    {988, 22, 0, 0, 1, 0, 12},  // 71 'G'
+    {1010, 14, 0, 0, 1, 0, 12},  // 72 'H'
+    {1024, 14, 0, 0, 1, 2, 10},  // 73 'I'
+    {1038, 16, 0, 0, 1, 0, 12},  // 74 'J'
+    {1054, 14, 0, 0, 1, 0, 12},  // 75 'K'
+    {1068, 10, 0, 0, 1, 0, 12},  // 76 'L'
+    {1078, 12, 0, 0, 1, 0, 12},  // 77 'M'
+    {1090, 10, 0, 0, 1, 0, 12},  // 78 'N'
+    {1100, 20, 0, 0, 1, 0, 12},  // 79 'O'
+    {1120, 16, 0, 0, 1, 0, 12},  // 80 'P'
+    {1136, 24, -2, 0, 1, 0, 14},  // 81 'Q'
+    {1160, 20, 0, 0, 1, 0, 12},  // 82 'R'
+    {1180, 26, 0, 0, 1, 0, 12},  // 83 'S'
+    {1206, 10, 0, 0, 1, 0, 12},  // 84 'T'
+    {1216, 14, 0, 0, 1, 0, 12},  // 85 'U'
+    {1230, 8, 0, 0, 1, 0, 12},  // 86 'V'
+    {1238, 12, 0, 0, 1, 0, 12},  // 87 'W'
+    {1250, 10, 0, 0, 1, 0, 12},  // 88 'X'
+    {1260, 12, 0, 0, 1, 0, 12},  // 89 'Y'
+    {1272, 12, 0, 0, 1, 0, 12},  // 90 'Z'
+    {1284, 10, -2, 0, 1, 6, 12},  // 91 '['
+    {1294, 6, 0, 0, 1, 0, 12},  // 92 '\'
+    {1300, 10, -2, 0, 1, 0, 6},  // 93 ']'
+    {1310, 8, 0, 0, 1, 0, 12},  // 94 '^'
+    {1318, 6, -5, 0, 1, -18, 0},  // 95 '_'
+    {1324, 8, 0, 0, 1, 5, 7},  // 96 '`'
+    {1332, 24, 0, 0, 1, 0, 13},  // 97 'a'
+    {1356, 18, 0, 0, 1, 0, 12},  // 98 'b'
+    {1374, 14, 0, 0, 1, 0, 11},  // 99 'c'
+    {1388, 18, 0, 0, 1, 0, 12},  // 100 'd'
+    {1406, 20, 0, 0, 1, 0, 12},  // 101 'e'
+    {1426, 14, 0, 0, 1, 0, 12},  // 102 'f'
+    {1440, 22, -7, 0, 1, 0, 11},  // 103 'g'
+    {1462, 14, 0, 0, 1, 0, 12},  // 104 'h'
+    {1476, 12, 0, 0, 1, 4, 7},  // 105 'i'
+    {1488, 14, -7, 0, 1, 0, 8},  // 106 'j'
+    {1502, 14, 0, 0, 1, 0, 12},  // 107 'k'
+    {1516, 12, 0, 0, 1, 3, 9},  // 108 'l'
+    {1528, 22, 0, 0, 1, 0, 12},  // 109 'm'
+    {1550, 14, 0, 0, 1, 0, 12},  // 110 'n'
+    {1564, 16, 0, 0, 1, 0, 12},  // 111 'o'
+    {1580, 18, -7, 0, 1, 0, 12},  // 112 'p'
+    {1598, 20, -8, 0, 1, 0, 13},  // 113 'q'
+    {1618, 12, 0, 0, 1, 0, 12},  // 114 'r'
+    {1630, 18, 0, 0, 1, 0, 12},  // 115 's'
+    {1648, 14, 0, 0, 1, 0, 12},  // 116 't'
+    {1662, 12, 0, 0, 1, 0, 12},  // 117 'u'
+    {1674, 8, 0, 0, 1, 0, 12},  // 118 'v'
+    {1682, 12, 0, 0, 1, 0, 12},  // 119 'w'
+    {1694, 10, 0, 0, 1, 0, 11},  // 120 'x'
+    {1704, 10, -7, 0, 1, 0, 12},  // 121 'y'
+    {1714, 10, 0, 0, 1, 0, 12},  // 122 'z'
+    {1724, 16, -2, 0, 1, 4, 12},  // 123 '{'
+    {1740, 10, 0, 0, 1, 6, 6},  // 124 '|'
+    {1750, 16, -2, 0, 1, 0, 8},  // 125 '}'
+    {1766, 12, 0, 0, 1, 0, 53},  // 126 '~'
+    {1778, 25, 0, 1, 1, 0, 12},  // 127
+    {1803, 0, 0, -1, 0, 0, 0},  // 128
+    {1803, 0, 0, -1, 0, 0, 0},  // 129
+    {1803, 0, 0, -1, 0, 0, 0},  // 130
+    {1803, 0, 0, -1, 0, 0, 0},  // 131
+    {1803, 0, 0, -1, 0, 0, 0},  // 132
+    {1803, 0, 0, -1, 0, 0, 0},  // 133
+    {1803, 0, 0, -1, 0, 0, 0},  // 134
+    {1803, 0, 0, -1, 0, 0, 0},  // 135
+    {1803, 0, 0, -1, 0, 0, 0},  // 136
+    {1803, 0, 0, -1, 0, 0, 0},  // 137
+    {1803, 0, 0, -1, 0, 0, 0},  // 138
+    {1803, 0, 0, -1, 0, 0, 0},  // 139
+    {1803, 0, 0, -1, 0, 0, 0},  // 140
+    {1803, 0, 0, -1, 0, 0, 0},  // 141
+    {1803, 0, 0, -1, 0, 0, 0},  // 142
+    {1803, 0, 0, -1, 0, 0, 0},  // 143
+    {1803, 0, 0, -1, 0, 0, 0},  // 144
+    {1803, 0, 0, -1, 0, 0, 0},  // 145
+    {1803, 0, 0, -1, 0, 0, 0},  // 146
+    {1803, 0, 0, -1, 0, 0, 0},  // 147
+    {1803, 0, 0, -1, 0, 0, 0},  // 148
+    {1803, 0, 0, -1, 0, 0, 0},  // 149
+    {1803, 0, 0, -1, 0, 0, 0},  // 150
+    {1803, 0, 0, -1, 0, 0, 0},  // 151
+    {1803, 0, 0, -1, 0, 0, 0},  // 152
+    {1803, 0, 0, -1, 0, 0, 0},  // 153
+    {1803, 0, 0, -1, 0, 0, 0},  // 154
+    {1803, 0, 0, -1, 0, 0, 0},  // 155
+    {1803, 0, 0, -1, 0, 0, 0},  // 156
+    {1803, 0, 0, -1, 0, 0, 0},  // 157
+    {1803, 0, 0, -1, 0, 0, 0},  // 158
+    {1803, 0, 0, -1, 0, 0, 0},  // 159
+    {1803, 0, 0, -1, 0, 0, 0},  // 160
+    {1803, 0, 0, -1, 0, 0, 0},  // 161
+    {1803, 0, 0, -1, 0, 0, 0},  // 162
+    {1803, 0, 0, -1, 0, 0, 0},  // 163
+    {1803, 0, 0, -1, 0, 0, 0},  // 164
+    {1803, 0, 0, -1, 0, 0, 0},  // 165
+    {1803, 0, 0, -1, 0, 0, 0},  // 166
+    {1803, 0, 0, -1, 0, 0, 0},  // 167
+    {1803, 0, 0, -1, 0, 0, 0},  // 168
+    {1803, 0, 0, -1, 0, 0, 0},  // 169
+    {1803, 0, 0, -1, 0, 0, 0},  // 170
+    {1803, 0, 0, -1, 0, 0, 0},  // 171
+    {1803, 0, 0, -1, 0, 0, 0},  // 172
+    {1803, 0, 0, -1, 0, 0, 0},  // 173
+    {1803, 0, 0, -1, 0, 0, 0},  // 174
+    {1803, 0, 0, -1, 0, 0, 0},  // 175
+    {1803, 0, 0, -1, 0, 0, 0},  // 176
+    {1803, 0, 0, -1, 0, 0, 0},  // 177
+    {1803, 0, 0, -1, 0, 0, 0},  // 178
+    {1803, 0, 0, -1, 0, 0, 0},  // 179
+    {1803, 0, 0, -1, 0, 0, 0},  // 180
+    {1803, 0, 0, -1, 0, 0, 0},  // 181
+    {1803, 0, 0, -1, 0, 0, 0},  // 182
+    {1803, 0, 0, -1, 0, 0, 0},  // 183
+    {1803, 0, 0, -1, 0, 0, 0},  // 184
+    {1803, 0, 0, -1, 0, 0, 0},  // 185
+    {1803, 0, 0, -1, 0, 0, 0},  // 186
+    {1803, 0, 0, -1, 0, 0, 0},  // 187
+    {1803, 0, 0, -1, 0, 0, 0},  // 188
+    {1803, 0, 0, -1, 0, 0, 0},  // 189
+    {1803, 0, 0, -1, 0, 0, 0},  // 190
+    {1803, 0, 0, -1, 0, 0, 0},  // 191
+    {1803, 0, 0, -1, 0, 0, 0},  // 192
+    {1803, 0, 0, -1, 0, 0, 0},  // 193
+    {1803, 0, 0, -1, 0, 0, 0},  // 194
+    {1803, 0, 0, -1, 0, 0, 0},  // 195
+    {1803, 0, 0, -1, 0, 0, 0},  // 196
+    {1803, 0, 0, -1, 0, 0, 0},  // 197
+    {1803, 0, 0, -1, 0, 0, 0},  // 198
+    {1803, 0, 0, -1, 0, 0, 0},  // 199
+    {1803, 0, 0, -1, 0, 0, 0},  // 200
+    {1803, 0, 0, -1, 0, 0, 0},  // 201
+    {1803, 0, 0, -1, 0, 0, 0},  // 202
+    {1803, 0, 0, -1, 0, 0, 0},  // 203
+    {1803, 0, 0, -1, 0, 0, 0},  // 204
+    {1803, 0, 0, -1, 0, 0, 0},  // 205
+    {1803, 0, 0, -1, 0, 0, 0},  // 206
+    {1803, 0, 0, -1, 0, 0, 0},  // 207
+    {1803, 0, 0, -1, 0, 0, 0},  // 208
+    {1803, 0, 0, -1, 0, 0, 0},  // 209
+    {1803, 0, 0, -1, 0, 0, 0},  // 210
+    {1803, 0, 0, -1, 0, 0, 0},  // 211
+    {1803, 0, 0, -1, 0, 0, 0},  // 212
+    {1803, 0, 0, -1, 0, 0, 0},  // 213
+    {1803, 0, 0, -1, 0, 0, 0},  // 214
+    {1803, 0, 0, -1, 0, 0, 0},  // 215
+    {1803, 0, 0, -1, 0, 0, 0},  // 216
+    {1803, 0, 0, -1, 0, 0, 0},  // 217
+    {1803, 0, 0, -1, 0, 0, 0},  // 218
+    {1803, 0, 0, -1, 0, 0, 0},  // 219
+    {1803, 0, 0, -1, 0, 0, 0},  // 220
+    {1803, 0, 0, -1, 0, 0, 0},  // 221
+    {1803, 0, 0, -1, 0, 0, 0},  // 222
+    {1803, 0, 0, -1, 0, 0, 0},  // 223
+    {1803, 0, 0, -1, 0, 0, 0},  // 224
+    {1803, 0, 0, -1, 0, 0, 0},  // 225
+    {1803, 0, 0, -1, 0, 0, 0},  // 226
+    {1803, 0, 0, -1, 0, 0, 0},  // 227
+    {1803, 0, 0, -1, 0, 0, 0},  // 228
+    {1803, 0, 0, -1, 0, 0, 0},  // 229
+    {1803, 0, 0, -1, 0, 0, 0},  // 230
+    {1803, 0, 0, -1, 0, 0, 0},  // 231
+    {1803, 0, 0, -1, 0, 0, 0},  // 232
+    {1803, 0, 0, -1, 0, 0, 0},  // 233
+    {1803, 0, 0, -1, 0, 0, 0},  // 234
+    {1803, 0, 0, -1, 0, 0, 0},  // 235
+    {1803, 0, 0, -1, 0, 0, 0},  // 236
+    {1803, 0, 0, -1, 0, 0, 0},  // 237
+    {1803, 0, 0, -1, 0, 0, 0},  // 238
+    {1803, 0, 0, -1, 0, 0, 0},  // 239
+    {1803, 0, 0, -1, 0, 0, 0},  // 240
+    {1803, 0, 0, -1, 0, 0, 0},  // 241
+    {1803, 0, 0, -1, 0, 0, 0},  // 242
+    {1803, 0, 0, -1, 0, 0, 0},  // 243
+    {1803, 0, 0, -1, 0, 0, 0},  // 244
+    {1803, 0, 0, -1, 0, 0, 0},  // 245
+    {1803, 0, 0, -1, 0, 0, 0},  // 246
+    {1803, 0, 0, -1, 0, 0, 0},  // 247
+    {1803, 0, 0, -1, 0, 0, 0},  // 248
+    {1803, 0, 0, -1, 0, 0, 0},  // 249
+    {1803, 0, 0, -1, 0, 0, 0},  // 250
+    {1803, 0, 0, -1, 0, 0, 0},  // 251
+    {1803, 0, 0, -1, 0, 0, 0},  // 252
+    {1803, 0, 0, -1, 0, 0, 0},  // 253
+    {1803, 0, 0, -1, 0, 0, 0},  // 254
+    {1803, 0, 0, -1, 0, 0, 0},  // 255
+};
+
+static const EmbeddedKerning pairs[] = {
+    {5, 0x762e, -2},
+    {8, 0x4154, -3},
+    {21, 0x542c, -3},
+    {26, 0x5475, -3},
+    {41, 0x5741, -2},
+    {42, 0x4c76, -2},
+    {45, 0x4661, -2},
+    {65, 0x5441, -3},
+    {68, 0x5961, -3},
+    {74, 0x466f, -2},
+    {75, 0x572e, -2},
+    {80, 0x4177, -2},
+    {85, 0x4156, -3},
+    {90, 0x772c, -2},
+    {91, 0x5661, -2},
+    {97, 0x596f, -3},
+    {99, 0x542e, -3},
+    {120, 0x566f, -2},
+    {124, 0x4c57, -3},
+    {158, 0x4179, -2},
+    {166, 0x5472, -3},
+    {168, 0x772e, -2},
+    {180, 0x5479, -3},
+    {199, 0x4665, -2},
+    {201, 0x4c59, -3},
+    {222, 0x5965, -3},
+    {246, 0x5665, -2},
+    {254, 0x5761, -2},
+    {264, 0x4c54, -3},
+    {277, 0x5461, -3},
+    {283, 0x576f, -2},
+    {298, 0x4176, -2},
+    {300, 0x722c, -2},
+    {301, 0x462c, -3},
+    {306, 0x546f, -3},
+    {324, 0x592c, -3},
+    {328, 0x5975, -3},
+    {336, 0x4c77, -2},
+    {341, 0x4c56, -3},
+    {345, 0x4641, -2},
+    {347, 0x562c, -3},
+    {354, 0x5463, -3},
+    {367, 0x5941, -3},
+    {377, 0x722e, -2},
+    {378, 0x462e, -3},
+    {380, 0x4157, -3},
+    {391, 0x5641, -3},
+    {394, 0x502c, -3},
+    {401, 0x592e, -3},
+    {408, 0x5765, -2},
+    {413, 0x4c79, -2},
+    {416, 0x792c, -2},
+    {425, 0x562e, -3},
+    {432, 0x5465, -3},
+    {437, 0x5041, -2},
+    {439, 0x762c, -2},
+    {457, 0x4159, -3},
+    {461, 0x5473, -3},
+    {471, 0x502e, -3},
+    {493, 0x792e, -2},
+    {510, 0x572c, -2},
+};
+
+const EmbeddedFont builtinFont = {glyphs, movements, pairs, 61, 0x935170bbu, 23, 512, 0xce42d43e6762269eULL};
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "gcode.h"
+#include "checkpoint.h"
+
+// Function to hash a program (64-bit FNV-1a) so a checkpoint is only reused for the same program
+unsigned long long hashProgram(const char *program, size_t length) {
+    unsigned long long hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)program[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Function to open the checkpoint for a program and return the line it had reached
+long openCheckpoint(Checkpoint *checkpoint, const char *path, const char *program, size_t length) {
+    long savedLine = 0;
+
+    memset(checkpoint, 0, sizeof(*checkpoint));
+    snprintf(checkpoint->path, sizeof(checkpoint->path), "%s", path);
+    checkpoint->programHash = hashProgram(program, length);
+
+    checkpoint->file = fopen(path, "r+");
+    if (checkpoint->file) {
+        unsigned long long savedHash;
+        long line;
+        if (fscanf(checkpoint->file, "%llx %ld", &savedHash, &line) == 2 && savedHash == checkpoint->programHash && line > 0) {
+            savedLine = line;
+        }
+    } else {
+        checkpoint->file = fopen(path, "w");
+        if (!checkpoint->file) {
+            printf("Warning: Unable to create checkpoint %s, the job will not be resumable.\n", path);
+        }
+    }
+
+    checkpoint->lastWrite = time(NULL);
+    return savedLine;
+}
+
+// Function to overwrite the checkpoint record in place
+void flushCheckpoint(Checkpoint *checkpoint) {
+    if (!checkpoint->file || checkpoint->writtenLines == checkpoint->ackedLines) {
+        return;
+    }
+    rewind(checkpoint->file);
+    fprintf(checkpoint->file, "%016llx %12ld\n", checkpoint->programHash, checkpoint->ackedLines);  // Fixed width, so it never shrinks
+    fflush(checkpoint->file);
+    checkpoint->writtenLines = checkpoint->ackedLines;
+    checkpoint->lastWrite = time(NULL);
+}
+
+// Function to count an acknowledged line; the file is only touched once per batch
+void recordAck(Checkpoint *checkpoint) {
+    checkpoint->ackedLines++;
+    if (checkpoint->ackedLines - checkpoint->writtenLines >= CHECKPOINT_LINES ||
+        difftime(time(NULL), checkpoint->lastWrite) >= CHECKPOINT_SECONDS) {
+        flushCheckpoint(checkpoint);
+    }
+}
+
+// Function to take back acknowledged lines holding the given number of moves, which a controller reset threw away before they were drawn
+void rewindCheckpoint(Checkpoint *checkpoint, const char *program, size_t length, int moves) {
+    size_t end = findProgramLine(program, length, checkpoint->ackedLines);
+
+    // Walk back a line at a time; lines without motion (pen up/down) go back with the moves around them
+    while (moves > 0 && checkpoint->ackedLines > 0 && end > 0) {
+        size_t start = end - 1;
+        while (start > 0 && program[start - 1] != '\n') {
+            start--;
+        }
+        GCodeWords words;
+        parseGCodeLine(program + start, end - start, &words);
+        if (words.g == 0 || words.g == 1) {
+            moves--;
+        }
+        checkpoint->ackedLines--;
+        end = start;
+    }
+    flushCheckpoint(checkpoint);
+}
+
+// Function to close the checkpoint, removing it once the job has completed
+void closeCheckpoint(Checkpoint *checkpoint, int finished) {
+    if (!checkpoint->file) {
+        return;
+    }
+    if (!finished) {
+        flushCheckpoint(checkpoint);
+    }
+    fclose(checkpoint->file);
+    checkpoint->file = NULL;
+    if (finished) {
+        remove(checkpoint->path);
+    }
+}
+
+// Function to find where a line starts in a program
+size_t findProgramLine(const char *program, size_t length, long line) {
+    size_t offset = 0;
+    while (line > 0 && offset < length) {
+        const char *end = memchr(program + offset, '\n', length - offset);
+        if (!end) {
+            return length;
+        }
+        offset = (size_t)(end - program) + 1;
+        line--;
+    }
+    return offset;
+}
+
+// Function to build the commands that put the robot back where the program was at a given line, waiting for the pen as the program itself does
+void buildResumePreamble(const char *program, size_t length, long line, char *preamble, size_t size) {
+    double x = 0.0, y = 0.0, feed = 0.0, spindle = 0.0;
+    double lastS = 0.0, liftDwell = 0.0, penDwell = 0.0;
+    int penDown = 0;
+    size_t end = findProgramLine(program, length, line);
+
+    // Replay the modal state of every line already drawn, and pick up the job's servo dwells from the whole program
+    for (size_t offset = 0; offset < length; ) {
+        GCodeWords words;
+        int drawn = offset < end;
+        offset += parseGCodeLine(program + offset, length - offset, &words) + 1;
+        if (words.g == 4 && words.hasP) {
+            // A dwell waits for the S word before it
+            if (lastS > 0.0) {
+                penDwell = words.p;
+            } else {
+                liftDwell = words.p;
+            }
+        }
+        lastS = words.hasS ? words.s : lastS;
+        if (!drawn) {
+            continue;
+        }
+        x = words.hasX ? words.x : x;
+        y = words.hasY ? words.y : y;
+        feed = words.hasF ? words.f : feed;
+        if (words.hasS) {
+            spindle = words.s;
+            penDown = words.s > 0.0;
+        }
+    }
+
+    // Lift and let the pen clear the paper, travel there, then restore the feed rate and land the pen
+    int used = snprintf(preamble, size, "S0\n");
+    if (liftDwell > 0.0 && used > 0 && (size_t)used < size) {
+        used += snprintf(preamble + used, size - (size_t)used, "G4 P%g\n", liftDwell);
+    }
+    if (used > 0 && (size_t)used < size) {
+        used += snprintf(preamble + used, size - (size_t)used, "G0 X%g Y%g\n", x, y);
+    }
+    if (feed > 0.0 && used > 0 && (size_t)used < size) {
+        used += snprintf(preamble + used, size - (size_t)used, "F%g\n", feed);
+    }
+    if (penDown && used > 0 && (size_t)used < size) {
+        used += snprintf(preamble + used, size - (size_t)used, "S%g\n", spindle);
+        if (penDwell > 0.0 && used > 0 && (size_t)used < size) {
+            snprintf(preamble + used, size - (size_t)used, "G4 P%g\n", penDwell);
+        }
+    }
+}
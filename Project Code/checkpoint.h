@@ -0,0 +1,33 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <time.h>
+
+
+#ifndef CHECKPOINT_H_INCLUDED
+#define CHECKPOINT_H_INCLUDED
+
+
+#define CHECKPOINT_LINES 50         // Write the checkpoint at least every this many acknowledged lines
+#define CHECKPOINT_SECONDS 2        // ... or this often, whichever comes first
+
+// On-disk record of how far a program got, so a failed run can carry on where it stopped
+typedef struct {
+    FILE *file;                     // Checkpoint file, kept open between writes
+    char path[512];
+    unsigned long long programHash; // Identifies the program the checkpoint belongs to
+    long resumeLine;                // Line to start from when the job is sent (0 = from the top)
+    long ackedLines;                // Lines acknowledged by the robot so far
+    long writtenLines;              // Value of ackedLines last written to disk
+    time_t lastWrite;
+} Checkpoint;
+
+unsigned long long hashProgram(const char *program, size_t length);  // 64-bit FNV-1a, also used to check packed programs
+long openCheckpoint(Checkpoint *checkpoint, const char *path, const char *program, size_t length);  // Returns the saved line, 0 if none
+void recordAck(Checkpoint *checkpoint);          // Count one acknowledged line, writing to disk in batches
+void flushCheckpoint(Checkpoint *checkpoint);    // Force the current position to disk
+void rewindCheckpoint(Checkpoint *checkpoint, const char *program, size_t length, int moves);  // Un-acknowledge lines the controller dropped
+void closeCheckpoint(Checkpoint *checkpoint, int finished);  // finished = 1 removes the file
+size_t findProgramLine(const char *program, size_t length, long line);   // Byte offset of a line
+void buildResumePreamble(const char *program, size_t length, long line, char *preamble, size_t size);
+
+#endif // CHECKPOINT_H_INCLUDED
@@ -0,0 +1,303 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <pthread.h>
+
+#include "control.h"
+#include "serial.h"
+#include "status.h"
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <errno.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#endif
+
+// Requests waiting for the control thread; set from signal handlers, so nothing fancier than flags
+static volatile sig_atomic_t holdPending = 0;
+static volatile sig_atomic_t resumePending = 0;
+static volatile sig_atomic_t resetPending = 0;
+
+// A reset that has gone out, and how much of the job the controller threw away with it
+static pthread_mutex_t resetLock = PTHREAD_MUTEX_INITIALIZER;
+static int resetSent = 0;
+static int resetQueuedMoves = 0;
+
+// Background thread passing requests on to the controller
+static pthread_t controlThread;
+static volatile int controlRunning = 0;
+static int listenSocket = -1;
+static char listenPath[108];
+
+// Function to queue a real-time command; only touches flags so a signal handler can call it
+void requestRealtime(char command) {
+    if (command == REALTIME_FEED_HOLD) {
+        holdPending = 1;
+    } else if (command == REALTIME_CYCLE_START) {
+        resumePending = 1;
+    } else if (command == REALTIME_SOFT_RESET) {
+        resetPending = 1;
+    }
+}
+
+// Function to check whether a reset has been sent, and consume it
+int takeResetRequest(int *queuedMoves) {
+    pthread_mutex_lock(&resetLock);
+    int sent = resetSent;
+    if (sent && queuedMoves) {
+        *queuedMoves = resetQueuedMoves;
+    }
+    resetSent = 0;
+    pthread_mutex_unlock(&resetLock);
+    return sent;
+}
+
+// Function to send the pending requests, reset first since it makes the others pointless
+static void sendPendingRequests(void) {
+    if (resetPending) {
+        resetPending = 0;
+        holdPending = 0;
+        resumePending = 0;
+
+        // Everything still in the planner is lost with the reset; note how much from the last report
+        MachineStatus status;
+        getMachineStatus(&status);
+        pthread_mutex_lock(&resetLock);
+        resetQueuedMoves = status.plannerFree >= 0 && status.plannerFree <= PLANNER_BLOCKS ? PLANNER_BLOCKS - status.plannerFree : PLANNER_BLOCKS;
+        resetSent = 1;
+        pthread_mutex_unlock(&resetLock);
+
+        printf("\nOperator reset: stopping the job\n");
+        SendRealtimeByte(REALTIME_SOFT_RESET);
+        return;
+    }
+    if (holdPending) {
+        holdPending = 0;
+        printf("\nOperator feed hold\n");
+        SendRealtimeByte(REALTIME_FEED_HOLD);
+    }
+    if (resumePending) {
+        resumePending = 0;
+        printf("\nOperator resume\n");
+        SendRealtimeByte(REALTIME_CYCLE_START);
+    }
+}
+
+#if defined(__linux__) || defined(__FreeBSD__)
+
+// Signal handler mapping signals onto real-time commands
+static void controlSignal(int signalNumber) {
+    if (signalNumber == SIGUSR1) {
+        requestRealtime(REALTIME_FEED_HOLD);
+    } else if (signalNumber == SIGUSR2) {
+        requestRealtime(REALTIME_CYCLE_START);
+    } else {
+        requestRealtime(REALTIME_SOFT_RESET);
+    }
+}
+
+// Function to install the signal handlers; Ctrl-C and TERM only get one go so a second one still kills the process
+static void installSignals(void) {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = controlSignal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGUSR1, &action, NULL);
+    sigaction(SIGUSR2, &action, NULL);
+    action.sa_flags = SA_RESTART | SA_RESETHAND;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+}
+
+// Function to put back the default signal handling
+static void restoreSignals(void) {
+    signal(SIGUSR1, SIG_DFL);
+    signal(SIGUSR2, SIG_DFL);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+}
+
+// Function to open the local control socket
+static int openControlSocket(const char *path) {
+    struct sockaddr_un address;
+
+    if (strlen(path) >= sizeof(address.sun_path)) {
+        printf("Error: Control socket path is too long: %s\n", path);
+        return -1;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+
+    listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenSocket == -1) {
+        printf("Error: Unable to create the control socket\n");
+        return -1;
+    }
+    unlink(path);  // Left behind by a run that was killed
+    if (bind(listenSocket, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(listenSocket, 4) != 0) {
+        printf("Error: Unable to listen on the control socket %s\n", path);
+        close(listenSocket);
+        listenSocket = -1;
+        return -1;
+    }
+    strcpy(listenPath, path);
+    printf("Taking hold/resume/reset/status commands on %s\n", path);
+    return 0;
+}
+
+// Function to write the machine state to a control client as one line of JSON
+static void sendStatusReply(int client) {
+    char reply[256];
+    MachineStatus status;
+    getMachineStatus(&status);
+    int length = snprintf(reply, sizeof(reply), "{\"state\":\"%s\",\"x\":%.3f,\"y\":%.3f,\"feed\":%.0f,\"planner_free\":%d,\"reports\":%ld}\n",
+                          machineStateName(status.state), status.x, status.y, status.feed, status.plannerFree, status.reports);
+    if (write(client, reply, (size_t)length) < 0) {
+        return;  // The client has gone, nothing to do
+    }
+}
+
+// Function to read the commands from one control client, one per line, and answer each
+static void serveControlClient(int client) {
+    char buffer[256];
+    int length = 0;
+    struct timeval timeout = {0, 200000};  // A client that goes quiet must not hold up the next request
+
+    setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    while (length < (int)sizeof(buffer) - 1) {
+        ssize_t n = read(client, buffer + length, sizeof(buffer) - 1 - (size_t)length);
+        if (n <= 0) {
+            break;
+        }
+        length += (int)n;
+        buffer[length] = '\0';
+
+        char *end;
+        while ((end = strchr(buffer, '\n')) != NULL) {
+            *end = '\0';
+            if (end > buffer && end[-1] == '\r') {
+                end[-1] = '\0';
+            }
+            const char *reply = "ok\n";
+            if (strcmp(buffer, "hold") == 0) {
+                requestRealtime(REALTIME_FEED_HOLD);
+            } else if (strcmp(buffer, "resume") == 0) {
+                requestRealtime(REALTIME_CYCLE_START);
+            } else if (strcmp(buffer, "reset") == 0) {
+                requestRealtime(REALTIME_SOFT_RESET);
+            } else if (strcmp(buffer, "status") == 0) {
+                sendStatusReply(client);
+                reply = NULL;
+            } else {
+                reply = "error: unknown command\n";
+            }
+            if (reply && write(client, reply, strlen(reply)) < 0) {
+                return;
+            }
+            sendPendingRequests();  // Don't wait for the next tick
+            length -= (int)(end + 1 - buffer);
+            memmove(buffer, end + 1, (size_t)length + 1);
+        }
+    }
+}
+
+// Function to wait up to one tick for a control client
+static void waitForControlClient(void) {
+    if (listenSocket == -1) {
+        Sleep(CONTROL_POLL_MS);
+        return;
+    }
+    struct pollfd waiting = {listenSocket, POLLIN, 0};
+    if (poll(&waiting, 1, CONTROL_POLL_MS) > 0) {
+        int client = accept(listenSocket, NULL, NULL);
+        if (client != -1) {
+            serveControlClient(client);
+            close(client);
+        }
+    }
+}
+
+// Function to close the control socket and remove its file
+static void closeControlSocket(void) {
+    if (listenSocket != -1) {
+        close(listenSocket);
+        unlink(listenPath);
+        listenSocket = -1;
+    }
+}
+
+#else
+
+// Windows only has Ctrl-C, which becomes a soft reset
+static void controlSignal(int signalNumber) {
+    (void)signalNumber;
+    requestRealtime(REALTIME_SOFT_RESET);
+}
+
+static void installSignals(void) {
+    signal(SIGINT, controlSignal);
+}
+
+static void restoreSignals(void) {
+    signal(SIGINT, SIG_DFL);
+}
+
+static int openControlSocket(const char *path) {
+    printf("Warning: The control socket %s is not available on this platform, only Ctrl-C is.\n", path);
+    return 0;
+}
+
+static void waitForControlClient(void) {
+    Sleep(CONTROL_POLL_MS);
+}
+
+static void closeControlSocket(void) {
+}
+
+#endif
+
+// Thread function passing requests on as they come in
+static void *controlLoop(void *arg) {
+    (void)arg;
+    while (controlRunning) {
+        sendPendingRequests();
+        waitForControlClient();
+    }
+    return NULL;
+}
+
+// Function to start taking operator requests from signals and, if a path is given, the control socket
+int startControl(const char *socketPath) {
+    if (controlRunning) {
+        return 0;
+    }
+    if (socketPath && openControlSocket(socketPath) != 0) {
+        return -1;
+    }
+    installSignals();
+    controlRunning = 1;
+    if (pthread_create(&controlThread, NULL, controlLoop, NULL) != 0) {
+        controlRunning = 0;
+        restoreSignals();
+        closeControlSocket();
+        printf("Warning: Unable to start the operator control thread.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to stop taking requests
+void stopControl(void) {
+    if (!controlRunning) {
+        return;
+    }
+    controlRunning = 0;
+    pthread_join(controlThread, NULL);
+    restoreSignals();
+    closeControlSocket();
+}
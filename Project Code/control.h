@@ -0,0 +1,36 @@
+#include <stdio.h>
+
+
+#ifndef CONTROL_H_INCLUDED
+#define CONTROL_H_INCLUDED
+
+
+#define CONTROL_POLL_MS 20          // Longest a request waits before its byte is sent
+#define PLANNER_BLOCKS 15           // GRBL's planner size; assumed full when the status reports don't say
+
+// GRBL real-time command bytes; they jump the queue of lines already sent
+#define REALTIME_FEED_HOLD '!'
+#define REALTIME_CYCLE_START '~'
+#define REALTIME_SOFT_RESET 0x18
+
+/*
+ Operators can pause, resume or abort a running job without killing the
+ process. On Linux and FreeBSD:
+
+     kill -USR1 <pid>    feed hold (the robot decelerates and waits)
+     kill -USR2 <pid>    cycle start (carry on after a hold)
+     Ctrl-C or kill      soft reset: the job stops, the pen is lifted and parked,
+                         and the checkpoint is kept for a resume. A second
+                         Ctrl-C kills the process outright.
+
+ With --control <path> the same commands can be written, one per line, to a
+ local socket: "hold", "resume", "reset" or "status" (which replies with the
+ machine state as JSON), e.g.  echo hold | nc -U robot.sock
+*/
+
+int startControl(const char *socketPath);       // Start taking requests; socketPath may be NULL for signals only
+void stopControl(void);
+void requestRealtime(char command);             // Queue a real-time byte, safe to call from a signal handler
+int takeResetRequest(int *queuedMoves);         // 1 if a reset was sent since the last call, with the moves the controller still held
+
+#endif // CONTROL_H_INCLUDED
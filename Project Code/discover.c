@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "discover.h"
+#include "rs232.h"
+#include "serial.h"
+#include "stats.h"
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <dirent.h>
+#endif
+
+// Rates tried when none is given, most likely first
+static const int probeRates[] = {115200, 250000, 230400, 57600, 38400, 19200, 9600};
+
+// One device being probed by its own thread
+typedef struct {
+    char device[64];
+    int comportNumber;       // Slot in the rs232 port table
+    const int *rates;
+    int numRates;
+    int foundBaudrate;       // Rate the robot answered at, 0 if it did not
+} PortProbe;
+
+// The probe that found a robot first; the others give up once this is set
+static pthread_mutex_t winnerLock = PTHREAD_MUTEX_INITIALIZER;
+static PortProbe *winner = NULL;
+
+// Function to check whether another probe has already found a robot
+static int probeBeaten(PortProbe *probe) {
+    pthread_mutex_lock(&winnerLock);
+    int beaten = winner != NULL && winner != probe;
+    pthread_mutex_unlock(&winnerLock);
+    return beaten;
+}
+
+// Function to listen on an open port for up to waitMs; returns 1 if it sounds like GRBL
+static int listenForGrbl(PortProbe *probe, int waitMs) {
+    char received[256];
+    int length = 0;
+    long long start = getMonotonicMicros();
+    long long lastWake = 0;
+
+    while ((getMonotonicMicros() - start) / 1000 < waitMs && !probeBeaten(probe)) {
+        // An empty line gets "ok" from a GRBL that is already running
+        long long now = getMonotonicMicros();
+        if (lastWake == 0 || (now - lastWake) / 1000 >= PROBE_WAKE_MS) {
+            RS232_cputs(probe->comportNumber, "\r\n");
+            lastWake = now;
+        }
+
+        int n = RS232_PollComport(probe->comportNumber, (unsigned char *)received + length, (int)sizeof(received) - 1 - length);
+        if (n > 0) {
+            length += n;
+            received[length] = '\0';
+            // Garbage at the wrong rate may contain NULs; look past them
+            for (int i = 0; i < length; i++) {
+                if (strncmp(received + i, "Grbl", 4) == 0 || strncmp(received + i, "ok\r\n", 4) == 0) {
+                    return 1;
+                }
+            }
+            if (length > (int)sizeof(received) / 2) {
+                memmove(received, received + length - 8, 8);  // Keep the tail, a reply may straddle the cut
+                length = 8;
+            }
+        } else {
+            Sleep(20);
+        }
+    }
+    return 0;
+}
+
+// Thread function opening one device and trying each baud rate on it
+static void *probePort(void *arg) {
+    PortProbe *probe = arg;
+    char mode[] = {'8', 'N', '1', 0};
+
+    if (RS232_OpenDevice(probe->comportNumber, probe->device, probe->rates[0], mode)) {
+        return NULL;  // Missing, busy or not a serial port
+    }
+
+    // Changing the rate on the open port leaves DTR alone, so the board only resets once
+    for (int i = 0; i < probe->numRates && !probeBeaten(probe); i++) {
+        if (i > 0 && RS232_SetBaudrate(probe->comportNumber, probe->rates[i])) {
+            continue;
+        }
+        RS232_flushRX(probe->comportNumber);
+        if (listenForGrbl(probe, i == 0 ? PROBE_BOOT_MS : PROBE_RATE_MS)) {
+            pthread_mutex_lock(&winnerLock);
+            if (!winner) {
+                winner = probe;
+                probe->foundBaudrate = probe->rates[i];
+            }
+            pthread_mutex_unlock(&winnerLock);
+            break;
+        }
+    }
+
+    if (probe->foundBaudrate == 0) {
+        RS232_CloseComport(probe->comportNumber);
+    }
+    return NULL;
+}
+
+#if defined(__linux__) || defined(__FreeBSD__)
+
+// Device name prefixes worth probing, in the order they are tried
+static const char *devicePrefixes[] = {"ttyUSB", "ttyACM", "cuaU", "ttyAMA", "rfcomm", "cuau", "ttyS"};
+#define NUM_DEVICE_PREFIXES (int)(sizeof(devicePrefixes) / sizeof(devicePrefixes[0]))
+
+// Function to give a device name its place in the probing order, -1 if it is not a serial port
+static int deviceRank(const char *name) {
+    for (int i = 0; i < NUM_DEVICE_PREFIXES; i++) {
+        size_t prefix = strlen(devicePrefixes[i]);
+        // Just the prefix and a number, which skips FreeBSD's .init and .lock devices
+        if (strncmp(name, devicePrefixes[i], prefix) == 0 && name[prefix] != '\0' && strspn(name + prefix, "0123456789") == strlen(name + prefix)) {
+            return i * 1000 + atoi(name + prefix);
+        }
+    }
+    return -1;
+}
+
+// Function to order probes by their device rank
+static int compareProbes(const void *a, const void *b) {
+    int rankA = deviceRank(((const PortProbe *)a)->device + 5);
+    int rankB = deviceRank(((const PortProbe *)b)->device + 5);
+    return rankA - rankB;
+}
+
+// Function to list the serial devices worth probing
+static int listCandidatePorts(PortProbe *probes, int maxProbes) {
+    PortProbe found[256];
+    int numFound = 0;
+    DIR *dir = opendir("/dev");
+    struct dirent *entry;
+
+    if (!dir) {
+        return 0;
+    }
+    while ((entry = readdir(dir)) != NULL && numFound < (int)(sizeof(found) / sizeof(found[0]))) {
+        if (deviceRank(entry->d_name) >= 0 && strlen(entry->d_name) < sizeof(found[0].device) - 5) {
+            snprintf(found[numFound++].device, sizeof(found[0].device), "/dev/%s", entry->d_name);
+        }
+    }
+    closedir(dir);
+
+    // USB adapters first: on a PC most ttyS ports are there whether or not anything is plugged in
+    qsort(found, (size_t)numFound, sizeof(PortProbe), compareProbes);
+    if (numFound > maxProbes) {
+        numFound = maxProbes;
+    }
+    memcpy(probes, found, (size_t)numFound * sizeof(PortProbe));
+    return numFound;
+}
+
+#else
+
+// Function to list the serial devices worth probing; opening a missing COM port fails straight away
+static int listCandidatePorts(PortProbe *probes, int maxProbes) {
+    for (int i = 0; i < maxProbes; i++) {
+        snprintf(probes[i].device, sizeof(probes[i].device), "COM%d", i + 1);
+    }
+    return maxProbes;
+}
+
+#endif
+
+// Function to probe every likely serial device at once and keep the first robot that answers
+int discoverRobot(int baudrate, int *comportNumber, char *device, size_t size, int *foundBaudrate) {
+    PortProbe probes[DISCOVER_MAX_PORTS];
+    pthread_t threads[DISCOVER_MAX_PORTS];
+    int started[DISCOVER_MAX_PORTS];
+
+    memset(probes, 0, sizeof(probes));
+    int numProbes = listCandidatePorts(probes, DISCOVER_MAX_PORTS);
+    if (numProbes == 0) {
+        printf("Error: No serial devices found to look for the robot on\n");
+        return -1;
+    }
+
+    printf("Looking for the robot on %d serial device%s\n", numProbes, numProbes == 1 ? "" : "s");
+    long long start = getMonotonicMicros();
+    winner = NULL;
+    for (int i = 0; i < numProbes; i++) {
+        probes[i].comportNumber = i;
+        probes[i].rates = baudrate > 0 ? &baudrate : probeRates;
+        probes[i].numRates = baudrate > 0 ? 1 : (int)(sizeof(probeRates) / sizeof(probeRates[0]));
+        started[i] = pthread_create(&threads[i], NULL, probePort, &probes[i]) == 0;
+        if (!started[i]) {
+            probePort(&probes[i]);  // Out of threads: probe this one here instead
+        }
+    }
+    for (int i = 0; i < numProbes; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    if (!winner) {
+        printf("Error: No robot answered on any serial device\n");
+        return -1;
+    }
+
+    // Let the replies to the last wake-ups arrive and throw them away, so the first command gets its own "ok"
+    Sleep(50);
+    RS232_flushRX(winner->comportNumber);
+
+    *comportNumber = winner->comportNumber;
+    *foundBaudrate = winner->foundBaudrate;
+    snprintf(device, size, "%s", winner->device);
+    printf("Found the robot on %s at %d baud in %.2fs\n", winner->device, winner->foundBaudrate,
+           (double)(getMonotonicMicros() - start) / 1e6);
+    return 0;
+}
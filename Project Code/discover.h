@@ -0,0 +1,29 @@
+#include <stdio.h>
+
+
+#ifndef DISCOVER_H_INCLUDED
+#define DISCOVER_H_INCLUDED
+
+
+#define DISCOVER_MAX_PORTS 16       // Devices probed at once, each on its own comport number
+#define PROBE_BOOT_MS 1500          // Opening the port resets an Arduino; its bootloader takes about a second
+#define PROBE_RATE_MS 250           // Wait at each further baud rate, the board is already running by then
+#define PROBE_WAKE_MS 100           // How often the probe asks for an "ok"
+
+/*
+ With --port auto every likely serial device is opened at once and asked for
+ GRBL's start-up banner or an "ok":
+
+     Linux      /dev/ttyUSB*, /dev/ttyACM*, /dev/ttyAMA*, /dev/rfcomm*, /dev/ttyS*
+     FreeBSD    /dev/cuaU*, /dev/cuau*
+     Windows    COM1 to COM16
+
+ The first robot to answer is kept open and the rest are closed again. Ports
+ are locked while open, so several copies of the program started together
+ each end up with a different robot. Without --baud the common GRBL rates are
+ tried in turn on each device.
+*/
+
+int discoverRobot(int baudrate, int *comportNumber, char *device, size_t size, int *foundBaudrate);  // baudrate 0 to try them all; 0 with the port left open, -1 if none answered
+
+#endif // DISCOVER_H_INCLUDED
@@ -0,0 +1,310 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "estimate.h"
+
+// One straight move, as seen by the planner
+typedef struct {
+    double length;       // mm
+    double ux, uy;       // Unit direction
+    double nominal;      // Target speed in mm/s
+    double maxEntry;     // Fastest speed allowed at the start of the move
+    double entry;        // Planned speed at the start of the move
+    int rapid;           // 1 = G0, 0 = G1
+    int fromRest;        // 1 if the machine is stopped before this move (pen change, dwell)
+} PlannedMove;
+
+// Function to fill in a model matching the stock robot and the current transport
+void defaultEstimatorModel(EstimatorModel *model) {
+    model->feedRate = 1000.0f;
+    model->rapidRate = 3000.0f;
+    model->acceleration = 200.0f;
+    model->junctionDeviation = 0.01f;
+    model->penDownTime = 0.15f;
+    model->penUpTime = 0.15f;
+    model->lineOverhead = 0.105f;  // SendCommands() sleeps 100 ms after every ack
+    model->motionScale = 1.0f;
+}
+
+// Function to load a tuned model; unknown keys are ignored so old files keep working
+int loadEstimatorModel(const char *filename, EstimatorModel *model) {
+    FILE *file = fopen(filename, "r");
+    char line[256];
+    if (!file) {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), file)) {
+        char key[64];
+        float value;
+        if (line[0] == '#' || sscanf(line, "%63s %f", key, &value) != 2) {
+            continue;
+        }
+        if (strcmp(key, "feedRate") == 0) model->feedRate = value;
+        else if (strcmp(key, "rapidRate") == 0) model->rapidRate = value;
+        else if (strcmp(key, "acceleration") == 0) model->acceleration = value;
+        else if (strcmp(key, "junctionDeviation") == 0) model->junctionDeviation = value;
+        else if (strcmp(key, "penDownTime") == 0) model->penDownTime = value;
+        else if (strcmp(key, "penUpTime") == 0) model->penUpTime = value;
+        else if (strcmp(key, "lineOverhead") == 0) model->lineOverhead = value;
+        else if (strcmp(key, "motionScale") == 0) model->motionScale = value;
+    }
+
+    fclose(file);
+    return 0;
+}
+
+// Function to write a model in the format read by loadEstimatorModel()
+int saveEstimatorModel(const char *filename, const EstimatorModel *model) {
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        printf("Error opening file: %s\n", filename);
+        return -1;
+    }
+    fprintf(file, "# Job time model, see estimate.h\n");
+    fprintf(file, "feedRate %g\n", model->feedRate);
+    fprintf(file, "rapidRate %g\n", model->rapidRate);
+    fprintf(file, "acceleration %g\n", model->acceleration);
+    fprintf(file, "junctionDeviation %g\n", model->junctionDeviation);
+    fprintf(file, "penDownTime %g\n", model->penDownTime);
+    fprintf(file, "penUpTime %g\n", model->penUpTime);
+    fprintf(file, "lineOverhead %g\n", model->lineOverhead);
+    fprintf(file, "motionScale %g\n", model->motionScale);
+    fclose(file);
+    return 0;
+}
+
+// Function to find the fastest speed GRBL allows through the corner between two moves
+static double junctionSpeed(const PlannedMove *previous, const PlannedMove *next, const EstimatorModel *model) {
+    double cosTheta = -(previous->ux * next->ux + previous->uy * next->uy);
+    double limit = previous->nominal < next->nominal ? previous->nominal : next->nominal;
+
+    if (cosTheta > 0.999999) {
+        return 0.0;  // Full reversal
+    }
+    if (cosTheta < -0.999999) {
+        return limit;  // Straight on
+    }
+    double sinHalf = sqrt(0.5 * (1.0 - cosTheta));
+    double speed = sqrt(model->acceleration * model->junctionDeviation * sinHalf / (1.0 - sinHalf));
+    return speed < limit ? speed : limit;
+}
+
+// Function to work out the time for one trapezoidal (or triangular) velocity profile
+static double moveTime(double length, double entry, double exit, double nominal, double accel) {
+    double accelDistance = (nominal * nominal - entry * entry) / (2.0 * accel);
+    double decelDistance = (nominal * nominal - exit * exit) / (2.0 * accel);
+
+    if (accelDistance + decelDistance <= length) {
+        return (nominal - entry) / accel + (nominal - exit) / accel + (length - accelDistance - decelDistance) / nominal;
+    }
+    double peak = sqrt((2.0 * accel * length + entry * entry + exit * exit) / 2.0);
+    return (peak - entry) / accel + (peak - exit) / accel;
+}
+
+// Function to plan the moves with a backward and forward pass and add up their times
+static void planMoves(PlannedMove *moves, int numMoves, const EstimatorModel *model, JobEstimate *estimate) {
+    double accel = model->acceleration;
+
+    // Backward pass: every move must be able to slow down for the next one
+    double nextEntry = 0.0;
+    for (int i = numMoves - 1; i >= 0; i--) {
+        double reachable = sqrt(nextEntry * nextEntry + 2.0 * accel * moves[i].length);
+        moves[i].entry = moves[i].maxEntry < reachable ? moves[i].maxEntry : reachable;
+        nextEntry = moves[i].fromRest ? 0.0 : moves[i].entry;
+    }
+
+    // Forward pass: every move must be able to reach its entry speed from the previous one
+    for (int i = 0; i < numMoves; i++) {
+        if (moves[i].fromRest) {
+            moves[i].entry = 0.0;
+        } else if (i > 0) {
+            double reachable = sqrt(moves[i - 1].entry * moves[i - 1].entry + 2.0 * accel * moves[i - 1].length);
+            if (moves[i].entry > reachable) {
+                moves[i].entry = reachable;
+            }
+        }
+    }
+
+    for (int i = 0; i < numMoves; i++) {
+        if (moves[i].length <= 0.0) {
+            continue;
+        }
+        double exit = (i + 1 < numMoves && !moves[i + 1].fromRest) ? moves[i + 1].entry : 0.0;
+        double seconds = moveTime(moves[i].length, moves[i].entry, exit, moves[i].nominal, accel) * model->motionScale;
+        if (moves[i].rapid) {
+            estimate->travelTime += seconds;
+            estimate->travelDistance += moves[i].length;
+        } else {
+            estimate->drawTime += seconds;
+            estimate->drawDistance += moves[i].length;
+        }
+    }
+}
+
+// Function to predict how long a G-code program will take on the robot
+void estimateProgram(const char *program, size_t length, const EstimatorModel *model, Arena *arena, JobEstimate *estimate) {
+    memset(estimate, 0, sizeof(*estimate));
+
+    // The move list is scratch: in a job arena it is given back as soon as the estimate is done
+    ArenaMark mark = arena ? arenaMark(arena) : (ArenaMark){NULL, 0, NULL};
+    int capacity = 1024;
+    int numMoves = 0;
+    PlannedMove *moves = arena ? arenaAlloc(arena, (size_t)capacity * sizeof(PlannedMove)) : malloc((size_t)capacity * sizeof(PlannedMove));
+    if (!moves) {
+        return;
+    }
+
+    double x = 0.0, y = 0.0;
+    double feedRate = model->feedRate;
+    int stopped = 1;  // The first move always starts from rest
+    size_t start = 0;
+
+    while (start < length) {
+        GCodeWords words;
+        size_t lineLength = parseGCodeLine(program + start, length - start, &words);
+        start += lineLength + 1;
+
+        // Pick out the words we care about
+        int g = words.g, m = words.m, hasX = words.hasX, hasY = words.hasY, hasS = words.hasS;
+        double newX = hasX ? words.x : x, newY = hasY ? words.y : y, s = words.s, p = words.p;
+        if (words.hasF) {
+            feedRate = words.f;
+        }
+        if (lineLength == 0) {
+            continue;
+        }
+        estimate->lines++;
+
+        if (hasS) {
+            estimate->penChanges++;
+            estimate->penTime += s > 0.0 ? model->penDownTime : model->penUpTime;
+            stopped = 1;  // Spindle changes are synchronous, the planner drains first
+        }
+        if (g == 4) {
+            estimate->dwellTime += p;
+            stopped = 1;
+        }
+        if (m == 0) {
+            estimate->pauses++;
+            stopped = 1;
+        }
+        if ((g == 0 || g == 1) && (hasX || hasY)) {
+            if (numMoves == capacity) {
+                size_t oldSize = (size_t)capacity * sizeof(PlannedMove);
+                capacity *= 2;
+                PlannedMove *bigger = arena ? arenaResize(arena, moves, oldSize, (size_t)capacity * sizeof(PlannedMove))
+                                            : realloc(moves, (size_t)capacity * sizeof(PlannedMove));
+                if (!bigger) {
+                    break;
+                }
+                moves = bigger;
+            }
+            PlannedMove *move = &moves[numMoves];
+            double dx = newX - x, dy = newY - y;
+            move->length = sqrt(dx * dx + dy * dy);
+            if (move->length <= 0.0) {
+                continue;  // GRBL drops zero-length moves from the planner
+            }
+            move->ux = dx / move->length;
+            move->uy = dy / move->length;
+            move->rapid = (g == 0);
+            move->nominal = (move->rapid ? model->rapidRate : feedRate) / 60.0;
+            move->fromRest = stopped;
+            move->maxEntry = stopped || numMoves == 0 ? 0.0 : junctionSpeed(&moves[numMoves - 1], move, model);
+            numMoves++;
+            stopped = 0;
+            x = newX;
+            y = newY;
+        }
+    }
+
+    planMoves(moves, numMoves, model, estimate);
+    if (arena) {
+        arenaRewind(arena, mark);
+    } else {
+        free(moves);
+    }
+
+    estimate->linkTime = (double)estimate->lines * model->lineOverhead;
+    estimate->totalTime = estimate->drawTime + estimate->travelTime + estimate->penTime + estimate->dwellTime + estimate->linkTime;
+}
+
+// Function to fit the motion scale, pen settle time and per-line overhead to measured run times
+int calibrateEstimator(const JobEstimate *runs, const double *measured, int numRuns, EstimatorModel *model) {
+    double normal[3][4] = {{0}};  // Normal equations, augmented with the right-hand side
+
+    if (numRuns < 3) {
+        printf("Error: Calibration needs at least 3 timed runs.\n");
+        return -1;
+    }
+
+    for (int r = 0; r < numRuns; r++) {
+        double features[3];
+        features[0] = (runs[r].drawTime + runs[r].travelTime) / model->motionScale;  // Unscaled planned motion
+        features[1] = (double)runs[r].penChanges;
+        features[2] = (double)runs[r].lines;
+        double target = measured[r] - runs[r].dwellTime;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                normal[i][j] += features[i] * features[j];
+            }
+            normal[i][3] += features[i] * target;
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+    for (int col = 0; col < 3; col++) {
+        int pivot = col;
+        for (int row = col + 1; row < 3; row++) {
+            if (fabs(normal[row][col]) > fabs(normal[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (fabs(normal[pivot][col]) < 1e-12) {
+            printf("Error: Calibration runs are too similar to separate the model terms.\n");
+            return -1;
+        }
+        for (int k = 0; k < 4; k++) {
+            double swap = normal[col][k];
+            normal[col][k] = normal[pivot][k];
+            normal[pivot][k] = swap;
+        }
+        for (int row = 0; row < 3; row++) {
+            if (row != col) {
+                double factor = normal[row][col] / normal[col][col];
+                for (int k = col; k < 4; k++) {
+                    normal[row][k] -= factor * normal[col][k];
+                }
+            }
+        }
+    }
+
+    double motionScale = normal[0][3] / normal[0][0];
+    double penTime = normal[1][3] / normal[1][1];
+    double lineOverhead = normal[2][3] / normal[2][2];
+    if (motionScale <= 0.0 || penTime < 0.0 || lineOverhead < 0.0) {
+        printf("Error: Calibration produced a negative term, check the measured times.\n");
+        return -1;
+    }
+
+    model->motionScale = (float)motionScale;
+    model->penDownTime = (float)penTime;
+    model->penUpTime = (float)penTime;
+    model->lineOverhead = (float)lineOverhead;
+    return 0;
+}
+
+// Function to print a job estimate for the operator
+void printEstimate(const JobEstimate *estimate) {
+    int seconds = (int)(estimate->totalTime + 0.5);
+    printf("Estimated job time: %dh %02dm %02ds (%ld lines, %ld pen changes", seconds / 3600, (seconds / 60) % 60, seconds % 60, estimate->lines, estimate->penChanges);
+    if (estimate->pauses > 0) {
+        printf(", %ld page changes", estimate->pauses);
+    }
+    printf(")\n");
+    printf("  drawing %.1fs over %.0fmm, travel %.1fs over %.0fmm, pen %.1fs, link %.1fs\n",
+           estimate->drawTime, estimate->drawDistance, estimate->travelTime, estimate->travelDistance, estimate->penTime, estimate->linkTime);
+}
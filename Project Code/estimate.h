@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include "gcode.h"
+
+
+#ifndef ESTIMATE_H_INCLUDED
+#define ESTIMATE_H_INCLUDED
+
+
+#define ESTIMATOR_FILE "estimator.cfg"   // Tuned model, written by --calibrate
+
+// Machine model used to predict how long a program takes to draw
+typedef struct {
+    float feedRate;           // G1 feed rate in mm/min until the program sets F
+    float rapidRate;          // G0 rapid rate in mm/min ($110/$111 on the controller)
+    float acceleration;       // Acceleration in mm/s^2 ($120/$121)
+    float junctionDeviation;  // GRBL junction deviation in mm ($11)
+    float penDownTime;        // Servo settle time after S1000, in seconds
+    float penUpTime;          // Servo settle time after S0, in seconds
+    float lineOverhead;       // Round trip per line on the serial link, in seconds
+    float motionScale;        // Calibration factor applied to the planned motion time
+} EstimatorModel;
+
+// Breakdown of a predicted job time
+typedef struct {
+    double drawTime;          // Seconds spent on G1 moves
+    double travelTime;        // Seconds spent on G0 moves
+    double penTime;           // Seconds spent waiting on the pen servo
+    double dwellTime;         // Seconds spent in G4 dwells
+    double linkTime;          // Seconds spent on serial round trips
+    double totalTime;         // Predicted wall-clock time for the job
+    double drawDistance;      // mm drawn with the pen down
+    double travelDistance;    // mm travelled with the pen up
+    long lines;               // Number of commands in the program
+    long penChanges;          // Number of pen up/down commands
+    long pauses;              // Number of M0 pauses (operator time is not included)
+} JobEstimate;
+
+void defaultEstimatorModel(EstimatorModel *model);
+int loadEstimatorModel(const char *filename, EstimatorModel *model);      // 0 on success, -1 if missing
+int saveEstimatorModel(const char *filename, const EstimatorModel *model);
+void estimateProgram(const char *program, size_t length, const EstimatorModel *model, Arena *arena, JobEstimate *estimate);  // arena may be NULL
+int calibrateEstimator(const JobEstimate *runs, const double *measured, int numRuns, EstimatorModel *model);
+void printEstimate(const JobEstimate *estimate);
+
+#endif // ESTIMATE_H_INCLUDED
@@ -0,0 +1,398 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "font.h"
+
+// The font shared by the command line, as loaded and at the current text height
+static Font baseFont;
+static Font scaledFont;
+
+// Function to open a file and return its pointer
+FILE *openFile(const char *filename, const char *mode) {
+    FILE *file = fopen(filename, mode);
+    if (!file) {
+        printf("Error opening file: %s\n", filename);  // Callers decide whether to give up
+    }
+    return file;
+}
+
+// Function to read a whole text file into a newly allocated string
+char *readTextFile(const char *filename) {
+    FILE *textFile = openFile(filename, "r");
+    if (!textFile) {
+        return NULL;
+    }
+    size_t capacity = 4096;
+    size_t index = 0;
+    char *text = malloc(capacity);
+
+    // Read the text from the file, growing the buffer as needed
+    while (text) {
+        index += fread(&text[index], 1, capacity - index - 1, textFile);
+        if (index < capacity - 1) {
+            break;  // Reached the end of the file
+        }
+        capacity *= 2;
+        char *bigger = realloc(text, capacity);
+        if (!bigger) {
+            free(text);
+        }
+        text = bigger;
+    }
+
+    fclose(textFile);  // Close the text file
+    if (!text) {
+        printf("Error: Out of memory reading %s\n", filename);
+        return NULL;
+    }
+    text[index] = '\0';
+    return text;
+}
+
+// Function to work out the layout metrics of a character from its movements
+static void computeGlyphMetrics(Character *charData) {
+    charData->minY = 0;
+    charData->lastPen = -1;  // -1 = the character leaves the pen untouched
+    charData->inked = 0;
+    charData->left = 0;
+    charData->right = 0;
+    for (int j = 0; j < charData->num_movements; j++) {
+        if (j == 0 || charData->movements[j].y < charData->minY) {
+            charData->minY = charData->movements[j].y;
+        }
+        charData->lastPen = charData->movements[j].pen;
+
+        // A pen-down movement inks from where the last one ended
+        if (charData->movements[j].pen == 1) {
+            int fromX = j > 0 ? charData->movements[j - 1].x : 0;
+            int toX = charData->movements[j].x;
+            int low = fromX < toX ? fromX : toX;
+            int high = fromX < toX ? toX : fromX;
+            if (!charData->inked || low < charData->left) {
+                charData->left = low;
+            }
+            if (!charData->inked || high > charData->right) {
+                charData->right = high;
+            }
+            charData->inked = 1;
+        }
+    }
+}
+
+// Function to build the kerning hash, trying multipliers until no two pairs collide; returns -1 if none works
+static int buildKerningTable(const unsigned short *keys, const signed char *adjust, int count, KerningTable *table) {
+    int size = 16;
+    int bits = 4;
+    while (size < 2 * count) {
+        size *= 2;
+        bits++;
+    }
+
+    for (; size <= KERNING_SLOTS; size *= 2, bits++) {
+        for (unsigned int attempt = 0; attempt < 256; attempt++) {
+            unsigned int multiplier = 0x9E3779B1u * (2u * attempt + 1u);
+            int collided = 0;
+            memset(table, 0, sizeof(*table));
+            for (int i = 0; i < count && !collided; i++) {
+                unsigned int slot = (keys[i] * multiplier) >> (32 - bits);
+                if (table->keys[slot] != 0 && table->keys[slot] != keys[i]) {
+                    collided = 1;
+                }
+                table->keys[slot] = keys[i];
+                table->adjust[slot] = adjust[i];  // A repeated pair keeps its last value
+                table->scaled[slot] = adjust[i];
+                table->starts[keys[i] >> 11] |= (unsigned char)(1 << ((keys[i] >> 8) & 7));
+            }
+            if (!collided) {
+                table->multiplier = multiplier;
+                table->shift = 32 - bits;
+                table->size = size;
+                return 0;
+            }
+        }
+    }
+    return -1;
+}
+
+// Function to look up the adjustment for a pair of characters at the font's height
+int fontKerning(const Font *font, unsigned char first, unsigned char second) {
+    const KerningTable *kerning = &font->kerning;
+    if (!(kerning->starts[first >> 3] & (1 << (first & 7)))) {
+        return 0;  // Most characters begin no pair
+    }
+    unsigned int key = (unsigned int)first << 8 | second;
+    unsigned int slot = (key * kerning->multiplier) >> kerning->shift;
+    return kerning->keys[slot] == key ? kerning->scaled[slot] : 0;
+}
+
+// Function to unpack the font compiled into the program; its metrics and kerning hash come ready made
+static void loadBuiltinFont(Font *font) {
+    for (int i = 0; i < MAX_CHARACTERS; i++) {
+        const EmbeddedGlyph *glyph = &builtinFont.glyphs[i];
+        Character *charData = &font->glyphs[i];
+        charData->num_movements = glyph->count;
+        for (int j = 0; j < glyph->count; j++) {
+            const EmbeddedMovement *m = &builtinFont.movements[glyph->first + j];
+            charData->movements[j] = (Movement){m->x, m->y, m->pen};
+        }
+        charData->minY = glyph->minY;
+        charData->lastPen = glyph->lastPen;
+        charData->inked = glyph->inked;
+        charData->left = glyph->left;
+        charData->right = glyph->right;
+    }
+
+    KerningTable *table = &font->kerning;
+    memset(table, 0, sizeof(*table));
+    table->multiplier = builtinFont.multiplier;
+    table->shift = builtinFont.shift;
+    table->size = builtinFont.size;
+    for (int i = 0; i < builtinFont.numPairs; i++) {
+        const EmbeddedKerning *pair = &builtinFont.pairs[i];
+        table->keys[pair->slot] = pair->key;
+        table->adjust[pair->slot] = pair->adjust;
+        table->scaled[pair->slot] = pair->adjust;
+        table->starts[pair->key >> 11] |= (unsigned char)(1 << ((pair->key >> 8) & 7));
+    }
+    font->height = 0.0f;
+    font->hash = builtinFont.hash;
+}
+
+// Function to load a font from a file, or the built-in font if there is no file; a bad file leaves the font as it was
+int loadFont(const char *filename, Font *font) {
+    if (!filename) {
+        loadBuiltinFont(font);
+        return 0;
+    }
+    FILE *file = openFile(filename, "r");
+    char line[256];  // Temporary buffer to read each line from the file
+    int currentChar = -1;  // Variable to track the current character being loaded
+    int numMovements = 0;  // Variable to count the movements for the current character
+    int lineNumber = 0;
+    int inKerning = 0;  // Set once the kerning section starts
+    unsigned short pairKeys[MAX_KERNING_PAIRS];
+    signed char pairAdjust[MAX_KERNING_PAIRS];
+    int numPairs = 0;
+    unsigned long long hash = 14695981039346656037ULL;
+
+    if (!file) {
+        return -1;
+    }
+    Font *loaded = calloc(1, sizeof(Font));  // Parsed aside, so a bad file does not spoil the font
+    if (!loaded) {
+        printf("Error: Out of memory loading %s\n", filename);
+        fclose(file);
+        return -1;
+    }
+    Character *fontData = loaded->glyphs;
+
+    // Read each line from the file
+    while (fgets(line, sizeof(line), file)) {
+        int x, y, p;
+        lineNumber++;
+        for (const char *c = line; *c != '\0'; c++) {
+            hash = (hash ^ (unsigned char)*c) * 1099511628211ULL;
+        }
+
+        // The kerning section follows the last character
+        if (strncmp(line, "KERNING", 7) == 0) {
+            inKerning = 1;
+        } else if (inKerning) {
+            int first, second, adjust;
+            if (sscanf(line, "%d %d %d", &first, &second, &adjust) == 3) {
+                if (first < 32 || first > 126 || second < 32 || second > 126 || adjust < -18 || adjust > 18 || numPairs == MAX_KERNING_PAIRS) {
+                    break;
+                }
+                pairKeys[numPairs] = (unsigned short)(first << 8 | second);
+                pairAdjust[numPairs++] = (signed char)adjust;
+            }
+        } else if (strncmp(line, "999", 3) == 0) {  // Check if the line indicates a new character
+            if (currentChar != -1) {
+                fontData[currentChar].num_movements = numMovements;  // Update movement count for the previous character
+            }
+            sscanf(line, "999 %d %d", &currentChar, &numMovements);  // Extract character ID and number of movements
+            if (currentChar < 0 || currentChar >= MAX_CHARACTERS || numMovements < 0 || numMovements > MAX_MOVEMENTS) {
+                break;
+            }
+        } else if (sscanf(line, "%d %d %d", &x, &y, &p) == 3) {  // Extract movement data (x, y, pen state)
+            if (currentChar == -1 || numMovements >= MAX_MOVEMENTS) {
+                break;
+            }
+            fontData[currentChar].movements[numMovements++] = (Movement){x, y, p};  // Store the movement for the current character
+        }
+    }
+
+    int failed = !feof(file) || ferror(file) || buildKerningTable(pairKeys, pairAdjust, numPairs, &loaded->kerning) != 0;
+    fclose(file);
+    if (failed || currentChar == -1) {
+        printf("Error: %s is not a valid font file (line %d)\n", filename, lineNumber);
+        free(loaded);
+        return -1;
+    }
+
+    // Update movement count for the last character
+    fontData[currentChar].num_movements = numMovements;
+
+    for (int i = 0; i < MAX_CHARACTERS; i++) {
+        computeGlyphMetrics(&fontData[i]);
+    }
+    loaded->hash = hash;
+    memcpy(font, loaded, sizeof(Font));
+    free(loaded);
+    return 0;
+}
+
+// Function to scale a font to the desired height, always starting from the font as loaded
+void scaleFont(const Font *base, float height, Font *scaled) {
+    float scaleFactor = height / FONT_DESIGN_HEIGHT;  // Calculate the scale factor based on the desired height
+    // Apply scaling factor to all characters and scale their movements
+    for (int i = 0; i < MAX_CHARACTERS; i++) {
+        const Character *baseData = &base->glyphs[i];
+        Character *charData = &scaled->glyphs[i];
+        charData->num_movements = baseData->num_movements;
+        if (charData->num_movements > 0) {
+            for (int j = 0; j < charData->num_movements; j++) {
+                charData->movements[j].x = (int)((float)baseData->movements[j].x * scaleFactor);  // Scale the X coordinate
+                charData->movements[j].y = (int)((float)baseData->movements[j].y * scaleFactor);  // Scale the Y coordinate
+                charData->movements[j].pen = baseData->movements[j].pen;
+            }
+        }
+        computeGlyphMetrics(charData);  // Truncation can move the lowest point
+    }
+    scaled->kerning = base->kerning;
+    for (int i = 0; i < scaled->kerning.size; i++) {
+        scaled->kerning.scaled[i] = (signed char)(int)((float)base->kerning.adjust[i] * scaleFactor);
+    }
+    scaled->height = height;
+    scaled->hash = base->hash;
+}
+
+// Function to load the shared font; a bad file leaves the previous font in place
+int loadFontData(const char *filename) {
+    if (loadFont(filename, &baseFont) != 0) {
+        return -1;
+    }
+    scaledFont = baseFont;  // Drawn at design size until it is scaled
+    return 0;
+}
+
+// Function to scale the shared font data based on the desired height
+void scaleFontData(float height) {
+    scaleFont(&baseFont, height, &scaledFont);
+}
+
+// Function to give the shared font at its current height
+const Font *currentFont(void) {
+    return &scaledFont;
+}
+
+// Function to identify the loaded font, so programs compiled with another font are not reused
+unsigned long long fontDataHash(void) {
+    return baseFont.hash;
+}
+
+// Function to check a value fits the signed char the built-in font table keeps it in
+static int fitsTable(int value) {
+    return value >= -128 && value <= 127;
+}
+
+// Function to write a font file out as C source for builtinfont.c, with everything loading it works out done already
+int writeFontTable(const char *fontFile, const char *outputFile) {
+    Font *font = calloc(1, sizeof(Font));
+    if (!font) {
+        printf("Error: Out of memory loading %s\n", fontFile);
+        return -1;
+    }
+    if (loadFont(fontFile, font) != 0) {
+        free(font);
+        return -1;
+    }
+
+    // Every coordinate has to fit the table's signed chars, and every glyph's start its unsigned shorts
+    long numMovements = 0;
+    int fits = 1;
+    for (int i = 0; i < MAX_CHARACTERS; i++) {
+        const Character *charData = &font->glyphs[i];
+        for (int j = 0; j < charData->num_movements; j++) {
+            const Movement *m = &charData->movements[j];
+            fits = fits && fitsTable(m->x) && fitsTable(m->y) && fitsTable(m->pen);
+        }
+        numMovements += charData->num_movements;
+    }
+    if (!fits || numMovements > 65535) {
+        printf("Error: %s is too large for the built-in font table\n", fontFile);
+        free(font);
+        return -1;
+    }
+
+    FILE *out = openFile(outputFile, "w");
+    if (!out) {
+        free(font);
+        return -1;
+    }
+    fprintf(out, "// The built-in font, made from %s by --embed-font; make it again rather than editing it\n", fontFile);
+    fprintf(out, "#include \"font.h\"\n\n");
+
+    // Movements of every character, one after another
+    fprintf(out, "static const EmbeddedMovement movements[] = {\n");
+    long written = 0;
+    for (int i = 0; i < MAX_CHARACTERS; i++) {
+        const Character *charData = &font->glyphs[i];
+        for (int j = 0; j < charData->num_movements; j++, written++) {
+            const Movement *m = &charData->movements[j];
+            fprintf(out, "%s{%d, %d, %d},", written % 8 == 0 ? "    " : " ", m->x, m->y, m->pen);
+            if (written % 8 == 7) {
+                fprintf(out, "\n");
+            }
+        }
+    }
+    if (written == 0) {
+        fprintf(out, "    {0, 0, 0},");  // C has no empty arrays
+    }
+    fprintf(out, "%s};\n\n", written % 8 != 0 || written == 0 ? "\n" : "");
+
+    // Where each character's movements start, and its metrics
+    fprintf(out, "static const EmbeddedGlyph glyphs[MAX_CHARACTERS] = {\n");
+    long first = 0;
+    for (int i = 0; i < MAX_CHARACTERS; i++) {
+        const Character *charData = &font->glyphs[i];
+        fprintf(out, "    {%ld, %d, %d, %d, %d, %d, %d},", first, charData->num_movements, charData->minY,
+                charData->lastPen, charData->inked, charData->left, charData->right);
+        if (i > 32 && i < 127) {
+            fprintf(out, "  // %d '%c'\n", i, i);
+        } else {
+            fprintf(out, "  // %d\n", i);
+        }
+        first += charData->num_movements;
+    }
+    fprintf(out, "};\n\n");
+
+    // The filled slots of the kerning hash, at the places the multiplier puts them
+    const KerningTable *kerning = &font->kerning;
+    int numPairs = 0;
+    fprintf(out, "static const EmbeddedKerning pairs[] = {\n");
+    for (int i = 0; i < kerning->size; i++) {
+        if (kerning->keys[i] != 0) {
+            fprintf(out, "    {%d, 0x%04x, %d},\n", i, kerning->keys[i], kerning->adjust[i]);
+            numPairs++;
+        }
+    }
+    if (numPairs == 0) {
+        fprintf(out, "    {0, 0, 0},\n");
+    }
+    fprintf(out, "};\n\n");
+
+    fprintf(out, "const EmbeddedFont builtinFont = {glyphs, movements, pairs, %d, 0x%08xu, %d, %d, 0x%016llxULL};\n",
+            numPairs, kerning->multiplier, kerning->shift, kerning->size, font->hash);
+
+    int failed = ferror(out);
+    if (fclose(out) != 0 || failed) {
+        printf("Error writing %s\n", outputFile);
+        free(font);
+        return -1;
+    }
+    printf("Wrote %s: %ld movements, %d kerning pairs\n", outputFile, numMovements, numPairs);
+    free(font);
+    return 0;
+}
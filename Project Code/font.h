@@ -0,0 +1,120 @@
+#include <stdio.h>
+
+
+#ifndef FONT_H_INCLUDED
+#define FONT_H_INCLUDED
+
+
+#define MAX_MOVEMENTS 1000          // Maximum number of movements a character can have
+#define MAX_CHARACTERS 256          // Maximum number of characters in the font
+#define FONT_DESIGN_HEIGHT 18.0f    // Height of the font's coordinates; each glyph sits in a cell this wide
+#define GLYPH_GAP 4.0f              // Gap left between the ink of kerned glyphs, in font units
+#define MAX_KERNING_PAIRS 1024      // Pairs allowed in the font's kerning section
+#define KERNING_SLOTS 4096          // Largest hash table tried for the kerning pairs
+#define FONT_FILE "SingleStrokeFont.txt"   // The font built into the program is made from this file
+
+// Structure to represent a movement (X, Y coordinates and pen state)
+typedef struct {
+    int x;    // X-coordinate of the movement
+    int y;    // Y-coordinate of the movement
+    int pen;  // Pen state: 0 = pen up, 1 = pen down
+} Movement;
+
+// Structure to represent a character, containing a number of movements
+typedef struct {
+    int num_movements;               // Number of movements for a character
+    int minY;                        // Lowest Y reached by any movement (after scaling)
+    int lastPen;                     // Pen state left behind by the last movement
+    int inked;                       // 1 if the pen draws anything
+    int left, right;                 // Leftmost and rightmost X the pen draws at (after scaling); the side bearings
+    Movement movements[MAX_MOVEMENTS];  // Array of movements for a character
+} Character;
+
+// Kerning pairs in a perfect hash: the slot is the top bits of key * multiplier, and no two pairs share one
+typedef struct {
+    unsigned short keys[KERNING_SLOTS];      // first << 8 | second, 0 for an empty slot
+    signed char adjust[KERNING_SLOTS];       // In font units
+    signed char scaled[KERNING_SLOTS];       // At the font's text height
+    unsigned int multiplier;
+    int shift;
+    int size;
+    unsigned char starts[MAX_CHARACTERS / 8];  // Bit set for every character that begins a pair
+} KerningTable;
+
+// A font as loaded, or scaled to a text height
+typedef struct {
+    Character glyphs[MAX_CHARACTERS];   // Movements and metrics of each character
+    KerningTable kerning;
+    float height;                       // Text height the glyphs are scaled to, 0 as loaded
+    unsigned long long hash;            // 64-bit FNV-1a of the font file, 0 if none is loaded
+} Font;
+
+// One movement of the built-in font, in font units
+typedef struct {
+    signed char x, y, pen;
+} EmbeddedMovement;
+
+// One character of the built-in font, with its metrics worked out when the table was made
+typedef struct {
+    unsigned short first;               // Index of its first movement
+    unsigned short count;
+    signed char minY, lastPen, inked, left, right;
+} EmbeddedGlyph;
+
+// One filled slot of the built-in font's kerning hash
+typedef struct {
+    unsigned short slot, key;
+    signed char adjust;
+} EmbeddedKerning;
+
+// The font compiled into the program
+typedef struct {
+    const EmbeddedGlyph *glyphs;        // MAX_CHARACTERS of them
+    const EmbeddedMovement *movements;
+    const EmbeddedKerning *pairs;
+    int numPairs;
+    unsigned int multiplier;            // Of the kerning hash, as found when the table was made
+    int shift;
+    int size;
+    unsigned long long hash;            // Of the file it was made from, so cached programs carry over
+} EmbeddedFont;
+
+extern const EmbeddedFont builtinFont;  // In builtinfont.c
+
+/*
+ The font file may end with a kerning section: a line "KERNING" followed by
+ "<first> <second> <adjustment>" lines, character codes as in the 999 headers
+ and the adjustment in font units (negative pulls the pair together):
+
+     KERNING
+     65 86 -3
+
+ The pairs are kept in a small perfect hash, so a lookup is one multiply and
+ one compare, and characters that start no pair skip it altogether.
+
+ The program carries a copy of SingleStrokeFont.txt in builtinfont.c, parsed,
+ with the metrics of every glyph and the kerning hash already worked out, so
+ nothing is read or searched for at start-up; --font <file> draws with a font
+ file instead. After SingleStrokeFont.txt changes, --embed-font
+ SingleStrokeFont.txt builtinfont.c writes the table again, ready to rebuild.
+
+ A Font belongs to whoever holds it: loadFont() and scaleFont() touch only
+ the fonts they are given, so threads that each keep their own can load and
+ scale at the same time. loadFontData() and scaleFontData() work on one font
+ shared by the whole program, the one generateGCode() draws with; they are
+ for the command line and must not be called while another thread lays out
+ text with it.
+*/
+
+FILE *openFile(const char *filename, const char *mode);   // fopen that reports failures, returns NULL on error
+char *readTextFile(const char *filename);                 // Read a whole file into a malloc'd string, NULL on error
+int loadFont(const char *filename, Font *font);           // Parse a single stroke font file, NULL for the built-in font; returns 0 on success, a bad file leaves font as it was
+void scaleFont(const Font *base, float height, Font *scaled);      // Scale a loaded font to the text height
+int fontKerning(const Font *font, unsigned char first, unsigned char second);  // Scaled pair adjustment, 0 if none
+int loadFontData(const char *filename);                   // Load the shared font, NULL for the built-in one; returns 0 on success
+void scaleFontData(float height);                         // Scale the shared font to the text height
+const Font *currentFont(void);                            // The shared font at the last height it was scaled to
+unsigned long long fontDataHash(void);                    // Hash of the shared font's file, 0 if none is loaded
+int writeFontTable(const char *fontFile, const char *outputFile);  // Write a font file out as the C source of the built-in font
+
+#endif // FONT_H_INCLUDED
@@ -0,0 +1,1251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <math.h>
+#include <pthread.h>
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+#include "font.h"
+#include "gcode.h"
+
+#define MIN_CHUNK_ITEMS 512         // Smallest run of layout items worth handing to a worker
+#define CHUNKS_PER_WORKER 4         // Extra chunks per worker so uneven pages balance out
+#define HYPHEN_PENALTY_CHARS 3      // The optimal breaker takes a hyphen only if it saves this much slack (in characters)
+
+// Function to allocate job memory, from the arena when there is one
+static void *allocJob(Arena *arena, size_t size) {
+    return arena ? arenaAlloc(arena, size) : malloc(size);
+}
+
+// Function to grow job memory; on failure NULL is returned and the old block is kept
+static void *growJob(Arena *arena, void *old, size_t oldSize, size_t newSize) {
+    return arena ? arenaResize(arena, old, oldSize, newSize) : realloc(old, newSize);
+}
+
+// Function to release job memory; memory in an arena waits for the arena to go
+static void freeJob(Arena *arena, void *memory) {
+    if (!arena) {
+        free(memory);
+    }
+}
+
+// Function to set up an empty G-code buffer
+void initGCodeBuffer(GCodeBuffer *buffer) {
+    initGCodeBufferInArena(buffer, NULL);
+}
+
+// Function to set up an empty G-code buffer whose text comes from a job arena
+void initGCodeBufferInArena(GCodeBuffer *buffer, Arena *arena) {
+    buffer->data = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+    buffer->failed = 0;
+    buffer->arena = arena;
+}
+
+// Function to release the memory held by a G-code buffer
+void freeGCodeBuffer(GCodeBuffer *buffer) {
+    freeJob(buffer->arena, buffer->data);
+    initGCodeBufferInArena(buffer, buffer->arena);
+}
+
+// Function to make sure the buffer has room for extra characters plus the terminator; returns -1 and marks the buffer failed if it cannot
+static int reserveGCode(GCodeBuffer *buffer, size_t extra) {
+    if (buffer->failed) {
+        return -1;
+    }
+    if (buffer->length + extra + 1 <= buffer->capacity) {
+        return 0;
+    }
+    size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+    while (capacity < buffer->length + extra + 1) {
+        capacity *= 2;
+    }
+    char *data = growJob(buffer->arena, buffer->data, buffer->capacity, capacity);
+    if (!data) {
+        printf("Error: Out of memory while generating G-code.\n");
+        buffer->failed = 1;
+        return -1;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return 0;
+}
+
+// Function to append a printf-style command to the buffer
+void appendGCode(GCodeBuffer *buffer, const char *format, ...) {
+    va_list args;
+    if (reserveGCode(buffer, 64) != 0) {  // Every command we emit fits comfortably in 64 characters
+        return;
+    }
+
+    va_start(args, format);
+    int written = vsnprintf(buffer->data + buffer->length, buffer->capacity - buffer->length, format, args);
+    va_end(args);
+
+    if (written > 0 && (size_t)written >= buffer->capacity - buffer->length) {
+        if (reserveGCode(buffer, (size_t)written) != 0) {
+            buffer->data[buffer->length] = '\0';  // Drop the truncated command
+            return;
+        }
+        va_start(args, format);
+        vsnprintf(buffer->data + buffer->length, buffer->capacity - buffer->length, format, args);
+        va_end(args);
+    }
+    if (written > 0) {
+        buffer->length += (size_t)written;
+    }
+}
+
+// Function to append text that is already formatted
+void appendGCodeText(GCodeBuffer *buffer, const char *text, size_t length) {
+    if (length == 0 || reserveGCode(buffer, length) != 0) {
+        return;
+    }
+    memcpy(buffer->data + buffer->length, text, length);
+    buffer->length += length;
+    buffer->data[buffer->length] = '\0';
+}
+
+// Function to append the whole of one buffer to another
+void appendGCodeBuffer(GCodeBuffer *buffer, const GCodeBuffer *other) {
+    if (other->failed) {
+        buffer->failed = 1;
+    }
+    if (other->length == 0 || reserveGCode(buffer, other->length) != 0) {
+        return;
+    }
+    memcpy(buffer->data + buffer->length, other->data, other->length);
+    buffer->length += other->length;
+    buffer->data[buffer->length] = '\0';
+}
+
+// Function to add an item to the layout; returns NULL if it could not
+static LayoutItem *addLayoutItem(Layout *layout, LayoutItemType type, int x, int y, int penState) {
+    if (layout->count == layout->capacity) {
+        size_t capacity = layout->capacity ? layout->capacity * 2 : 256;
+        LayoutItem *items = growJob(layout->arena, layout->items, layout->capacity * sizeof(LayoutItem), capacity * sizeof(LayoutItem));
+        if (!items) {
+            if (!layout->failed) {
+                printf("Error: Out of memory while laying out text.\n");
+            }
+            layout->failed = 1;
+            return NULL;
+        }
+        layout->items = items;
+        layout->capacity = capacity;
+    }
+    LayoutItem *item = &layout->items[layout->count++];
+    *item = (LayoutItem){type, NULL, 0, x, y, penState, 0};
+    return item;
+}
+
+// Function to release the memory held by a layout
+void freeLayout(Layout *layout) {
+    freeJob(layout->arena, layout->items);
+    memset(layout, 0, sizeof(*layout));
+}
+
+// Function to move the layout down to the next line, starting a new page if this one is full
+static void layoutNewLine(Layout *layout, int *x_pos, int *y_pos, int *penState, int *lowestY, int lineGap, int minY, int firstLineY) {
+    *y_pos = *lowestY - lineGap;
+    if (*y_pos < minY) {
+        addLayoutItem(layout, ITEM_PAGE, 0, 0, *penState);  // Text exceeds the Y-axis limit, carry on over the page
+        *penState = 0;
+        *y_pos = firstLineY;
+        layout->pages++;
+    }
+    *x_pos = layout->leftMargin;
+    *lowestY = *y_pos;
+    addLayoutItem(layout, ITEM_NEWLINE, layout->leftMargin, *y_pos, *penState);
+}
+
+// Function to work out how far a character moves the pen: a full cell, or when kerning, the width of its ink plus a gap and any pair adjustment with the next character
+static int glyphAdvance(const Layout *layout, unsigned char currentChar, unsigned char nextChar) {
+    const Character *charData = &layout->font->glyphs[currentChar];
+    if (!layout->kerning || !charData->inked) {
+        return layout->charWidth;
+    }
+    int advance = charData->right - charData->left + layout->glyphGap;
+    if (nextChar >= 32 && nextChar <= 126) {
+        advance += fontKerning(layout->font, currentChar, nextChar);
+    }
+    return advance;
+}
+
+// Function to measure how far a word advances the pen; characters the font cannot draw take no room
+int measureWord(const Layout *layout, const char *word, int length) {
+    int width = 0;
+    for (int i = 0; i < length; i++) {
+        unsigned char currentChar = (unsigned char)word[i];
+        if (currentChar >= 32 && currentChar <= 126) {
+            width += glyphAdvance(layout, currentChar, i + 1 < length ? (unsigned char)word[i + 1] : 0);
+        }
+    }
+    return width;
+}
+
+// Function to follow the pen and lowest point through a word using the precomputed glyph metrics
+static void trackGlyphs(const Layout *layout, const char *word, int length, int y_pos, int *penState, int *lowestY) {
+    for (int i = 0; i < length; i++) {
+        unsigned char currentChar = (unsigned char)word[i];
+        if (currentChar >= 32 && currentChar <= 126) {
+            const Character *charData = &layout->font->glyphs[currentChar];
+            if (charData->num_movements > 0) {
+                if (y_pos + charData->minY < *lowestY) {
+                    *lowestY = y_pos + charData->minY;
+                }
+                *penState = charData->lastPen;
+            }
+        }
+    }
+}
+
+// Function to place a word (or the piece of one that fits on this line) at a position
+static void placeWord(Layout *layout, const char *word, int length, int hyphen, int x_pos, int y_pos, int *penState, int *lowestY) {
+    LayoutItem *item = addLayoutItem(layout, ITEM_WORD, x_pos, y_pos, *penState);
+    if (item) {
+        item->word = word;
+        item->length = length;
+        item->hyphen = hyphen;
+    }
+    trackGlyphs(layout, word, length, y_pos, penState, lowestY);
+    if (hyphen) {
+        trackGlyphs(layout, "-", 1, y_pos, penState, lowestY);
+    }
+}
+
+// Piece of a paragraph the line breaker may end a line after
+typedef struct {
+    const char *word;   // Start of the piece in the source text
+    int length;         // Number of characters in the piece
+    int width;          // How far the piece advances the pen
+    int endsWord;       // 1 if a space follows, 0 if the word carries on in the next piece
+    int hyphen;         // 1 if a line ending here needs a hyphen, 0 for a plain split of an over-long word
+} Fragment;
+
+// Working space for one paragraph, reused for the next so a long text costs no extra allocations
+typedef struct {
+    Fragment *fragments;
+    size_t count;
+    size_t capacity;
+    int *position;          // position[i] = advance from the paragraph start to fragment i
+    long long *cost;        // Optimal breaker: cost[i] = best cost of setting fragments before i
+    size_t *lineStart;      // ... and the first fragment of the last line in that setting
+    size_t *lineEnds;       // Last fragment of each line, in order
+    size_t numLines;
+    Arena *arena;           // Job arena the arrays come from, NULL for the heap
+} Paragraph;
+
+// Everything the paragraph passes need about the page and the pen
+typedef struct {
+    Layout *layout;
+    const LayoutOptions *options;
+    Paragraph *paragraph;
+    int maxWidth;        // Room on a line
+    int space;           // Advance of a space
+    int hyphenWidth;     // Advance of the hyphen glyph
+    int x_pos, y_pos;    // Where the next word goes
+    int penState;
+    int lowestY;
+    int lineGap, minY, firstLineY;
+} LineSetter;
+
+// Function to grow the paragraph arrays to hold at least the given number of fragments; returns -1 if memory ran out
+static int reserveParagraph(Paragraph *paragraph, size_t count) {
+    if (count <= paragraph->capacity) {
+        return 0;
+    }
+    size_t capacity = paragraph->capacity ? paragraph->capacity : 64;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+    Arena *arena = paragraph->arena;
+    size_t old = paragraph->capacity;
+    Fragment *fragments = growJob(arena, paragraph->fragments, old * sizeof(Fragment), capacity * sizeof(Fragment));
+    if (fragments) {
+        paragraph->fragments = fragments;
+    }
+    int *position = growJob(arena, paragraph->position, (old + 1) * sizeof(int), (capacity + 1) * sizeof(int));
+    if (position) {
+        paragraph->position = position;
+    }
+    long long *cost = growJob(arena, paragraph->cost, (old + 1) * sizeof(long long), (capacity + 1) * sizeof(long long));
+    if (cost) {
+        paragraph->cost = cost;
+    }
+    size_t *lineStart = growJob(arena, paragraph->lineStart, (old + 1) * sizeof(size_t), (capacity + 1) * sizeof(size_t));
+    if (lineStart) {
+        paragraph->lineStart = lineStart;
+    }
+    size_t *lineEnds = growJob(arena, paragraph->lineEnds, old * sizeof(size_t), capacity * sizeof(size_t));
+    if (lineEnds) {
+        paragraph->lineEnds = lineEnds;
+    }
+    if (!fragments || !position || !cost || !lineStart || !lineEnds) {
+        return -1;
+    }
+    paragraph->capacity = capacity;
+    return 0;
+}
+
+// Function to release the paragraph arrays
+static void freeParagraph(Paragraph *paragraph) {
+    freeJob(paragraph->arena, paragraph->fragments);
+    freeJob(paragraph->arena, paragraph->position);
+    freeJob(paragraph->arena, paragraph->cost);
+    freeJob(paragraph->arena, paragraph->lineStart);
+    freeJob(paragraph->arena, paragraph->lineEnds);
+    memset(paragraph, 0, sizeof(*paragraph));
+}
+
+// Function to add a piece to the paragraph
+static void addFragment(LineSetter *setter, const char *word, int length, int endsWord, int hyphen) {
+    Paragraph *paragraph = setter->paragraph;
+    if (reserveParagraph(paragraph, paragraph->count + 1) != 0) {
+        if (!setter->layout->failed) {
+            printf("Error: Out of memory while laying out text.\n");
+        }
+        setter->layout->failed = 1;
+        return;
+    }
+    paragraph->fragments[paragraph->count++] = (Fragment){word, length, measureWord(setter->layout, word, length), endsWord, hyphen};
+}
+
+// Function to check for a vowel, counting y as one
+static int isVowel(char c) {
+    return c != '\0' && strchr("aeiouyAEIOUY", c) != NULL;
+}
+
+// Function to check for an ASCII letter
+static int isLetter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Function to decide whether a word may be hyphenated before position i, by simple syllable rules:
+// before a lone consonant after a vowel (pa-per), or between two consonants with vowels either side
+// (but-ter), keeping pairs such as "th" together. Two letters stay behind and three move on at least.
+static int isHyphenPoint(const char *word, int length, int i) {
+    static const char *pairs[] = {"th", "ch", "sh", "ph", "wh", "gh", "ck", "qu"};
+    if (i < 2 || length - i < 3) {
+        return 0;
+    }
+    for (int j = i - 2; j <= i + 1; j++) {
+        if (!isLetter(word[j])) {
+            return 0;
+        }
+    }
+    if (!isVowel(word[i + 1]) || isVowel(word[i])) {
+        return 0;
+    }
+    if (isVowel(word[i - 1])) {
+        return 1;
+    }
+    if (!isVowel(word[i - 2])) {
+        return 0;
+    }
+    char pair[3] = {(char)(word[i - 1] | 0x20), (char)(word[i] | 0x20), '\0'};
+    for (size_t j = 0; j < sizeof(pairs) / sizeof(pairs[0]); j++) {
+        if (strcmp(pair, pairs[j]) == 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Function to turn one word into fragments: whole if it fits, otherwise cut at hyphenation points
+// and, if it is still too long for a line, wherever the line runs out
+static void addWord(LineSetter *setter, const char *word, int length) {
+    int hyphenate = setter->options->hyphenate;
+    int hyphenWidth = hyphenate ? setter->hyphenWidth : 0;
+    int rest = measureWord(setter->layout, word, length);  // Width from the current piece to the end of the word
+    int start = 0;
+    int width = 0;
+
+    if (!hyphenate && rest <= setter->maxWidth) {
+        addFragment(setter, word, length, 1, 0);  // The usual case: the word is one piece
+        return;
+    }
+
+    for (int i = 0; i < length; i++) {
+        unsigned char currentChar = (unsigned char)word[i];
+        int advance = 0;
+        if (currentChar >= 32 && currentChar <= 126) {
+            advance = glyphAdvance(setter->layout, currentChar, i + 1 < length ? (unsigned char)word[i + 1] : 0);
+        }
+
+        // An over-long word is cut where the line runs out, leaving room for the hyphen
+        if (i > start && rest > setter->maxWidth && width + advance + hyphenWidth > setter->maxWidth) {
+            addFragment(setter, word + start, i - start, 0, hyphenate);
+            rest -= width;
+            start = i;
+            width = 0;
+        } else if (hyphenate && i > start && isHyphenPoint(word, length, i)) {
+            addFragment(setter, word + start, i - start, 0, 1);
+            rest -= width;
+            start = i;
+            width = 0;
+        }
+        width += advance;
+    }
+    addFragment(setter, word + start, length - start, 1, 0);
+}
+
+// Function to work out the paragraph's line ends by filling each line as far as it goes
+static void breakGreedy(LineSetter *setter) {
+    Paragraph *paragraph = setter->paragraph;
+    size_t lineStart = 0;
+    size_t lastBreak = 0;
+    int haveBreak = 0;
+    int x_pos = 0;
+
+    paragraph->numLines = 0;
+    for (size_t k = 0; k < paragraph->count; k++) {
+        const Fragment *fragment = &paragraph->fragments[k];
+        int end = x_pos + fragment->width;
+
+        // Start a new line after the last place this one could end
+        if (end > setter->maxWidth && k > lineStart) {
+            size_t lineEnd = haveBreak ? lastBreak : k - 1;
+            paragraph->lineEnds[paragraph->numLines++] = lineEnd;
+            lineStart = lineEnd + 1;
+            k = lineEnd;
+            x_pos = 0;
+            haveBreak = 0;
+            continue;
+        }
+
+        int needed = end + (!fragment->endsWord && fragment->hyphen ? setter->hyphenWidth : 0);
+        if (needed <= setter->maxWidth || k == lineStart) {
+            lastBreak = k;
+            haveBreak = 1;
+        }
+        x_pos = end + (fragment->endsWord ? setter->space : 0);
+    }
+    paragraph->lineEnds[paragraph->numLines++] = paragraph->count - 1;
+}
+
+// Function to measure a line running from fragment a to fragment b, as drawn
+static int lineWidth(const LineSetter *setter, size_t a, size_t b) {
+    const Paragraph *paragraph = setter->paragraph;
+    const Fragment *last = &paragraph->fragments[b];
+    int width = paragraph->position[b + 1] - paragraph->position[a];
+    if (last->endsWord) {
+        width -= setter->space;  // No space after the last word
+    } else if (last->hyphen) {
+        width += setter->hyphenWidth;
+    }
+    return width;
+}
+
+// Function to find the line ends that leave the least uneven right edge over the whole paragraph
+// (squared slack per line, plus a charge per hyphen, with the last line free). Lines only ever look
+// back as far as a line can reach, so the cost stays linear in the length of the text.
+static void breakOptimal(LineSetter *setter) {
+    Paragraph *paragraph = setter->paragraph;
+    size_t count = paragraph->count;
+    long long hyphenCost = (long long)(HYPHEN_PENALTY_CHARS * setter->layout->charWidth) * (HYPHEN_PENALTY_CHARS * setter->layout->charWidth);
+    const long long unreachable = -1;
+
+    paragraph->position[0] = 0;
+    for (size_t i = 0; i < count; i++) {
+        const Fragment *fragment = &paragraph->fragments[i];
+        paragraph->position[i + 1] = paragraph->position[i] + fragment->width + (fragment->endsWord ? setter->space : 0);
+    }
+
+    paragraph->cost[0] = 0;
+    for (size_t b = 0; b < count; b++) {
+        paragraph->cost[b + 1] = unreachable;
+        paragraph->lineStart[b + 1] = b;
+        for (size_t a = b + 1; a-- > 0; ) {
+            int width = lineWidth(setter, a, b);
+            if (width > setter->maxWidth && a < b) {
+                if (width - (paragraph->fragments[b].endsWord ? 0 : setter->hyphenWidth) > setter->maxWidth) {
+                    break;  // Starting any earlier only makes it wider
+                }
+                continue;
+            }
+            if (paragraph->cost[a] == unreachable) {
+                continue;
+            }
+            long long slack = width < setter->maxWidth ? setter->maxWidth - width : 0;
+            long long cost = paragraph->cost[a] + (b == count - 1 ? 0 : slack * slack);
+            if (!paragraph->fragments[b].endsWord && paragraph->fragments[b].hyphen) {
+                cost += hyphenCost;
+            }
+            if (paragraph->cost[b + 1] == unreachable || cost < paragraph->cost[b + 1]) {
+                paragraph->cost[b + 1] = cost;
+                paragraph->lineStart[b + 1] = a;
+            }
+        }
+    }
+
+    // Walk back from the end, then put the lines in order
+    size_t numLines = 0;
+    for (size_t end = count; end > 0; end = paragraph->lineStart[end]) {
+        paragraph->lineEnds[numLines++] = end - 1;
+    }
+    for (size_t i = 0; i < numLines / 2; i++) {
+        size_t swap = paragraph->lineEnds[i];
+        paragraph->lineEnds[i] = paragraph->lineEnds[numLines - 1 - i];
+        paragraph->lineEnds[numLines - 1 - i] = swap;
+    }
+    paragraph->numLines = numLines;
+}
+
+// Function to place the paragraph's lines on the page with the chosen alignment
+static void setParagraph(LineSetter *setter) {
+    Paragraph *paragraph = setter->paragraph;
+    const LayoutOptions *options = setter->options;
+    size_t start = 0;
+
+    for (size_t line = 0; line < paragraph->numLines; line++) {
+        size_t end = paragraph->lineEnds[line];
+        if (line > 0) {
+            layoutNewLine(setter->layout, &setter->x_pos, &setter->y_pos, &setter->penState, &setter->lowestY,
+                          setter->lineGap, setter->minY, setter->firstLineY);
+        }
+
+        // Spare room on the line goes before it, or between its words when justifying
+        int width = 0, gaps = 0;
+        for (size_t k = start; k <= end; k++) {
+            const Fragment *fragment = &paragraph->fragments[k];
+            width += fragment->width + (fragment->endsWord && k < end ? setter->space : 0);
+            gaps += fragment->endsWord && k < end;
+        }
+        if (!paragraph->fragments[end].endsWord && paragraph->fragments[end].hyphen) {
+            width += setter->hyphenWidth;
+        }
+        int spare = setter->maxWidth > width ? setter->maxWidth - width : 0;
+        int justify = options->align == ALIGN_JUSTIFY && line + 1 < paragraph->numLines && gaps > 0;
+        if (options->align == ALIGN_RIGHT) {
+            setter->x_pos += spare;
+        } else if (options->align == ALIGN_CENTRE) {
+            setter->x_pos += spare / 2;
+        }
+
+        // Pieces of the same word on one line are drawn as one word
+        int gap = 0;
+        for (size_t k = start; k <= end; ) {
+            size_t last = k;
+            int pieceWidth = paragraph->fragments[k].width;
+            while (last < end && !paragraph->fragments[last].endsWord) {
+                pieceWidth += paragraph->fragments[++last].width;
+            }
+            const Fragment *fragment = &paragraph->fragments[last];
+            int hyphen = last == end && !fragment->endsWord && fragment->hyphen;
+            int length = (int)(fragment->word + fragment->length - paragraph->fragments[k].word);
+            if (last > k) {
+                pieceWidth = measureWord(setter->layout, paragraph->fragments[k].word, length);  // Kerned across the joins
+            }
+
+            placeWord(setter->layout, paragraph->fragments[k].word, length, hyphen, setter->x_pos, setter->y_pos, &setter->penState, &setter->lowestY);
+            setter->x_pos += pieceWidth;
+            if (fragment->endsWord) {
+                setter->x_pos += setter->space;  // Add extra space after the word
+                if (justify && last < end) {
+                    setter->x_pos += spare / gaps + (gap < spare % gaps);
+                    gap++;
+                }
+            }
+            k = last + 1;
+        }
+        start = end + 1;
+    }
+    paragraph->count = 0;
+}
+
+// Function to fill in the standard layout for a text height
+void defaultLayoutOptions(LayoutOptions *options, float height) {
+    options->height = height;
+    options->maxLineWidth = 100;
+    options->lineSpacing = 5;
+    options->leftMargin = 0;
+    options->topMargin = 0;
+    options->pageDepth = 90;
+    options->charScale = 1.0f;
+    options->penDown = 1000;
+    options->penDwell = 0.0f;
+    options->liftDwell = 0.0f;
+    options->penDrag = 0.0f;
+    options->foldPen = 0;
+    options->align = ALIGN_LEFT;
+    options->breaking = BREAK_GREEDY;
+    options->hyphenate = 0;
+    options->kerning = 0;
+}
+
+// Function to set up an empty layout and the line setter that fills it
+static void startLayout(const LayoutOptions *options, const Font *font, Arena *arena, Layout *layout, LineSetter *setter, Paragraph *paragraph) {
+    memset(layout, 0, sizeof(*layout));
+    memset(paragraph, 0, sizeof(*paragraph));
+    layout->font = font;
+    layout->arena = arena;
+    paragraph->arena = arena;
+
+    float height = options->height;
+    layout->charWidth = (int)(height * options->charScale);  // Character width based on height
+    layout->leftMargin = options->leftMargin;
+    layout->penDown = options->penDown;
+    layout->penDwell = options->penDwell;
+    layout->liftDwell = options->liftDwell;
+    layout->penDrag = options->penDrag;
+    layout->foldPen = options->foldPen;
+    layout->kerning = options->kerning;
+    layout->glyphGap = (int)(height * GLYPH_GAP / FONT_DESIGN_HEIGHT);
+    layout->pages = 1;
+
+    setter->layout = layout;
+    setter->options = options;
+    setter->paragraph = paragraph;
+    setter->maxWidth = options->maxLineWidth;  // Maximum width of a line in the drawing
+    setter->space = layout->charWidth;
+    setter->hyphenWidth = measureWord(layout, "-", 1);
+    setter->x_pos = options->leftMargin;
+    setter->y_pos = -options->topMargin - (int)height;
+    setter->penState = 0;  // Pen state: 0 = pen up, 1 = pen down
+    setter->lowestY = setter->y_pos;  // Variable to track the lowest Y position reached
+    setter->lineGap = (int)(height + (float)options->lineSpacing);  // Line gap between text lines
+    setter->minY = -options->topMargin - options->pageDepth - (int)height;  // Minimum allowed Y position
+    setter->firstLineY = setter->y_pos;
+}
+
+// Function to lay out one paragraph, the text up to a newline or the end; a paragraph ended by a newline
+// always has a last word, even an empty one, where one at the end of the text only has it if it does not end in a space
+static void layoutParagraph(LineSetter *setter, const char *text, size_t length, int endsLine) {
+    const char *wordStart = text;
+
+    // Collect the words, then break the paragraph into lines and place them
+    for (size_t i = 0; i < length && !setter->layout->failed; i++) {
+        if (text[i] == ' ') {
+            addWord(setter, wordStart, (int)(text + i - wordStart));
+            wordStart = text + i + 1;
+        }
+    }
+    if (endsLine || wordStart < text + length) {
+        addWord(setter, wordStart, (int)(text + length - wordStart));
+    }
+    if (!setter->layout->failed) {
+        if (setter->options->breaking == BREAK_OPTIMAL) {
+            breakOptimal(setter);
+        } else {
+            breakGreedy(setter);
+        }
+        setParagraph(setter);
+    }
+}
+
+// Function to find every word position, line break and page break in the text
+int layoutText(const char *text, const LayoutOptions *options, const Font *font, Arena *arena, Layout *layout) {
+    Paragraph paragraph;
+    LineSetter setter;
+    startLayout(options, font, arena, layout, &setter, &paragraph);
+
+    for (const char *ptr = text; *ptr != '\0' && !layout->failed; ) {
+        const char *end = strchr(ptr, '\n');
+        layoutParagraph(&setter, ptr, end ? (size_t)(end - ptr) : strlen(ptr), end != NULL);
+        if (!end) {
+            break;
+        }
+        // A newline moves to the next line
+        layoutNewLine(layout, &setter.x_pos, &setter.y_pos, &setter.penState, &setter.lowestY, setter.lineGap, setter.minY, setter.firstLineY);
+        ptr = end + 1;
+    }
+
+    freeParagraph(&paragraph);
+    layout->finalPen = setter.penState;
+    return layout->failed ? -1 : 0;
+}
+
+// Function to change the pen and make the move that follows it; hop is the length of that move, or -1 if it is not known
+static void penMove(const Layout *layout, int pen, int x, int y, double hop, GCodeBuffer *out) {
+    const char *move = pen == 1 ? "G1" : "G0";
+    int spindle = pen == 1 ? layout->penDown : 0;
+
+    // The pen must land before a stroke, but a lift only has to clear the paper before a hop longer than a drag would be
+    float dwell = layout->penDwell;
+    if (pen == 0) {
+        dwell = hop >= 0.0 && layout->penDrag > 0.0f && hop <= layout->penDrag ? 0.0f : layout->liftDwell;
+    }
+    if (dwell > 0.0f) {
+        appendGCode(out, "S%d\n", spindle);
+        appendGCode(out, "G4 P%g\n", dwell);  // Let the servo settle
+        appendGCode(out, "%s X%d Y%d\n", move, x, y);
+    } else if (layout->foldPen) {
+        appendGCode(out, "%s X%d Y%d S%d\n", move, x, y, spindle);  // GRBL sets S before it starts the move, so the line does both
+    } else {
+        appendGCode(out, "S%d\n", spindle);
+        appendGCode(out, "%s X%d Y%d\n", move, x, y);
+    }
+}
+
+// Function to convert a placed word into G-code for the robot to draw
+void processWord(const char *word, int length, int x_pos, int y_pos, int *penState, const Layout *layout, GCodeBuffer *out) {
+    // Process each character in the word
+    for (int i = 0; i < length; i++) {
+        unsigned char currentChar = (unsigned char)word[i];  // Get the current character
+        if (currentChar >= 32 && currentChar <= 126) {
+            const Character *charData = &layout->font->glyphs[currentChar];  // Get the font data for the current character
+            int originX = layout->kerning && charData->inked ? x_pos - charData->left : x_pos;  // Kerned glyphs start at their ink
+            for (int j = 0; j < charData->num_movements; j++) {
+                Movement m = charData->movements[j];  // Get the movement data for the current character
+                int newX = m.x + originX;  // Calculate the new X coordinate
+                int newY = m.y + y_pos;  // Calculate the new Y coordinate
+                int pen = m.pen;
+                double hop = -1.0;
+                if (j > 0) {
+                    double dx = m.x - charData->movements[j - 1].x, dy = m.y - charData->movements[j - 1].y;
+                    hop = sqrt(dx * dx + dy * dy);
+                }
+
+                // A short hop between two strokes of the same glyph is dragged rather than lifted
+                if (pen == 0 && *penState == 1 && layout->penDrag > 0.0f && hop >= 0.0 && hop <= layout->penDrag &&
+                    j + 1 < charData->num_movements && charData->movements[j + 1].pen == 1) {
+                    pen = 1;
+                }
+
+                // If the pen state has changed, update the pen on the way to the new point
+                if (pen != *penState) {
+                    *penState = pen;
+                    penMove(layout, pen, newX, newY, hop, out);
+                    continue;
+                }
+
+                // Send the movement command (G1 for pen down, G0 for pen up)
+                appendGCode(out, *penState == 1 ? "G1 X%d Y%d\n" : "G0 X%d Y%d\n", newX, newY);
+            }
+            x_pos += glyphAdvance(layout, currentChar, i + 1 < length ? (unsigned char)word[i + 1] : 0);  // Move the X position by the character width
+        }
+    }
+}
+
+// Function to encode a run of layout items; each item carries its own starting state
+static void encodeItems(const Layout *layout, size_t first, size_t last, GCodeBuffer *out) {
+    for (size_t i = first; i < last; i++) {
+        const LayoutItem *item = &layout->items[i];
+        int penState = item->penState;
+        switch (item->type) {
+        case ITEM_WORD:
+            processWord(item->word, item->length, item->x, item->y, &penState, layout, out);
+            if (item->hyphen) {
+                processWord("-", 1, item->x + measureWord(layout, item->word, item->length), item->y, &penState, layout, out);
+            }
+            break;
+        case ITEM_NEWLINE:
+            appendGCode(out, "G0 X%d Y%d\n", item->x, item->y);  // Move to the next line
+            break;
+        case ITEM_PAGE:
+            if (penState != 0) {
+                penMove(layout, 0, 0, 0, -1.0, out);  // Lift and park
+            } else {
+                appendGCode(out, "G0 X0 Y0\n");
+            }
+            appendGCode(out, "M0\n");  // Pause until the operator resumes with a fresh sheet
+            break;
+        }
+    }
+}
+
+// Work shared between the encoding threads
+typedef struct {
+    const Layout *layout;
+    const size_t *chunkStarts;   // chunkStarts[i] .. chunkStarts[i + 1] is chunk i
+    GCodeBuffer *chunkOutput;    // One output buffer per chunk
+    size_t numChunks;
+    size_t nextChunk;            // Next chunk waiting to be encoded
+    pthread_mutex_t lock;
+} EncodeJob;
+
+// Thread function that keeps taking chunks until there are none left
+static void *encodeWorker(void *arg) {
+    EncodeJob *job = arg;
+    while (1) {
+        pthread_mutex_lock(&job->lock);
+        size_t chunk = job->nextChunk++;
+        pthread_mutex_unlock(&job->lock);
+        if (chunk >= job->numChunks) {
+            break;
+        }
+        encodeItems(job->layout, job->chunkStarts[chunk], job->chunkStarts[chunk + 1], &job->chunkOutput[chunk]);
+    }
+    return NULL;
+}
+
+// Function to return the number of cores available for encoding
+int getWorkerCount(void) {
+#if defined(__linux__) || defined(__FreeBSD__)
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? (int)cores : 1;
+#else
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#endif
+}
+
+// Function to encode the layout on a pool of threads, one chunk of lines at a time
+static int encodeParallel(const Layout *layout, GCodeBuffer *program, int threads) {
+    size_t target = layout->count / (size_t)(threads * CHUNKS_PER_WORKER);
+    if (target < MIN_CHUNK_ITEMS) {
+        target = MIN_CHUNK_ITEMS;
+    }
+
+    // Chunks start on line or page boundaries so each one is a run of whole lines
+    size_t maxChunks = layout->count / target + 2;
+    Arena *arena = program->arena;
+    size_t *chunkStarts = allocJob(arena, (maxChunks + 1) * sizeof(size_t));
+    if (!chunkStarts) {
+        return -1;
+    }
+    size_t numChunks = 0;
+    chunkStarts[0] = 0;
+    size_t i = target;
+    while (i < layout->count && numChunks + 1 < maxChunks) {
+        while (i < layout->count && layout->items[i].type == ITEM_WORD) {
+            i++;
+        }
+        if (i >= layout->count) {
+            break;
+        }
+        chunkStarts[++numChunks] = i;
+        i += target;
+    }
+    chunkStarts[++numChunks] = layout->count;
+
+    if (numChunks < 2) {
+        freeJob(arena, chunkStarts);
+        return -1;  // Not worth the threads
+    }
+
+    EncodeJob job;
+    job.layout = layout;
+    job.chunkStarts = chunkStarts;
+    job.numChunks = numChunks;
+    job.nextChunk = 0;
+    job.chunkOutput = allocJob(arena, numChunks * sizeof(GCodeBuffer));
+    pthread_t *workers = allocJob(arena, (size_t)threads * sizeof(pthread_t));
+    if (!job.chunkOutput || !workers) {
+        freeJob(arena, job.chunkOutput);
+        freeJob(arena, workers);
+        freeJob(arena, chunkStarts);
+        return -1;
+    }
+    for (size_t c = 0; c < numChunks; c++) {
+        initGCodeBufferInArena(&job.chunkOutput[c], arena);
+    }
+    pthread_mutex_init(&job.lock, NULL);
+
+    int started = 0;
+    for (int t = 1; t < threads && (size_t)t < numChunks; t++) {
+        if (pthread_create(&workers[started], NULL, encodeWorker, &job) == 0) {
+            started++;
+        }
+    }
+    encodeWorker(&job);  // The calling thread helps out as well
+    for (int t = 0; t < started; t++) {
+        pthread_join(workers[t], NULL);
+    }
+    pthread_mutex_destroy(&job.lock);
+
+    // Stitch the chunks back together in order
+    size_t total = 0;
+    for (size_t c = 0; c < numChunks; c++) {
+        total += job.chunkOutput[c].length;
+    }
+    reserveGCode(program, total);  // A failure is recorded in the buffer, which the appends then respect
+    for (size_t c = 0; c < numChunks; c++) {
+        appendGCodeBuffer(program, &job.chunkOutput[c]);
+        freeGCodeBuffer(&job.chunkOutput[c]);
+    }
+
+    freeJob(arena, job.chunkOutput);
+    freeJob(arena, workers);
+    freeJob(arena, chunkStarts);
+    return 0;
+}
+
+// Function to end a program: lift the pen if it is still down and return it to the origin (0, 0)
+static void finishProgram(const Layout *layout, GCodeBuffer *program) {
+    if (layout->finalPen != 0) {
+        penMove(layout, 0, 0, 0, -1.0, program);  // Lift and return home
+    } else {
+        appendGCode(program, "G0 X0 Y0\n");
+    }
+}
+
+// Function to turn a layout into a G-code program
+int encodeLayout(const Layout *layout, GCodeBuffer *program, int threads) {
+    if (threads <= 0) {
+        threads = getWorkerCount();
+    }
+
+    if (threads <= 1 || encodeParallel(layout, program, threads) != 0) {
+        encodeItems(layout, 0, layout->count, program);  // Serial path
+    }
+    finishProgram(layout, program);
+    return program->failed ? -1 : 0;
+}
+
+// Function to generate G-code from text input in a font already scaled to the text height; returns -1, with the program marked failed, if it could not be generated in full
+int generateGCodeInFont(const char *text, const LayoutOptions *options, const Font *font, GCodeBuffer *program, int threads) {
+    Layout layout;
+    int result = -1;
+
+    if (layoutText(text, options, font, program->arena, &layout) == 0) {
+        result = encodeLayout(&layout, program, threads);
+    }
+    freeLayout(&layout);
+    if (result != 0) {
+        program->failed = 1;
+    }
+    return result;
+}
+
+// Function to generate G-code from text input in the shared font
+int generateGCode(const char *text, const LayoutOptions *options, GCodeBuffer *program, int threads) {
+    scaleFontData(options->height);  // Scale the font data to match the desired height
+    return generateGCodeInFont(text, options, currentFont(), program, threads);
+}
+
+// One paragraph's G-code, kept between renders
+struct RenderCacheEntry {
+    RenderCacheEntry *next;        // Next entry in the same slot
+    unsigned long long key;        // Hash of the text, the options and the pen it starts with
+    char *text;                    // Copy of the paragraph, so a hash collision is never reused
+    size_t length;
+    int endsLine;                  // 1 if a newline ended it
+    int startPen;
+    int startY;                    // Y of its first line when it was laid out
+    int lowestY;                   // Lowest point reached, relative to startY
+    int lowestLineY;               // Lowest line it wrapped onto, relative to startY (0 for one line)
+    int endPen;
+    int pages;                     // Page breaks inside the paragraph
+    char *gcode;                   // Its G-code, at startY
+    size_t gcodeLength;
+    unsigned long lastUsed;        // Render that last used it
+};
+
+// Function to carry on a 64-bit FNV-1a hash over more bytes
+static unsigned long long hashBytes(unsigned long long hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Function to hash everything in the options that changes the G-code, field by field so padding is left out
+unsigned long long hashLayoutOptions(const LayoutOptions *options) {
+    unsigned long long hash = 14695981039346656037ULL;
+    hash = hashBytes(hash, &options->height, sizeof(options->height));
+    hash = hashBytes(hash, &options->maxLineWidth, sizeof(options->maxLineWidth));
+    hash = hashBytes(hash, &options->lineSpacing, sizeof(options->lineSpacing));
+    hash = hashBytes(hash, &options->leftMargin, sizeof(options->leftMargin));
+    hash = hashBytes(hash, &options->topMargin, sizeof(options->topMargin));
+    hash = hashBytes(hash, &options->pageDepth, sizeof(options->pageDepth));
+    hash = hashBytes(hash, &options->charScale, sizeof(options->charScale));
+    hash = hashBytes(hash, &options->penDown, sizeof(options->penDown));
+    hash = hashBytes(hash, &options->penDwell, sizeof(options->penDwell));
+    hash = hashBytes(hash, &options->liftDwell, sizeof(options->liftDwell));
+    hash = hashBytes(hash, &options->penDrag, sizeof(options->penDrag));
+    hash = hashBytes(hash, &options->foldPen, sizeof(options->foldPen));
+    hash = hashBytes(hash, &options->align, sizeof(options->align));
+    hash = hashBytes(hash, &options->breaking, sizeof(options->breaking));
+    hash = hashBytes(hash, &options->hyphenate, sizeof(options->hyphenate));
+    hash = hashBytes(hash, &options->kerning, sizeof(options->kerning));
+    return hash;
+}
+
+// Function to set up an empty render cache
+void initRenderCache(RenderCache *cache) {
+    memset(cache, 0, sizeof(*cache));
+}
+
+// Function to free one cache entry
+static void freeRenderEntry(RenderCache *cache, RenderCacheEntry *entry) {
+    cache->bytes -= sizeof(*entry) + entry->length + entry->gcodeLength;
+    cache->count--;
+    free(entry->text);
+    free(entry->gcode);
+    free(entry);
+}
+
+// Function to drop the entries no render has used for a while, and all but the last render's when over budget
+static void trimRenderCache(RenderCache *cache) {
+    for (int pass = 0; pass < 2; pass++) {
+        unsigned long keep = pass == 0 ? RENDER_CACHE_RENDERS : 1;
+        if (pass == 1 && cache->bytes <= RENDER_CACHE_BYTES) {
+            break;
+        }
+        for (size_t i = 0; i < cache->numSlots; i++) {
+            RenderCacheEntry **link = &cache->slots[i];
+            while (*link) {
+                RenderCacheEntry *entry = *link;
+                if (entry->lastUsed + keep <= cache->generation) {
+                    *link = entry->next;
+                    freeRenderEntry(cache, entry);
+                } else {
+                    link = &entry->next;
+                }
+            }
+        }
+    }
+}
+
+// Function to release everything a render cache holds
+void freeRenderCache(RenderCache *cache) {
+    for (size_t i = 0; i < cache->numSlots; i++) {
+        while (cache->slots[i]) {
+            RenderCacheEntry *entry = cache->slots[i];
+            cache->slots[i] = entry->next;
+            freeRenderEntry(cache, entry);
+        }
+    }
+    free(cache->slots);
+    initRenderCache(cache);
+}
+
+// Function to look a paragraph up; NULL if it has not been laid out before with these options and starting pen
+static RenderCacheEntry *findRenderEntry(const RenderCache *cache, unsigned long long key, const char *text, size_t length, int endsLine, int startPen) {
+    if (cache->numSlots == 0) {
+        return NULL;
+    }
+    for (RenderCacheEntry *entry = cache->slots[key & (cache->numSlots - 1)]; entry; entry = entry->next) {
+        if (entry->key == key && entry->length == length && entry->endsLine == endsLine && entry->startPen == startPen &&
+            memcmp(entry->text, text, length) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Function to add a new entry, doubling the slots when they fill up; returns NULL, leaving the paragraph uncached, if it cannot
+static RenderCacheEntry *addRenderEntry(RenderCache *cache, unsigned long long key, const char *text, size_t length, size_t gcodeLength) {
+    if (cache->bytes + sizeof(RenderCacheEntry) + length + gcodeLength > RENDER_CACHE_BYTES) {
+        return NULL;
+    }
+    if (cache->count >= cache->numSlots) {
+        size_t numSlots = cache->numSlots ? cache->numSlots * 2 : 256;
+        RenderCacheEntry **slots = calloc(numSlots, sizeof(RenderCacheEntry *));
+        if (!slots) {
+            return NULL;
+        }
+        for (size_t i = 0; i < cache->numSlots; i++) {
+            while (cache->slots[i]) {
+                RenderCacheEntry *entry = cache->slots[i];
+                cache->slots[i] = entry->next;
+                entry->next = slots[entry->key & (numSlots - 1)];
+                slots[entry->key & (numSlots - 1)] = entry;
+            }
+        }
+        free(cache->slots);
+        cache->slots = slots;
+        cache->numSlots = numSlots;
+    }
+
+    RenderCacheEntry *entry = calloc(1, sizeof(RenderCacheEntry));
+    char *textCopy = malloc(length ? length : 1);
+    char *gcode = malloc(gcodeLength ? gcodeLength : 1);
+    if (!entry || !textCopy || !gcode) {
+        free(entry);
+        free(textCopy);
+        free(gcode);
+        return NULL;
+    }
+    memcpy(textCopy, text, length);
+    entry->key = key;
+    entry->text = textCopy;
+    entry->length = length;
+    entry->gcode = gcode;
+    entry->gcodeLength = gcodeLength;
+    entry->next = cache->slots[key & (cache->numSlots - 1)];
+    cache->slots[key & (cache->numSlots - 1)] = entry;
+    cache->count++;
+    cache->bytes += sizeof(RenderCacheEntry) + length + gcodeLength;
+    return entry;
+}
+
+// Function to write an integer in decimal without going through printf; returns the number of characters
+static int formatInt(char *out, int value) {
+    char digits[12];
+    int numDigits = 0;
+    int length = 0;
+    unsigned int magnitude = value < 0 ? 0u - (unsigned int)value : (unsigned int)value;
+    do {
+        digits[numDigits++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (value < 0) {
+        out[length++] = '-';
+    }
+    while (numDigits > 0) {
+        out[length++] = digits[--numDigits];
+    }
+    return length;
+}
+
+// Function to copy a paragraph's G-code moved down (or up) the page: only the Y of each move changes
+static void appendShifted(GCodeBuffer *program, const char *gcode, size_t length, int delta) {
+    for (size_t start = 0; start < length; ) {
+        const char *line = gcode + start;
+        const char *end = memchr(line, '\n', length - start);
+        size_t lineLength = (size_t)(end - line) + 1;
+        if (reserveGCode(program, lineLength + 12) != 0) {
+            return;
+        }
+        char *out = program->data + program->length;
+        const char *y = line[0] == 'G' && (line[1] == '0' || line[1] == '1') && line[2] == ' ' ? memchr(line, 'Y', lineLength) : NULL;
+        if (y) {
+            size_t prefix = (size_t)(y - line) + 1;
+            char *rest;
+            memcpy(out, line, prefix);
+            int outLength = (int)prefix + formatInt(out + prefix, (int)strtol(y + 1, &rest, 10) + delta);
+            size_t restLength = lineLength - (size_t)(rest - line);  // A pen word folded onto the move, and the newline
+            memcpy(out + outLength, rest, restLength);
+            program->length += (size_t)outLength + restLength;
+        } else {
+            memcpy(out, line, lineLength);
+            program->length += lineLength;
+        }
+        start += lineLength;
+    }
+    program->data[program->length] = '\0';
+}
+
+// Function to generate G-code like generateGCode, but reusing the G-code of paragraphs the cache has seen before
+int generateGCodeCached(const char *text, const LayoutOptions *options, RenderCache *cache, GCodeBuffer *program) {
+    Layout layout;
+    Paragraph paragraph;
+    LineSetter setter;
+    unsigned long long optionsHash = hashLayoutOptions(options);
+
+    scaleFontData(options->height);
+    startLayout(options, currentFont(), program->arena, &layout, &setter, &paragraph);
+    cache->generation++;
+    cache->reused = cache->moved = cache->laidOut = 0;
+
+    for (const char *ptr = text; *ptr != '\0' && !layout.failed && !program->failed; ) {
+        const char *end = strchr(ptr, '\n');
+        size_t length = end ? (size_t)(end - ptr) : strlen(ptr);
+        int endsLine = end != NULL;
+        int startY = setter.y_pos;
+        int startPen = setter.penState;
+        unsigned long long key = hashBytes(hashBytes(optionsHash, &startPen, sizeof(startPen)), ptr, length);
+        RenderCacheEntry *entry = findRenderEntry(cache, key, ptr, length, endsLine, startPen);
+
+        // A paragraph seen before is copied as it was, or moved if it has to start higher or lower and no page break gets in the way
+        if (entry && (entry->startY == startY || (entry->pages == 0 && startY + entry->lowestLineY >= setter.minY))) {
+            if (entry->startY == startY) {
+                appendGCodeText(program, entry->gcode, entry->gcodeLength);
+                cache->reused++;
+            } else {
+                appendShifted(program, entry->gcode, entry->gcodeLength, startY - entry->startY);
+                cache->moved++;
+            }
+            setter.lowestY = startY + entry->lowestY;
+            setter.penState = entry->endPen;
+            layout.pages += entry->pages;
+            entry->lastUsed = cache->generation;
+        } else {
+            size_t programStart = program->length;
+            int pages = layout.pages;
+            layout.count = 0;
+            layoutParagraph(&setter, ptr, length, endsLine);
+            encodeItems(&layout, 0, layout.count, program);
+            cache->laidOut++;
+
+            if (!layout.failed && !program->failed) {
+                int lowestLineY = 0;
+                for (size_t i = 0; i < layout.count; i++) {
+                    if (layout.items[i].type == ITEM_NEWLINE && layout.items[i].y - startY < lowestLineY) {
+                        lowestLineY = layout.items[i].y - startY;
+                    }
+                }
+                size_t gcodeLength = program->length - programStart;
+                if (!entry) {
+                    entry = addRenderEntry(cache, key, ptr, length, gcodeLength);
+                } else if (entry->gcodeLength != gcodeLength) {
+                    char *gcode = realloc(entry->gcode, gcodeLength ? gcodeLength : 1);
+                    if (gcode) {
+                        cache->bytes = cache->bytes + gcodeLength - entry->gcodeLength;
+                        entry->gcode = gcode;
+                        entry->gcodeLength = gcodeLength;
+                    } else {
+                        entry = NULL;  // Keep the old one; it still matches its own starting point
+                    }
+                }
+                if (entry) {
+                    memcpy(entry->gcode, program->data + programStart, gcodeLength);
+                    entry->endsLine = endsLine;
+                    entry->startPen = startPen;
+                    entry->startY = startY;
+                    entry->lowestY = setter.lowestY - startY;
+                    entry->lowestLineY = lowestLineY;
+                    entry->endPen = setter.penState;
+                    entry->pages = layout.pages - pages;
+                    entry->lastUsed = cache->generation;
+                }
+            }
+        }
+        if (!end) {
+            break;
+        }
+
+        // The newline between paragraphs depends on where the last one ended, so it is always worked out afresh
+        layout.count = 0;
+        layoutNewLine(&layout, &setter.x_pos, &setter.y_pos, &setter.penState, &setter.lowestY, setter.lineGap, setter.minY, setter.firstLineY);
+        encodeItems(&layout, 0, layout.count, program);
+        ptr = end + 1;
+    }
+
+    layout.finalPen = setter.penState;
+    if (!layout.failed) {
+        finishProgram(&layout, program);
+    }
+    int failed = layout.failed || program->failed;  // freeLayout() clears the layout
+    freeParagraph(&paragraph);
+    freeLayout(&layout);
+    trimRenderCache(cache);
+    if (failed) {
+        program->failed = 1;
+        return -1;
+    }
+    return 0;
+}
+
+// Function to pick the words out of the line at the start of a program fragment
+size_t parseGCodeLine(const char *line, size_t length, GCodeWords *words) {
+    const char *end = memchr(line, '\n', length);
+    size_t lineLength = end ? (size_t)(end - line) : length;
+
+    memset(words, 0, sizeof(*words));
+    words->g = -1;
+    words->m = -1;
+    for (const char *ptr = line; ptr < line + lineLength; ) {
+        char letter = *ptr++;
+        char *after;
+        double value = strtod(ptr, &after);
+        if (after == ptr || after > line + lineLength) {
+            continue;
+        }
+        ptr = after;
+        switch (letter) {
+        case 'G': words->g = (int)value; break;
+        case 'M': words->m = (int)value; break;
+        case 'X': words->x = value; words->hasX = 1; break;
+        case 'Y': words->y = value; words->hasY = 1; break;
+        case 'F': words->f = value; words->hasF = 1; break;
+        case 'S': words->s = value; words->hasS = 1; break;
+        case 'P': words->p = value; words->hasP = 1; break;
+        default: break;
+        }
+    }
+    return lineLength;
+}
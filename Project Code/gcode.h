@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stddef.h>
+#include "arena.h"
+#include "font.h"
+
+
+#ifndef GCODE_H_INCLUDED
+#define GCODE_H_INCLUDED
+
+
+#define RENDER_CACHE_BYTES (64 * 1024 * 1024)  // Most paragraph G-code a render cache holds
+#define RENDER_CACHE_RENDERS 4                 // Paragraphs unused for this many renders are dropped
+
+// Growable text buffer holding a generated G-code program
+typedef struct {
+    char *data;        // Program text, always null-terminated
+    size_t length;     // Number of characters in use
+    size_t capacity;   // Number of characters allocated
+    int failed;        // Set if memory ran out; the program is incomplete and must not be sent
+    Arena *arena;      // Job arena the text lives in, NULL for the heap
+} GCodeBuffer;
+
+// Where lines sit between the margins
+typedef enum {
+    ALIGN_LEFT,
+    ALIGN_CENTRE,
+    ALIGN_RIGHT,
+    ALIGN_JUSTIFY       // Spread the words to both margins, except on the last line of a paragraph
+} TextAlign;
+
+// How a paragraph is broken into lines
+typedef enum {
+    BREAK_GREEDY,       // Fill each line as far as it goes
+    BREAK_OPTIMAL       // Choose all the breaks together for the most even right edge
+} LineBreaking;
+
+// Options controlling how text is placed on the page
+typedef struct {
+    float height;        // Text height in mm
+    int maxLineWidth;    // Maximum width of a line in mm
+    int lineSpacing;     // Extra gap between lines in mm, on top of the text height
+    int leftMargin;      // X where every line starts, in mm
+    int topMargin;       // Gap above the first line, in mm
+    int pageDepth;       // How far below the first line a new line may start before the page is full, in mm
+    float charScale;     // Character advance as a fraction of the height
+    int penDown;         // Spindle value (S) that lowers the pen
+    float penDwell;      // Seconds to wait for the pen to land after lowering it, 0 for none
+    float liftDwell;     // Seconds to wait for the pen to clear the paper after lifting it, 0 for none
+    float penDrag;       // Hops inside a glyph up to this long in mm are drawn without lifting, 0 for never
+    int foldPen;         // 1 to put pen changes on the move that follows, for controllers that take S on a move
+    TextAlign align;
+    LineBreaking breaking;
+    int hyphenate;       // 1 to split words across lines at syllable boundaries
+    int kerning;         // 1 to space glyphs by their ink and the font's kerning pairs instead of fixed cells
+} LayoutOptions;
+
+// Kinds of item produced by the layout pass
+typedef enum {
+    ITEM_WORD,       // Draw a word starting at (x, y)
+    ITEM_NEWLINE,    // Move to the start of the line at y
+    ITEM_PAGE        // Lift the pen, park and pause for a fresh sheet
+} LayoutItemType;
+
+// One placed word or carriage movement, with everything needed to encode it on its own
+typedef struct {
+    LayoutItemType type;
+    const char *word;   // Start of the word in the source text (ITEM_WORD only)
+    int length;         // Number of characters in the word
+    int x;              // X origin of the word
+    int y;              // Y origin of the word, or Y of the new line
+    int penState;       // Pen state before this item is drawn
+    int hyphen;         // 1 if a hyphen is drawn after the word (ITEM_WORD only)
+} LayoutItem;
+
+// Result of the layout pass over a whole text
+typedef struct {
+    LayoutItem *items;
+    size_t count;
+    size_t capacity;
+    int charWidth;      // Character advance used for the text
+    int leftMargin;     // X where every line starts
+    int penDown;        // Spindle value that lowers the pen
+    float penDwell;     // Pause after lowering the pen, in seconds
+    float liftDwell;    // Pause after lifting it, when the travel that follows is longer than penDrag
+    float penDrag;      // Longest hop inside a glyph drawn with the pen down, in mm
+    int foldPen;        // Pen changes ride on the next move
+    int kerning;        // Glyphs are spaced by their ink and kerning pairs
+    int glyphGap;       // Gap between kerned glyphs
+    int finalPen;       // Pen state after the last item
+    int pages;          // Number of pages the text covers
+    int failed;         // Set if memory ran out part way through
+    const Font *font;   // Glyphs at the text height
+    Arena *arena;       // Job arena the items live in, NULL for the heap
+} Layout;
+
+typedef struct RenderCacheEntry RenderCacheEntry;
+
+/*
+ A render cache keeps the G-code of each paragraph (the text between two
+ newlines) across renders, keyed by a hash of its text, the layout options and
+ the pen state it starts in. generateGCodeCached() only lays out and encodes
+ paragraphs the cache has not seen; the rest are copied, and if an edit above
+ has moved them up or down the page, only the Y of their moves is rewritten.
+ A paragraph is laid out again if the move would bring a page break into it
+ or out of it. The output is the same as generateGCode()'s.
+
+ The cache assumes the font does not change while it is in use.
+*/
+
+// Paragraph G-code kept between renders of edited documents
+typedef struct {
+    RenderCacheEntry **slots;   // Hash table of entries, chained
+    size_t numSlots;            // Power of two
+    size_t count;
+    size_t bytes;               // Memory held by the entries
+    unsigned long generation;   // Number of renders so far
+    long reused, moved, laidOut;    // Paragraphs copied, shifted and laid out by the last render
+} RenderCache;
+
+// Words picked out of one line of G-code
+typedef struct {
+    int g;             // G number, or -1 if the line has none
+    int m;             // M number, or -1 if the line has none
+    int hasX, hasY, hasF, hasS, hasP;
+    double x, y, f, s, p;
+} GCodeWords;
+
+void initGCodeBuffer(GCodeBuffer *buffer);
+void initGCodeBufferInArena(GCodeBuffer *buffer, Arena *arena);     // The text is freed with the arena
+void freeGCodeBuffer(GCodeBuffer *buffer);
+void appendGCode(GCodeBuffer *buffer, const char *format, ...);     // printf-style append
+void appendGCodeText(GCodeBuffer *buffer, const char *text, size_t length);  // Append text as it is
+void appendGCodeBuffer(GCodeBuffer *buffer, const GCodeBuffer *other);
+
+void defaultLayoutOptions(LayoutOptions *options, float height);
+int measureWord(const Layout *layout, const char *word, int length);   // Advance of a word in mm
+int layoutText(const char *text, const LayoutOptions *options, const Font *font, Arena *arena, Layout *layout);    // Find line and page boundaries, font scaled to the text height, arena may be NULL; returns 0 on success
+void freeLayout(Layout *layout);
+int encodeLayout(const Layout *layout, GCodeBuffer *program, int threads);   // Turn a layout into G-code, returns 0 on success
+void processWord(const char *word, int length, int x_pos, int y_pos, int *penState, const Layout *layout, GCodeBuffer *out);
+int generateGCode(const char *text, const LayoutOptions *options, GCodeBuffer *program, int threads);   // threads: 0 = all cores, 1 = serial; works in the program's arena; returns 0 on success
+int generateGCodeInFont(const char *text, const LayoutOptions *options, const Font *font, GCodeBuffer *program, int threads);   // The same with a font of the caller's, already scaled; touches nothing shared
+unsigned long long hashLayoutOptions(const LayoutOptions *options);    // 64-bit FNV-1a of every option that changes the G-code
+void initRenderCache(RenderCache *cache);
+void freeRenderCache(RenderCache *cache);
+int generateGCodeCached(const char *text, const LayoutOptions *options, RenderCache *cache, GCodeBuffer *program);   // Serial, reuses cached paragraphs; returns 0 on success
+int getWorkerCount(void);                                           // Number of cores available for encoding
+size_t parseGCodeLine(const char *line, size_t length, GCodeWords *words);  // Returns the length of the line, without its newline
+
+#endif // GCODE_H_INCLUDED
@@ -0,0 +1,251 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "gcodefile.h"
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#include <windows.h>
+#endif
+
+// Read-only view of a whole file
+typedef struct {
+    const char *data;
+    size_t size;
+#if defined(__linux__) || defined(__FreeBSD__)
+    int fd;
+#else
+    HANDLE file;
+    HANDLE mapping;
+#endif
+} MappedFile;
+
+#if defined(__linux__) || defined(__FreeBSD__)
+
+// Function to map a file into memory; returns -1 with a message if it cannot
+static int mapFile(const char *filename, MappedFile *mapped) {
+    struct stat info;
+
+    memset(mapped, 0, sizeof(*mapped));
+    mapped->fd = open(filename, O_RDONLY);
+    if (mapped->fd < 0 || fstat(mapped->fd, &info) != 0) {
+        printf("Error opening file: %s\n", filename);
+        if (mapped->fd >= 0) {
+            close(mapped->fd);
+        }
+        return -1;
+    }
+    mapped->size = (size_t)info.st_size;
+    if (mapped->size == 0) {
+        return 0;  // Nothing to map, and mmap refuses a length of 0
+    }
+    void *data = mmap(NULL, mapped->size, PROT_READ, MAP_PRIVATE, mapped->fd, 0);
+    if (data == MAP_FAILED) {
+        printf("Error: Unable to map %s into memory\n", filename);
+        close(mapped->fd);
+        return -1;
+    }
+    madvise(data, mapped->size, MADV_SEQUENTIAL);  // Read once from front to back
+    mapped->data = data;
+    return 0;
+}
+
+// Function to release a mapped file
+static void unmapFile(MappedFile *mapped) {
+    if (mapped->data) {
+        munmap((void *)mapped->data, mapped->size);
+    }
+    close(mapped->fd);
+}
+
+#else
+
+// Function to map a file into memory; returns -1 with a message if it cannot
+static int mapFile(const char *filename, MappedFile *mapped) {
+    LARGE_INTEGER size;
+
+    memset(mapped, 0, sizeof(*mapped));
+    mapped->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (mapped->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(mapped->file, &size)) {
+        printf("Error opening file: %s\n", filename);
+        if (mapped->file != INVALID_HANDLE_VALUE) {
+            CloseHandle(mapped->file);
+        }
+        return -1;
+    }
+    mapped->size = (size_t)size.QuadPart;
+    if (mapped->size == 0) {
+        return 0;
+    }
+    mapped->mapping = CreateFileMappingA(mapped->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    mapped->data = mapped->mapping ? MapViewOfFile(mapped->mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (!mapped->data) {
+        printf("Error: Unable to map %s into memory\n", filename);
+        if (mapped->mapping) {
+            CloseHandle(mapped->mapping);
+        }
+        CloseHandle(mapped->file);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to release a mapped file
+static void unmapFile(MappedFile *mapped) {
+    if (mapped->data) {
+        UnmapViewOfFile(mapped->data);
+        CloseHandle(mapped->mapping);
+    }
+    CloseHandle(mapped->file);
+}
+
+#endif
+
+// Function to measure the number at the start of a word's value: a sign, digits and at most one point; 0 if there is none
+static int numberLength(const char *text) {
+    int length = (text[0] == '-' || text[0] == '+') ? 1 : 0;
+    int digits = 0, points = 0;
+    for (; isdigit((unsigned char)text[length]) || (text[length] == '.' && points++ == 0); length++) {
+        digits += isdigit((unsigned char)text[length]) != 0;
+    }
+    return digits > 0 ? length : 0;
+}
+
+// Function to check a G word against the modes the checkpoint and estimate can follow: absolute millimetre straight moves and dwells
+static int supportedGWord(const char *word) {
+    static const double supported[] = { 0, 1, 4, 17, 21, 90, 94 };
+    double value = atof(word + 1);
+    for (size_t i = 0; i < sizeof(supported) / sizeof(supported[0]); i++) {
+        if (value == supported[i]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Function to strip one line down to what GRBL needs; returns its new length, or -1 with the reason if it is not valid G-code
+static int cleanGCodeLine(const char *line, size_t length, char *out, const char **problem) {
+    char compact[GCODE_LINE_MAX * 4];
+    int used = 0;
+    int inComment = 0;
+
+    // Drop comments and whitespace first, so words split by spaces come back together
+    for (size_t i = 0; i < length; i++) {
+        char c = line[i];
+        if (inComment) {
+            inComment = c != ')';
+        } else if (c == '(') {
+            inComment = 1;
+        } else if (c == ';') {
+            break;  // The rest of the line is a comment
+        } else if (!isspace((unsigned char)c)) {
+            if (used >= (int)sizeof(compact) - 1) {
+                *problem = "too long for GRBL";
+                return -1;
+            }
+            compact[used++] = (char)toupper((unsigned char)c);
+        }
+    }
+    compact[used] = '\0';
+    if (inComment) {
+        *problem = "unclosed comment";
+        return -1;
+    }
+    if (compact[0] == '$') {
+        if (used >= GCODE_LINE_MAX) {
+            *problem = "too long for GRBL";
+            return -1;
+        }
+        memcpy(out, compact, (size_t)used + 1);
+        return used;  // GRBL setting or command, sent as it is
+    }
+    if (used == 0 || strcmp(compact, "%") == 0) {
+        return 0;  // Blank, comment only or a tape marker
+    }
+
+    // Every word is a letter GRBL knows followed by a number; words go out one space apart, as generated programs are
+    int outLength = 0;
+    for (int i = 0; i < used; ) {
+        if (!strchr("GMXYZABCFSPTNIJKRL", compact[i])) {
+            *problem = isalpha((unsigned char)compact[i]) ? "unknown word" : "expected a letter";
+            return -1;
+        }
+        int number = numberLength(compact + i + 1);
+        if (number == 0) {
+            *problem = "word without a number";
+            return -1;
+        }
+        int wordLength = number + 1;
+        if (compact[i] == 'G' && !supportedGWord(compact + i)) {
+            *problem = "only G0, G1, G4, G17, G21, G90 and G94 can be resumed and estimated";
+            return -1;
+        }
+        if (outLength + (outLength > 0) + wordLength >= GCODE_LINE_MAX) {
+            *problem = "too long for GRBL";
+            return -1;
+        }
+        if (outLength > 0) {
+            out[outLength++] = ' ';
+        }
+        memcpy(out + outLength, compact + i, (size_t)wordLength);
+        outLength += wordLength;
+        i += wordLength;
+    }
+    out[outLength] = '\0';
+    return outLength;
+}
+
+// Function to map a G-code file and turn it into a program ready to send
+int loadGCodeFile(const char *filename, Arena *arena, GCodeBuffer *program, GCodeFileInfo *info) {
+    MappedFile mapped;
+
+    memset(info, 0, sizeof(*info));
+    initGCodeBufferInArena(program, arena);
+    if (mapFile(filename, &mapped) != 0) {
+        return -1;
+    }
+    info->fileBytes = mapped.size;
+
+    for (size_t start = 0; start < mapped.size; ) {
+        const char *line = mapped.data + start;
+        const char *end = memchr(line, '\n', mapped.size - start);
+        size_t lineLength = end ? (size_t)(end - line) : mapped.size - start;
+        char cleaned[GCODE_LINE_MAX];
+        const char *problem = NULL;
+
+        info->fileLines++;
+        int cleanedLength = cleanGCodeLine(line, lineLength, cleaned, &problem);
+        if (cleanedLength < 0) {
+            if (++info->invalidLines <= GCODE_MAX_ERRORS) {
+                printf("Error: %s line %ld: %s: %.*s\n", filename, info->fileLines, problem,
+                       (int)(lineLength < 60 ? lineLength : 60), line);
+            }
+        } else if (cleanedLength > 0 && info->invalidLines == 0) {
+            appendGCode(program, "%s\n", cleaned);
+            info->lines++;
+        }
+        start += lineLength + 1;
+    }
+    unmapFile(&mapped);
+
+    if (info->invalidLines > 0) {
+        printf("Error: %s has %ld invalid line%s; nothing was sent\n", filename, info->invalidLines, info->invalidLines == 1 ? "" : "s");
+        return -1;
+    }
+    if (program->failed) {
+        return -1;
+    }
+    if (info->lines == 0) {
+        printf("Error: %s has no G-code in it\n", filename);
+        return -1;
+    }
+    printf("Read %s: %ld lines, %zu bytes, %zu bytes to send after removing comments and spaces\n",
+           filename, info->lines, info->fileBytes, program->length);
+    return 0;
+}
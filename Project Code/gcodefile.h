@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include <stddef.h>
+#include "arena.h"
+#include "gcode.h"
+
+
+#ifndef GCODEFILE_H_INCLUDED
+#define GCODEFILE_H_INCLUDED
+
+
+#define GCODE_LINE_MAX 80           // Longest line GRBL takes, counting its newline
+#define GCODE_MAX_ERRORS 10         // Invalid lines reported before giving up on the rest
+
+/*
+ A G-code file from another program (--gcode <file>) is mapped into memory and
+ read once. Each line loses its comments, "(...)" and "; ...", and its extra
+ whitespace, and letters are made upper case, so "g1  x 10.5 y2 ; edge" is
+ sent as "G1 X10.5 Y2". Words stay one space apart, the form the checkpoint
+ and estimate parsers read. Blank lines and "%" tape markers are dropped, and
+ "$" lines are passed through as they are.
+
+ What is left must be words GRBL knows, a letter then a number, and must fit
+ GRBL's line buffer. A resumed job is put back with absolute millimetre moves
+ and the estimate treats every move as a straight line, so only the G words
+ for those are taken: G0, G1, G4, G17, G21, G90 and G94. Relative moves (G91),
+ inches (G20), arcs (G2, G3) and offsets (G92) are invalid lines. A file
+ with any invalid line is rejected before anything is sent, with the first
+ few problems and their line numbers.
+*/
+
+// What importing a G-code file did
+typedef struct {
+    size_t fileBytes;           // Size of the file
+    long fileLines;
+    long lines;                 // Lines left to send
+    long invalidLines;
+} GCodeFileInfo;
+
+int loadGCodeFile(const char *filename, Arena *arena, GCodeBuffer *program, GCodeFileInfo *info);  // Clean and check a file into the program; 0 if every line was valid
+
+#endif // GCODEFILE_H_INCLUDED
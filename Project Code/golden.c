@@ -0,0 +1,349 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "font.h"
+#include "gcode.h"
+#include "golden.h"
+#include "profile.h"
+
+// One case from the manifest
+typedef struct {
+    char textFile[256];
+    float height;
+    char fontFile[256];
+    char goldenFile[256];
+    double tolerance;
+    char options[256];      // key=value layout options after the tolerance, empty for the defaults
+} GoldenCase;
+
+// A pen-down stroke from one point to another
+typedef struct {
+    double x0, y0, x1, y1;
+} Stroke;
+
+// Function to read the next case from a manifest; returns 0 at the end of the file
+static int readGoldenCase(FILE *manifest, GoldenCase *testCase) {
+    char line[1024];
+    while (fgets(line, sizeof(line), manifest)) {
+        int used = 0;
+        testCase->tolerance = 0.0;
+        testCase->options[0] = '\0';
+        if (line[0] != '#' &&
+            sscanf(line, "%255s %f %255s %255s %lf%n", testCase->textFile, &testCase->height, testCase->fontFile,
+                   testCase->goldenFile, &testCase->tolerance, &used) >= 4) {
+            if (used > 0) {
+                snprintf(testCase->options, sizeof(testCase->options), "%s", line + used);
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Function to apply a case's key=value options on top of the default layout; returns -1 if one is not understood
+static int applyCaseOptions(const char *list, LayoutOptions *options) {
+    char key[64], value[64];
+    int used;
+
+    while (sscanf(list, " %63[^= \t\r\n]=%63s%n", key, value, &used) == 2) {
+        list += used;
+        int result = setTextOption(options, key, value);
+        float number = (float)atof(value);
+        if (result == 0) {
+            continue;
+        } else if (result < 0) {
+            return -1;
+        } else if (strcmp(key, "fold_pen") == 0) {
+            options->foldPen = number != 0.0f;
+        } else if (strcmp(key, "pen_drag") == 0) {
+            options->penDrag = number;
+        } else if (strcmp(key, "dwell") == 0) {
+            options->penDwell = number;
+        } else if (strcmp(key, "lift_dwell") == 0) {
+            options->liftDwell = number;
+        } else if (strcmp(key, "kerning") == 0) {
+            options->kerning = number != 0.0f;
+        } else {
+            printf("Error: Unknown golden case option %s\n", key);
+            return -1;
+        }
+    }
+    if (list[strspn(list, " \t\r\n")] != '\0') {
+        printf("Error: Golden case options must be key=value: %s", list);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to generate the program for a case, loading the font only when it changes; returns 0 on success
+static int generateCase(const GoldenCase *testCase, GCodeBuffer *program) {
+    static char loadedFont[256] = "";
+    initGCodeBuffer(program);
+    if (strcmp(loadedFont, testCase->fontFile) != 0) {
+        loadedFont[0] = '\0';
+        if (loadFontData(testCase->fontFile) != 0) {
+            return -1;
+        }
+        snprintf(loadedFont, sizeof(loadedFont), "%s", testCase->fontFile);
+    }
+
+    char *text = readTextFile(testCase->textFile);
+    if (!text) {
+        return -1;
+    }
+    LayoutOptions options;
+    defaultLayoutOptions(&options, testCase->height);
+    int result = applyCaseOptions(testCase->options, &options) == 0 ? generateGCode(text, &options, program, 0) : -1;
+    free(text);
+    return result;
+}
+
+// Function to write a buffer to a file
+static int writeWholeFile(const char *filename, const char *data, size_t length) {
+    FILE *file = fopen(filename, "wb");
+    if (!file) {
+        printf("Error opening file: %s\n", filename);
+        return -1;
+    }
+    size_t written = fwrite(data, 1, length, file);
+    fclose(file);
+    return written == length ? 0 : -1;
+}
+
+// Function to pull the pen-down strokes out of a program
+static Stroke *extractStrokes(const char *program, size_t length, int *numStrokes) {
+    int capacity = 256;
+    Stroke *strokes = malloc((size_t)capacity * sizeof(Stroke));
+    double x = 0.0, y = 0.0;
+    int penDown = 0;
+
+    *numStrokes = 0;
+    for (size_t offset = 0; strokes && offset < length; ) {
+        GCodeWords words;
+        offset += parseGCodeLine(program + offset, length - offset, &words) + 1;
+
+        int g = words.g;
+        double newX = words.hasX ? words.x : x, newY = words.hasY ? words.y : y;
+        if (words.hasS) {
+            penDown = words.s > 0.0;
+        }
+
+        if ((g == 0 || g == 1) && penDown && (newX != x || newY != y)) {
+            if (*numStrokes == capacity) {
+                capacity *= 2;
+                Stroke *bigger = realloc(strokes, (size_t)capacity * sizeof(Stroke));
+                if (!bigger) {
+                    free(strokes);
+                    return NULL;
+                }
+                strokes = bigger;
+            }
+            strokes[(*numStrokes)++] = (Stroke){x, y, newX, newY};
+        }
+        x = newX;
+        y = newY;
+    }
+    return strokes;
+}
+
+// Function to check whether two strokes match to within the tolerance
+static int strokesMatch(const Stroke *a, const Stroke *b, double tolerance) {
+    return fabs(a->x0 - b->x0) <= tolerance && fabs(a->y0 - b->y0) <= tolerance &&
+           fabs(a->x1 - b->x1) <= tolerance && fabs(a->y1 - b->y1) <= tolerance;
+}
+
+// Function to draw expected and actual strokes over each other so the difference can be seen
+static void writeComparisonSvg(const char *filename, const Stroke *expected, int numExpected, const Stroke *actual, int numActual) {
+    FILE *file = fopen(filename, "w");
+    double minX = 0.0, maxX = 1.0, minY = 0.0, maxY = 1.0;
+    if (!file) {
+        printf("Error opening file: %s\n", filename);
+        return;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        const Stroke *strokes = pass ? actual : expected;
+        int count = pass ? numActual : numExpected;
+        for (int i = 0; i < count; i++) {
+            minX = fmin(minX, fmin(strokes[i].x0, strokes[i].x1));
+            maxX = fmax(maxX, fmax(strokes[i].x0, strokes[i].x1));
+            minY = fmin(minY, fmin(strokes[i].y0, strokes[i].y1));
+            maxY = fmax(maxY, fmax(strokes[i].y0, strokes[i].y1));
+        }
+    }
+
+    // G-code Y grows up the page, SVG Y grows down it
+    fprintf(file, "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"%g %g %g %g\" width=\"%gmm\" height=\"%gmm\">\n",
+            minX - 2.0, -maxY - 2.0, maxX - minX + 4.0, maxY - minY + 4.0, maxX - minX + 4.0, maxY - minY + 4.0);
+    fprintf(file, "<g stroke=\"#1f5fbf\" stroke-width=\"0.6\" stroke-opacity=\"0.6\" stroke-linecap=\"round\">\n");
+    for (int i = 0; i < numExpected; i++) {
+        fprintf(file, "<line x1=\"%g\" y1=\"%g\" x2=\"%g\" y2=\"%g\"/>\n", expected[i].x0, 0.0 - expected[i].y0, expected[i].x1, 0.0 - expected[i].y1);
+    }
+    fprintf(file, "</g>\n<g stroke=\"#d62020\" stroke-width=\"0.25\" stroke-linecap=\"round\">\n");
+    for (int i = 0; i < numActual; i++) {
+        fprintf(file, "<line x1=\"%g\" y1=\"%g\" x2=\"%g\" y2=\"%g\"/>\n", actual[i].x0, 0.0 - actual[i].y0, actual[i].x1, 0.0 - actual[i].y1);
+    }
+    fprintf(file, "</g>\n</svg>\n");
+    fclose(file);
+}
+
+// Function to compare two programs line for line, writing the differences to the diff file
+static int compareExact(FILE *diff, const char *expected, size_t expectedLength, const char *actual, size_t actualLength) {
+    size_t e = 0, a = 0;
+    long lineNumber = 1;
+    int differences = 0;
+
+    while ((e < expectedLength || a < actualLength) && differences < GOLDEN_MAX_DIFFS) {
+        const char *expectedEnd = e < expectedLength ? memchr(expected + e, '\n', expectedLength - e) : NULL;
+        const char *actualEnd = a < actualLength ? memchr(actual + a, '\n', actualLength - a) : NULL;
+        size_t expectedLine = e < expectedLength ? (expectedEnd ? (size_t)(expectedEnd - (expected + e)) : expectedLength - e) : 0;
+        size_t actualLine = a < actualLength ? (actualEnd ? (size_t)(actualEnd - (actual + a)) : actualLength - a) : 0;
+
+        if (expectedLine != actualLine || e >= expectedLength || a >= actualLength || memcmp(expected + e, actual + a, expectedLine) != 0) {
+            fprintf(diff, "line %ld:\n  - %.*s\n  + %.*s\n", lineNumber,
+                    e < expectedLength ? (int)expectedLine : 16, e < expectedLength ? expected + e : "(end of program)",
+                    a < actualLength ? (int)actualLine : 16, a < actualLength ? actual + a : "(end of program)");
+            if (e >= expectedLength || a >= actualLength) {
+                fprintf(diff, "  (programs differ in length)\n");
+            }
+            differences++;
+        }
+        e = e < expectedLength ? e + expectedLine + 1 : e;
+        a = a < actualLength ? a + actualLine + 1 : a;
+        lineNumber++;
+    }
+    return differences;
+}
+
+// Function to compare the pen-down strokes of two programs within a tolerance
+static int compareStrokes(FILE *diff, const Stroke *expected, int numExpected, const Stroke *actual, int numActual, double tolerance) {
+    int differences = 0;
+    int count = numExpected > numActual ? numExpected : numActual;
+
+    if (numExpected != numActual) {
+        fprintf(diff, "stroke count: expected %d, got %d\n", numExpected, numActual);
+        differences++;
+    }
+    for (int i = 0; i < count && differences < GOLDEN_MAX_DIFFS; i++) {
+        if (i >= numExpected || i >= numActual || !strokesMatch(&expected[i], &actual[i], tolerance)) {
+            fprintf(diff, "stroke %d:\n", i + 1);
+            if (i < numExpected) {
+                fprintf(diff, "  - (%g, %g) -> (%g, %g)\n", expected[i].x0, expected[i].y0, expected[i].x1, expected[i].y1);
+            }
+            if (i < numActual) {
+                fprintf(diff, "  + (%g, %g) -> (%g, %g)\n", actual[i].x0, actual[i].y0, actual[i].x1, actual[i].y1);
+            }
+            differences++;
+        }
+    }
+    return differences;
+}
+
+// Function to run one case against its golden program; returns 1 if it passes
+static int checkGoldenCase(const GoldenCase *testCase) {
+    char path[300];
+    GCodeBuffer program;
+    if (generateCase(testCase, &program) != 0) {
+        printf("FAIL %s: unable to generate a program\n", testCase->textFile);
+        freeGCodeBuffer(&program);
+        return 0;
+    }
+
+    FILE *goldenFile = fopen(testCase->goldenFile, "rb");
+    if (!goldenFile) {
+        printf("FAIL %s: no golden program %s (run --golden-record)\n", testCase->textFile, testCase->goldenFile);
+        freeGCodeBuffer(&program);
+        return 0;
+    }
+    fclose(goldenFile);
+    char *golden = readTextFile(testCase->goldenFile);
+    if (!golden) {
+        freeGCodeBuffer(&program);
+        return 0;
+    }
+    size_t goldenLength = strlen(golden);
+
+    int numExpected = 0, numActual = 0;
+    Stroke *expected = extractStrokes(golden, goldenLength, &numExpected);
+    Stroke *actual = extractStrokes(program.data, program.length, &numActual);
+
+    snprintf(path, sizeof(path), "%s.diff", testCase->goldenFile);
+    FILE *diff = fopen(path, "w");
+    int differences;
+    if (!diff || !expected || !actual) {
+        printf("Error: Unable to compare %s\n", testCase->textFile);
+        differences = 1;
+    } else if (testCase->tolerance > 0.0) {
+        differences = compareStrokes(diff, expected, numExpected, actual, numActual, testCase->tolerance);
+    } else {
+        differences = compareExact(diff, golden, goldenLength, program.data, program.length);
+    }
+    if (diff) {
+        fclose(diff);
+    }
+
+    if (differences == 0) {
+        remove(path);  // No stale diff left behind from an earlier failure
+        printf("PASS %s at %.1fmm (%d strokes)\n", testCase->textFile, testCase->height, numActual);
+    } else {
+        printf("FAIL %s at %.1fmm: see %s\n", testCase->textFile, testCase->height, path);
+        snprintf(path, sizeof(path), "%s.actual", testCase->goldenFile);
+        writeWholeFile(path, program.data, program.length);
+        if (expected && actual) {
+            snprintf(path, sizeof(path), "%s.svg", testCase->goldenFile);
+            writeComparisonSvg(path, expected, numExpected, actual, numActual);
+        }
+    }
+
+    free(expected);
+    free(actual);
+    free(golden);
+    freeGCodeBuffer(&program);
+    return differences == 0;
+}
+
+// Function to run every case in a manifest
+int runGoldenTests(const char *manifest) {
+    FILE *file = openFile(manifest, "r");
+    GoldenCase testCase;
+    int passed = 0, failed = 0;
+    if (!file) {
+        return 1;
+    }
+
+    while (readGoldenCase(file, &testCase)) {
+        if (checkGoldenCase(&testCase)) {
+            passed++;
+        } else {
+            failed++;
+        }
+    }
+    fclose(file);
+
+    printf("%d passed, %d failed\n", passed, failed);
+    return failed;
+}
+
+// Function to write the current output of every case as its golden program
+int recordGoldenPrograms(const char *manifest) {
+    FILE *file = openFile(manifest, "r");
+    GoldenCase testCase;
+    int errors = 0;
+    if (!file) {
+        return 1;
+    }
+
+    while (readGoldenCase(file, &testCase)) {
+        GCodeBuffer program;
+        if (generateCase(&testCase, &program) == 0 && writeWholeFile(testCase.goldenFile, program.data, program.length) == 0) {
+            printf("Recorded %s\n", testCase.goldenFile);
+        } else {
+            errors++;
+        }
+        freeGCodeBuffer(&program);
+    }
+    fclose(file);
+    return errors;
+}
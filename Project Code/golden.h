@@ -0,0 +1,38 @@
+#include <stdio.h>
+
+
+#ifndef GOLDEN_H_INCLUDED
+#define GOLDEN_H_INCLUDED
+
+
+#define GOLDEN_MAX_DIFFS 20         // Differences listed in a .diff file before giving up
+
+/*
+ A golden manifest lists one case per line:
+
+     <text file> <height> <font file> <golden program> [tolerance [key=value ...]]
+
+ With no tolerance (or 0) the generated program must match the golden program
+ line for line. With a tolerance in mm only the pen-down strokes are compared,
+ in order, with each end point allowed to move by up to the tolerance, so
+ optimisers are free to change travel moves and pen commands. The key=value
+ options change the default layout: align, breaking, hyphenate, kerning,
+ dwell, lift_dwell, pen_drag and fold_pen, as in profiles.cfg.
+
+ The cases in golden/manifest.txt, run from this directory with --golden
+ golden/manifest.txt, are test.txt at three heights exactly as the program
+ first drew it, one case with the pen options on, and golden/layout.txt
+ justified with optimal breaking and hyphenation, and centred with greedy
+ breaking; its second paragraph is one word wider than the line.
+ golden/kerning.txt, full of the font's kerning pairs, is drawn kerned at 4mm
+ and 10mm, where the scaled pair values and side bearings round differently.
+ Record them again only when a change to the output is intended.
+
+ A failing case leaves <golden>.actual (the new program), <golden>.diff and
+ <golden>.svg (expected strokes in blue, actual in red) next to the golden file.
+*/
+
+int runGoldenTests(const char *manifest);     // Returns the number of failing cases
+int recordGoldenPrograms(const char *manifest);  // (Re)write every golden program
+
+#endif // GOLDEN_H_INCLUDED
@@ -0,0 +1,1042 @@
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X3 Y-10
+S1000
+G1 X3 Y0
+S0
+G0 X0 Y0
+S1000
+G1 X6 Y0
+S0
+G0 X10 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X10 Y-10
+S1000
+G1 X7 Y-9
+G1 X7 Y-5
+G1 X10 Y-4
+G1 X13 Y-5
+G1 X13 Y-9
+G1 X10 Y-10
+S0
+G0 X17 Y-10
+G0 X25 Y-10
+G0 X25 Y-10
+G0 X25 Y-10
+G0 X25 Y-10
+G0 X25 Y-10
+G0 X28 Y-10
+S1000
+G1 X28 Y0
+S0
+G0 X25 Y0
+S1000
+G1 X31 Y0
+S0
+G0 X35 Y-10
+G0 X32 Y-10
+G0 X32 Y-10
+G0 X32 Y-10
+G0 X32 Y-10
+G0 X32 Y-10
+G0 X32 Y-10
+G0 X32 Y-10
+S1000
+G1 X32 Y-4
+S0
+G0 X32 Y-6
+S1000
+G1 X35 Y-4
+G1 X38 Y-6
+S0
+G0 X42 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-5
+S1000
+G1 X42 Y-4
+G1 X46 Y-5
+G1 X46 Y-9
+G1 X44 Y-10
+G1 X42 Y-10
+G1 X40 Y-9
+G1 X40 Y-8
+G1 X46 Y-7
+S0
+G0 X46 Y-9
+S1000
+G1 X47 Y-10
+S0
+G0 X50 Y-10
+G0 X49 Y-10
+G0 X49 Y-10
+G0 X49 Y-10
+G0 X49 Y-10
+G0 X49 Y-10
+G0 X49 Y-10
+G0 X49 Y-10
+G0 X55 Y-5
+S1000
+G1 X52 Y-4
+G1 X49 Y-5
+G1 X49 Y-9
+G1 X52 Y-10
+G1 X55 Y-9
+S0
+G0 X59 Y-10
+G0 X57 Y-10
+G0 X57 Y-10
+G0 X57 Y-10
+G0 X57 Y-10
+G0 X57 Y-10
+G0 X57 Y-4
+S1000
+G1 X60 Y-10
+S0
+G0 X58 Y-13
+S1000
+G1 X63 Y-4
+S0
+G0 X67 Y-10
+G0 X62 Y-10
+G0 X62 Y-10
+G0 X62 Y-10
+G0 X62 Y-10
+G0 X64 Y-12
+S1000
+G1 X65 Y-10
+G1 X65 Y-10
+S0
+G0 X72 Y-10
+G0 X0 Y-28
+G0 X0 Y-28
+G0 X0 Y-28
+G0 X0 Y-28
+G0 X0 Y-28
+G0 X0 Y-28
+G0 X0 Y-28
+S1000
+G1 X0 Y-18
+S0
+G0 X0 Y-28
+S1000
+G1 X6 Y-28
+S0
+G0 X10 Y-28
+G0 X8 Y-28
+G0 X8 Y-28
+G0 X8 Y-28
+G0 X8 Y-28
+G0 X8 Y-28
+G0 X8 Y-28
+G0 X8 Y-28
+S1000
+G1 X11 Y-18
+G1 X14 Y-28
+S0
+G0 X9 Y-23
+S1000
+G1 X13 Y-23
+S0
+G0 X18 Y-28
+G0 X15 Y-28
+G0 X15 Y-28
+G0 X15 Y-28
+G0 X15 Y-28
+G0 X15 Y-18
+S1000
+G1 X18 Y-28
+G1 X21 Y-18
+S0
+G0 X25 Y-28
+G0 X22 Y-28
+G0 X22 Y-28
+G0 X22 Y-28
+G0 X22 Y-28
+G0 X22 Y-28
+G0 X22 Y-28
+G0 X22 Y-28
+S1000
+G1 X25 Y-18
+G1 X28 Y-28
+S0
+G0 X23 Y-23
+S1000
+G1 X27 Y-23
+S0
+G0 X32 Y-28
+G0 X40 Y-28
+G0 X40 Y-28
+G0 X40 Y-28
+G0 X40 Y-28
+G0 X40 Y-28
+G0 X40 Y-28
+G0 X40 Y-18
+S1000
+G1 X41 Y-28
+G1 X43 Y-21
+G1 X45 Y-28
+G1 X46 Y-18
+S0
+G0 X50 Y-28
+G0 X47 Y-28
+G0 X47 Y-28
+G0 X47 Y-28
+G0 X47 Y-28
+G0 X47 Y-28
+G0 X47 Y-28
+G0 X47 Y-28
+S1000
+G1 X50 Y-18
+G1 X53 Y-28
+S0
+G0 X48 Y-23
+S1000
+G1 X52 Y-23
+S0
+G0 X57 Y-28
+G0 X54 Y-28
+G0 X54 Y-28
+G0 X54 Y-28
+G0 X54 Y-28
+G0 X54 Y-18
+S1000
+G1 X57 Y-28
+G1 X60 Y-18
+S0
+G0 X64 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+G0 X62 Y-28
+S1000
+G1 X62 Y-18
+G1 X68 Y-18
+S0
+G0 X62 Y-23
+S1000
+G1 X67 Y-23
+S0
+G0 X62 Y-28
+S1000
+G1 X68 Y-28
+S0
+G0 X72 Y-28
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X3 Y-43
+S1000
+G1 X3 Y-40
+G1 X0 Y-33
+S0
+G0 X3 Y-40
+S1000
+G1 X6 Y-33
+S0
+G0 X10 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X10 Y-43
+S1000
+G1 X7 Y-42
+G1 X7 Y-38
+G1 X10 Y-37
+G1 X13 Y-38
+G1 X13 Y-42
+G1 X10 Y-43
+S0
+G0 X17 Y-43
+G0 X15 Y-43
+G0 X15 Y-43
+G0 X15 Y-43
+G0 X15 Y-43
+G0 X15 Y-43
+G0 X15 Y-43
+G0 X15 Y-37
+S1000
+G1 X15 Y-42
+G1 X18 Y-43
+G1 X21 Y-42
+G1 X21 Y-37
+S0
+G0 X25 Y-43
+G0 X33 Y-43
+G0 X33 Y-43
+G0 X33 Y-43
+G0 X33 Y-43
+G0 X33 Y-43
+G0 X33 Y-43
+G0 X33 Y-37
+S1000
+G1 X34 Y-43
+G1 X36 Y-39
+G1 X38 Y-43
+G1 X39 Y-37
+S0
+G0 X43 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-43
+G0 X41 Y-40
+S1000
+G1 X47 Y-40
+G1 X46 Y-37
+G1 X42 Y-37
+G1 X41 Y-38
+G1 X41 Y-42
+G1 X42 Y-43
+G1 X46 Y-43
+G1 X47 Y-42
+S0
+G0 X51 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+S1000
+G1 X49 Y-37
+S0
+G0 X49 Y-39
+S1000
+G1 X52 Y-37
+G1 X55 Y-39
+S0
+G0 X59 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-43
+G0 X57 Y-40
+S1000
+G1 X63 Y-40
+G1 X62 Y-37
+G1 X58 Y-37
+G1 X57 Y-38
+G1 X57 Y-42
+G1 X58 Y-43
+G1 X62 Y-43
+G1 X63 Y-42
+S0
+G0 X67 Y-43
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-53
+S1000
+G1 X2 Y-52
+G1 X6 Y-53
+G1 X6 Y-57
+G1 X4 Y-58
+G1 X2 Y-58
+G1 X0 Y-57
+G1 X0 Y-56
+G1 X6 Y-55
+S0
+G0 X6 Y-57
+S1000
+G1 X7 Y-58
+S0
+G0 X10 Y-58
+G0 X9 Y-58
+G0 X9 Y-58
+G0 X9 Y-58
+G0 X9 Y-58
+G0 X9 Y-58
+G0 X9 Y-58
+G0 X9 Y-52
+S1000
+G1 X10 Y-58
+G1 X12 Y-54
+G1 X14 Y-58
+G1 X15 Y-52
+S0
+G0 X19 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-58
+G0 X17 Y-53
+S1000
+G1 X19 Y-52
+G1 X23 Y-53
+G1 X23 Y-57
+G1 X21 Y-58
+G1 X19 Y-58
+G1 X17 Y-57
+G1 X17 Y-56
+G1 X23 Y-55
+S0
+G0 X23 Y-57
+S1000
+G1 X24 Y-58
+S0
+G0 X27 Y-58
+G0 X26 Y-58
+G0 X26 Y-58
+G0 X26 Y-58
+G0 X26 Y-58
+G0 X26 Y-58
+G0 X26 Y-52
+S1000
+G1 X29 Y-58
+S0
+G0 X27 Y-61
+S1000
+G1 X32 Y-52
+S0
+G0 X36 Y-58
+G0 X31 Y-58
+G0 X31 Y-58
+G0 X31 Y-58
+G0 X31 Y-58
+G0 X33 Y-60
+S1000
+G1 X34 Y-58
+G1 X34 Y-58
+S0
+G0 X41 Y-58
+G0 X46 Y-58
+G0 X46 Y-58
+G0 X46 Y-58
+G0 X46 Y-58
+G0 X46 Y-58
+G0 X49 Y-58
+S1000
+G1 X49 Y-48
+S0
+G0 X46 Y-48
+S1000
+G1 X52 Y-48
+S0
+G0 X56 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-58
+G0 X53 Y-55
+S1000
+G1 X59 Y-55
+G1 X58 Y-52
+G1 X54 Y-52
+G1 X53 Y-53
+G1 X53 Y-57
+G1 X54 Y-58
+G1 X58 Y-58
+G1 X59 Y-57
+S0
+G0 X63 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X61 Y-58
+G0 X67 Y-57
+S1000
+G1 X64 Y-58
+G1 X61 Y-57
+G1 X61 Y-53
+G1 X64 Y-52
+G1 X67 Y-53
+S0
+G0 X67 Y-48
+S1000
+G1 X67 Y-58
+S0
+G0 X71 Y-58
+G0 X66 Y-58
+G0 X66 Y-58
+G0 X66 Y-58
+G0 X66 Y-58
+G0 X69 Y-58
+S1000
+G1 X69 Y-58
+G1 X69 Y-58
+S0
+G0 X76 Y-58
+G0 X0 Y-76
+G0 X0 Y-76
+G0 X0 Y-76
+G0 X0 Y-76
+G0 X0 Y-76
+G0 X0 Y-76
+G0 X0 Y-76
+G0 X0 Y-76
+S1000
+G1 X0 Y-66
+G1 X6 Y-66
+S0
+G0 X0 Y-71
+S1000
+G1 X5 Y-71
+S0
+G0 X10 Y-76
+G0 X7 Y-76
+G0 X7 Y-76
+G0 X7 Y-76
+G0 X7 Y-76
+G0 X7 Y-76
+G0 X7 Y-76
+G0 X8 Y-76
+S1000
+G1 X12 Y-76
+S0
+G0 X10 Y-76
+S1000
+G1 X10 Y-66
+G1 X8 Y-66
+S0
+G0 X17 Y-76
+G0 X14 Y-76
+G0 X14 Y-76
+G0 X14 Y-76
+G0 X14 Y-76
+G0 X14 Y-76
+G0 X14 Y-70
+S1000
+G1 X17 Y-76
+S0
+G0 X15 Y-79
+S1000
+G1 X20 Y-70
+S0
+G0 X24 Y-76
+G0 X32 Y-76
+G0 X32 Y-76
+G0 X32 Y-76
+G0 X32 Y-76
+G0 X32 Y-76
+G0 X32 Y-76
+G0 X32 Y-76
+G0 X38 Y-75
+S1000
+G1 X36 Y-76
+G1 X34 Y-75
+G1 X34 Y-66
+S0
+G0 X32 Y-70
+S1000
+G1 X36 Y-70
+S0
+G0 X42 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X40 Y-76
+G0 X43 Y-76
+S1000
+G1 X40 Y-75
+G1 X40 Y-71
+G1 X43 Y-70
+G1 X46 Y-71
+G1 X46 Y-75
+G1 X43 Y-76
+S0
+G0 X50 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+G0 X58 Y-76
+S1000
+G1 X58 Y-66
+G1 X63 Y-66
+G1 X64 Y-68
+G1 X64 Y-70
+G1 X63 Y-72
+G1 X58 Y-72
+S0
+G0 X68 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-76
+G0 X66 Y-71
+S1000
+G1 X68 Y-70
+G1 X72 Y-71
+G1 X72 Y-75
+G1 X70 Y-76
+G1 X68 Y-76
+G1 X66 Y-75
+G1 X66 Y-74
+G1 X72 Y-73
+S0
+G0 X72 Y-75
+S1000
+G1 X73 Y-76
+S0
+G0 X76 Y-76
+G0 X75 Y-76
+G0 X75 Y-76
+G0 X75 Y-76
+G0 X75 Y-76
+G0 X75 Y-76
+G0 X75 Y-76
+G0 X75 Y-76
+S1000
+G1 X75 Y-70
+S0
+G0 X75 Y-72
+S1000
+G1 X78 Y-70
+G1 X81 Y-72
+S0
+G0 X85 Y-76
+G0 X81 Y-76
+G0 X81 Y-76
+G0 X81 Y-76
+G0 X81 Y-76
+G0 X81 Y-76
+G0 X81 Y-76
+G0 X84 Y-76
+S1000
+G1 X84 Y-70
+G1 X83 Y-70
+S0
+G0 X84 Y-66
+S1000
+G1 X84 Y-66
+S0
+G0 X91 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-76
+G0 X86 Y-75
+S1000
+G1 X89 Y-76
+G1 X92 Y-75
+G1 X92 Y-74
+G1 X86 Y-73
+G1 X86 Y-71
+G1 X89 Y-70
+G1 X92 Y-71
+S0
+G0 X96 Y-76
+G0 X91 Y-76
+G0 X91 Y-76
+G0 X91 Y-76
+G0 X91 Y-76
+G0 X94 Y-76
+S1000
+G1 X94 Y-76
+G1 X94 Y-76
+S0
+G0 X101 Y-76
+G0 X0 Y-94
+G0 X0 Y-94
+G0 X0 Y-94
+G0 X0 Y-94
+G0 X0 Y-94
+G0 X0 Y-94
+G0 X0 Y-94
+G0 X0 Y-94
+S1000
+G1 X3 Y-84
+G1 X6 Y-94
+S0
+G0 X1 Y-89
+S1000
+G1 X5 Y-89
+S0
+G0 X10 Y-94
+G0 X7 Y-94
+G0 X7 Y-94
+G0 X7 Y-94
+G0 X7 Y-94
+G0 X7 Y-94
+G0 X10 Y-94
+S1000
+G1 X10 Y-84
+S0
+G0 X7 Y-84
+S1000
+G1 X13 Y-84
+S0
+G0 X17 Y-94
+G0 X25 Y-94
+G0 X25 Y-94
+G0 X25 Y-94
+G0 X25 Y-94
+G0 X25 Y-94
+G0 X25 Y-94
+S1000
+G1 X25 Y-84
+S0
+G0 X25 Y-94
+S1000
+G1 X31 Y-94
+S0
+G0 X35 Y-94
+G0 X32 Y-94
+G0 X32 Y-94
+G0 X32 Y-94
+G0 X32 Y-94
+G0 X32 Y-94
+G0 X32 Y-94
+G0 X35 Y-94
+S1000
+G1 X35 Y-91
+G1 X32 Y-84
+S0
+G0 X35 Y-91
+S1000
+G1 X38 Y-84
+S0
+G0 X42 Y-94
+G0 X40 Y-94
+G0 X40 Y-94
+G0 X40 Y-94
+G0 X40 Y-94
+G0 X40 Y-84
+S1000
+G1 X43 Y-94
+G1 X46 Y-84
+S0
+G0 X50 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+G0 X48 Y-94
+S1000
+G1 X48 Y-84
+G1 X54 Y-84
+S0
+G0 X48 Y-89
+S1000
+G1 X53 Y-89
+S0
+G0 X48 Y-94
+S1000
+G1 X54 Y-94
+S0
+G0 X58 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+G0 X56 Y-94
+S1000
+G1 X56 Y-84
+G1 X61 Y-84
+G1 X62 Y-86
+G1 X62 Y-88
+G1 X61 Y-90
+G1 X56 Y-90
+S0
+G0 X59 Y-90
+S1000
+G1 X62 Y-94
+S0
+G0 X66 Y-94
+G0 X64 Y-94
+G0 X64 Y-94
+G0 X64 Y-94
+G0 X64 Y-94
+G0 X64 Y-94
+G0 X67 Y-94
+S1000
+G1 X67 Y-84
+S0
+G0 X64 Y-84
+S1000
+G1 X70 Y-84
+S0
+G0 X74 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X72 Y-94
+G0 X73 Y-94
+S1000
+G1 X72 Y-93
+G1 X72 Y-86
+G1 X73 Y-84
+G1 X77 Y-84
+G1 X78 Y-86
+G1 X78 Y-93
+G1 X77 Y-94
+G1 X73 Y-94
+S0
+G0 X82 Y-94
+G0 X80 Y-94
+G0 X80 Y-94
+G0 X80 Y-94
+G0 X80 Y-94
+G0 X80 Y-94
+G0 X80 Y-94
+S1000
+G1 X80 Y-84
+G1 X86 Y-94
+G1 X86 Y-84
+S0
+G0 X90 Y-94
+G0 X85 Y-94
+G0 X85 Y-94
+G0 X85 Y-94
+G0 X85 Y-94
+G0 X88 Y-94
+S1000
+G1 X88 Y-94
+G1 X88 Y-94
+S0
+G0 X95 Y-94
+G0 X0 Y0
+M0
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X3 Y-10
+S1000
+G1 X3 Y-7
+G1 X0 Y0
+S0
+G0 X3 Y-7
+S1000
+G1 X6 Y0
+S0
+G0 X10 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-10
+G0 X7 Y-7
+S1000
+G1 X13 Y-7
+G1 X12 Y-4
+G1 X8 Y-4
+G1 X7 Y-5
+G1 X7 Y-9
+G1 X8 Y-10
+G1 X12 Y-10
+G1 X13 Y-9
+S0
+G0 X17 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-10
+G0 X15 Y-9
+S1000
+G1 X18 Y-10
+G1 X21 Y-9
+G1 X21 Y-8
+G1 X15 Y-7
+G1 X15 Y-5
+G1 X18 Y-4
+G1 X21 Y-5
+S0
+G0 X25 Y-10
+G0 X21 Y-10
+G0 X21 Y-10
+G0 X21 Y-10
+G0 X21 Y-10
+G0 X23 Y-12
+S1000
+G1 X24 Y-10
+G1 X24 Y-10
+S0
+G0 X31 Y-10
+G0 X36 Y-10
+G0 X36 Y-10
+G0 X36 Y-10
+G0 X36 Y-10
+G0 X36 Y-10
+G0 X36 Y-10
+G0 X36 Y-10
+S1000
+G1 X36 Y0
+G1 X42 Y0
+S0
+G0 X36 Y-5
+S1000
+G1 X41 Y-5
+S0
+G0 X46 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-10
+G0 X43 Y-5
+S1000
+G1 X45 Y-4
+G1 X49 Y-5
+G1 X49 Y-9
+G1 X47 Y-10
+G1 X45 Y-10
+G1 X43 Y-9
+G1 X43 Y-8
+G1 X49 Y-7
+S0
+G0 X49 Y-9
+S1000
+G1 X50 Y-10
+S0
+G0 X53 Y-10
+G0 X52 Y-10
+G0 X52 Y-10
+G0 X52 Y-10
+G0 X52 Y-10
+G0 X52 Y-10
+G0 X52 Y-4
+S1000
+G1 X55 Y-10
+S0
+G0 X53 Y-13
+S1000
+G1 X58 Y-4
+S0
+G0 X62 Y-10
+G0 X56 Y-10
+G0 X56 Y-10
+G0 X56 Y-10
+G0 X56 Y-10
+G0 X59 Y-10
+S1000
+G1 X59 Y-10
+G1 X59 Y-10
+S0
+G0 X66 Y-10
+G0 X0 Y-28
+G0 X0 Y0
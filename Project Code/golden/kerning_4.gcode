@@ -0,0 +1,1036 @@
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X1 Y-4
+S1000
+G1 X1 Y0
+S0
+G0 X0 Y0
+S1000
+G1 X2 Y0
+S0
+G0 X4 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X2 Y-4
+G0 X3 Y-4
+S1000
+G1 X2 Y-4
+G1 X2 Y-2
+G1 X3 Y-2
+G1 X4 Y-2
+G1 X4 Y-4
+G1 X3 Y-4
+S0
+G0 X6 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X9 Y-4
+S1000
+G1 X9 Y0
+S0
+G0 X8 Y0
+S1000
+G1 X10 Y0
+S0
+G0 X12 Y-4
+G0 X10 Y-4
+G0 X10 Y-4
+G0 X10 Y-4
+G0 X10 Y-4
+G0 X10 Y-4
+G0 X10 Y-4
+G0 X10 Y-4
+S1000
+G1 X10 Y-2
+S0
+G0 X10 Y-3
+S1000
+G1 X11 Y-2
+G1 X12 Y-3
+S0
+G0 X14 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-4
+G0 X12 Y-2
+S1000
+G1 X13 Y-2
+G1 X14 Y-2
+G1 X14 Y-4
+G1 X13 Y-4
+G1 X12 Y-4
+G1 X12 Y-4
+G1 X12 Y-3
+G1 X14 Y-3
+S0
+G0 X14 Y-4
+S1000
+G1 X14 Y-4
+S0
+G0 X16 Y-4
+G0 X14 Y-4
+G0 X14 Y-4
+G0 X14 Y-4
+G0 X14 Y-4
+G0 X14 Y-4
+G0 X14 Y-4
+G0 X14 Y-4
+G0 X16 Y-2
+S1000
+G1 X15 Y-2
+G1 X14 Y-2
+G1 X14 Y-4
+G1 X15 Y-4
+G1 X16 Y-4
+S0
+G0 X18 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-2
+S1000
+G1 X17 Y-4
+S0
+G0 X16 Y-5
+S1000
+G1 X18 Y-2
+S0
+G0 X20 Y-4
+G0 X18 Y-4
+G0 X18 Y-4
+G0 X18 Y-4
+G0 X18 Y-4
+G0 X18 Y-4
+S1000
+G1 X19 Y-4
+G1 X19 Y-4
+S0
+G0 X22 Y-4
+G0 X23 Y-4
+G0 X23 Y-4
+G0 X23 Y-4
+G0 X23 Y-4
+G0 X23 Y-4
+G0 X23 Y-4
+S1000
+G1 X23 Y0
+S0
+G0 X23 Y-4
+S1000
+G1 X25 Y-4
+S0
+G0 X27 Y-4
+G0 X25 Y-4
+G0 X25 Y-4
+G0 X25 Y-4
+G0 X25 Y-4
+G0 X25 Y-4
+G0 X25 Y-4
+G0 X25 Y-4
+S1000
+G1 X26 Y0
+G1 X27 Y-4
+S0
+G0 X25 Y-2
+S1000
+G1 X27 Y-2
+S0
+G0 X29 Y-4
+G0 X27 Y-4
+G0 X27 Y-4
+G0 X27 Y-4
+G0 X27 Y-4
+G0 X27 Y0
+S1000
+G1 X28 Y-4
+G1 X29 Y0
+S0
+G0 X31 Y-4
+G0 X29 Y-4
+G0 X29 Y-4
+G0 X29 Y-4
+G0 X29 Y-4
+G0 X29 Y-4
+G0 X29 Y-4
+G0 X29 Y-4
+S1000
+G1 X30 Y0
+G1 X31 Y-4
+S0
+G0 X29 Y-2
+S1000
+G1 X31 Y-2
+S0
+G0 X33 Y-4
+G0 X35 Y-4
+G0 X35 Y-4
+G0 X35 Y-4
+G0 X35 Y-4
+G0 X35 Y-4
+G0 X35 Y-4
+G0 X35 Y0
+S1000
+G1 X35 Y-4
+G1 X36 Y-1
+G1 X37 Y-4
+G1 X37 Y0
+S0
+G0 X39 Y-4
+G0 X37 Y-4
+G0 X37 Y-4
+G0 X37 Y-4
+G0 X37 Y-4
+G0 X37 Y-4
+G0 X37 Y-4
+G0 X37 Y-4
+S1000
+G1 X38 Y0
+G1 X39 Y-4
+S0
+G0 X37 Y-2
+S1000
+G1 X39 Y-2
+S0
+G0 X41 Y-4
+G0 X39 Y-4
+G0 X39 Y-4
+G0 X39 Y-4
+G0 X39 Y-4
+G0 X39 Y0
+S1000
+G1 X40 Y-4
+G1 X41 Y0
+S0
+G0 X43 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+G0 X41 Y-4
+S1000
+G1 X41 Y0
+G1 X43 Y0
+S0
+G0 X41 Y-2
+S1000
+G1 X43 Y-2
+S0
+G0 X41 Y-4
+S1000
+G1 X43 Y-4
+S0
+G0 X45 Y-4
+G0 X0 Y-14
+G0 X0 Y-14
+G0 X0 Y-14
+G0 X0 Y-14
+G0 X0 Y-14
+G0 X0 Y-14
+G0 X0 Y-14
+G0 X1 Y-14
+S1000
+G1 X1 Y-13
+G1 X0 Y-10
+S0
+G0 X1 Y-13
+S1000
+G1 X2 Y-10
+S0
+G0 X4 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X2 Y-14
+G0 X3 Y-14
+S1000
+G1 X2 Y-14
+G1 X2 Y-12
+G1 X3 Y-12
+G1 X4 Y-12
+G1 X4 Y-14
+G1 X3 Y-14
+S0
+G0 X6 Y-14
+G0 X4 Y-14
+G0 X4 Y-14
+G0 X4 Y-14
+G0 X4 Y-14
+G0 X4 Y-14
+G0 X4 Y-14
+G0 X4 Y-12
+S1000
+G1 X4 Y-14
+G1 X5 Y-14
+G1 X6 Y-14
+G1 X6 Y-12
+S0
+G0 X8 Y-14
+G0 X10 Y-14
+G0 X10 Y-14
+G0 X10 Y-14
+G0 X10 Y-14
+G0 X10 Y-14
+G0 X10 Y-14
+G0 X10 Y-12
+S1000
+G1 X10 Y-14
+G1 X11 Y-13
+G1 X12 Y-14
+G1 X12 Y-12
+S0
+G0 X14 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-14
+G0 X12 Y-13
+S1000
+G1 X14 Y-13
+G1 X14 Y-12
+G1 X12 Y-12
+G1 X12 Y-12
+G1 X12 Y-14
+G1 X12 Y-14
+G1 X14 Y-14
+G1 X14 Y-14
+S0
+G0 X16 Y-14
+G0 X14 Y-14
+G0 X14 Y-14
+G0 X14 Y-14
+G0 X14 Y-14
+G0 X14 Y-14
+G0 X14 Y-14
+G0 X14 Y-14
+S1000
+G1 X14 Y-12
+S0
+G0 X14 Y-13
+S1000
+G1 X15 Y-12
+G1 X16 Y-13
+S0
+G0 X18 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-14
+G0 X16 Y-13
+S1000
+G1 X18 Y-13
+G1 X18 Y-12
+G1 X16 Y-12
+G1 X16 Y-12
+G1 X16 Y-14
+G1 X16 Y-14
+G1 X18 Y-14
+G1 X18 Y-14
+S0
+G0 X20 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-14
+G0 X22 Y-12
+S1000
+G1 X23 Y-12
+G1 X24 Y-12
+G1 X24 Y-14
+G1 X23 Y-14
+G1 X22 Y-14
+G1 X22 Y-14
+G1 X22 Y-13
+G1 X24 Y-13
+S0
+G0 X24 Y-14
+S1000
+G1 X24 Y-14
+S0
+G0 X26 Y-14
+G0 X24 Y-14
+G0 X24 Y-14
+G0 X24 Y-14
+G0 X24 Y-14
+G0 X24 Y-14
+G0 X24 Y-14
+G0 X24 Y-12
+S1000
+G1 X24 Y-14
+G1 X25 Y-13
+G1 X26 Y-14
+G1 X26 Y-12
+S0
+G0 X28 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-14
+G0 X26 Y-12
+S1000
+G1 X27 Y-12
+G1 X28 Y-12
+G1 X28 Y-14
+G1 X27 Y-14
+G1 X26 Y-14
+G1 X26 Y-14
+G1 X26 Y-13
+G1 X28 Y-13
+S0
+G0 X28 Y-14
+S1000
+G1 X28 Y-14
+S0
+G0 X30 Y-14
+G0 X28 Y-14
+G0 X28 Y-14
+G0 X28 Y-14
+G0 X28 Y-14
+G0 X28 Y-14
+G0 X28 Y-12
+S1000
+G1 X29 Y-14
+S0
+G0 X28 Y-15
+S1000
+G1 X30 Y-12
+S0
+G0 X32 Y-14
+G0 X30 Y-14
+G0 X30 Y-14
+G0 X30 Y-14
+G0 X30 Y-14
+G0 X30 Y-14
+S1000
+G1 X31 Y-14
+G1 X31 Y-14
+S0
+G0 X34 Y-14
+G0 X35 Y-14
+G0 X35 Y-14
+G0 X35 Y-14
+G0 X35 Y-14
+G0 X35 Y-14
+G0 X36 Y-14
+S1000
+G1 X36 Y-10
+S0
+G0 X35 Y-10
+S1000
+G1 X37 Y-10
+S0
+G0 X39 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-14
+G0 X37 Y-13
+S1000
+G1 X39 Y-13
+G1 X39 Y-12
+G1 X37 Y-12
+G1 X37 Y-12
+G1 X37 Y-14
+G1 X37 Y-14
+G1 X39 Y-14
+G1 X39 Y-14
+S0
+G0 X41 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X39 Y-14
+G0 X41 Y-14
+S1000
+G1 X40 Y-14
+G1 X39 Y-14
+G1 X39 Y-12
+G1 X40 Y-12
+G1 X41 Y-12
+S0
+G0 X41 Y-10
+S1000
+G1 X41 Y-14
+S0
+G0 X43 Y-14
+G0 X40 Y-14
+G0 X40 Y-14
+G0 X40 Y-14
+G0 X40 Y-14
+G0 X41 Y-14
+S1000
+G1 X41 Y-14
+G1 X41 Y-14
+S0
+G0 X44 Y-14
+G0 X45 Y-14
+G0 X45 Y-14
+G0 X45 Y-14
+G0 X45 Y-14
+G0 X45 Y-14
+G0 X45 Y-14
+G0 X45 Y-14
+S1000
+G1 X45 Y-10
+G1 X47 Y-10
+S0
+G0 X45 Y-12
+S1000
+G1 X47 Y-12
+S0
+G0 X49 Y-14
+G0 X47 Y-14
+G0 X47 Y-14
+G0 X47 Y-14
+G0 X47 Y-14
+G0 X47 Y-14
+G0 X47 Y-14
+G0 X47 Y-14
+S1000
+G1 X49 Y-14
+S0
+G0 X48 Y-14
+S1000
+G1 X48 Y-10
+G1 X47 Y-10
+S0
+G0 X51 Y-14
+G0 X49 Y-14
+G0 X49 Y-14
+G0 X49 Y-14
+G0 X49 Y-14
+G0 X49 Y-14
+G0 X49 Y-12
+S1000
+G1 X50 Y-14
+S0
+G0 X49 Y-15
+S1000
+G1 X51 Y-12
+S0
+G0 X53 Y-14
+G0 X55 Y-14
+G0 X55 Y-14
+G0 X55 Y-14
+G0 X55 Y-14
+G0 X55 Y-14
+G0 X55 Y-14
+G0 X55 Y-14
+G0 X57 Y-14
+S1000
+G1 X56 Y-14
+G1 X55 Y-14
+G1 X55 Y-10
+S0
+G0 X55 Y-12
+S1000
+G1 X56 Y-12
+S0
+G0 X59 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X57 Y-14
+G0 X58 Y-14
+S1000
+G1 X57 Y-14
+G1 X57 Y-12
+G1 X58 Y-12
+G1 X59 Y-12
+G1 X59 Y-14
+G1 X58 Y-14
+S0
+G0 X61 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+G0 X63 Y-14
+S1000
+G1 X63 Y-10
+G1 X65 Y-10
+G1 X65 Y-11
+G1 X65 Y-12
+G1 X65 Y-13
+G1 X63 Y-13
+S0
+G0 X67 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-14
+G0 X65 Y-12
+S1000
+G1 X66 Y-12
+G1 X67 Y-12
+G1 X67 Y-14
+G1 X66 Y-14
+G1 X65 Y-14
+G1 X65 Y-14
+G1 X65 Y-13
+G1 X67 Y-13
+S0
+G0 X67 Y-14
+S1000
+G1 X67 Y-14
+S0
+G0 X69 Y-14
+G0 X67 Y-14
+G0 X67 Y-14
+G0 X67 Y-14
+G0 X67 Y-14
+G0 X67 Y-14
+G0 X67 Y-14
+G0 X67 Y-14
+S1000
+G1 X67 Y-12
+S0
+G0 X67 Y-13
+S1000
+G1 X68 Y-12
+G1 X69 Y-13
+S0
+G0 X71 Y-14
+G0 X69 Y-14
+G0 X69 Y-14
+G0 X69 Y-14
+G0 X69 Y-14
+G0 X69 Y-14
+G0 X69 Y-14
+G0 X70 Y-14
+S1000
+G1 X70 Y-12
+G1 X69 Y-12
+S0
+G0 X70 Y-10
+S1000
+G1 X70 Y-10
+S0
+G0 X73 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+G0 X70 Y-14
+S1000
+G1 X71 Y-14
+G1 X72 Y-14
+G1 X72 Y-13
+G1 X70 Y-13
+G1 X70 Y-12
+G1 X71 Y-12
+G1 X72 Y-12
+S0
+G0 X74 Y-14
+G0 X71 Y-14
+G0 X71 Y-14
+G0 X71 Y-14
+G0 X71 Y-14
+G0 X72 Y-14
+S1000
+G1 X72 Y-14
+G1 X72 Y-14
+S0
+G0 X75 Y-14
+G0 X0 Y-24
+G0 X0 Y-24
+G0 X0 Y-24
+G0 X0 Y-24
+G0 X0 Y-24
+G0 X0 Y-24
+G0 X0 Y-24
+G0 X0 Y-24
+S1000
+G1 X1 Y-20
+G1 X2 Y-24
+S0
+G0 X0 Y-22
+S1000
+G1 X2 Y-22
+S0
+G0 X4 Y-24
+G0 X2 Y-24
+G0 X2 Y-24
+G0 X2 Y-24
+G0 X2 Y-24
+G0 X2 Y-24
+G0 X3 Y-24
+S1000
+G1 X3 Y-20
+S0
+G0 X2 Y-20
+S1000
+G1 X4 Y-20
+S0
+G0 X6 Y-24
+G0 X8 Y-24
+G0 X8 Y-24
+G0 X8 Y-24
+G0 X8 Y-24
+G0 X8 Y-24
+G0 X8 Y-24
+S1000
+G1 X8 Y-20
+S0
+G0 X8 Y-24
+S1000
+G1 X10 Y-24
+S0
+G0 X12 Y-24
+G0 X10 Y-24
+G0 X10 Y-24
+G0 X10 Y-24
+G0 X10 Y-24
+G0 X10 Y-24
+G0 X10 Y-24
+G0 X11 Y-24
+S1000
+G1 X11 Y-23
+G1 X10 Y-20
+S0
+G0 X11 Y-23
+S1000
+G1 X12 Y-20
+S0
+G0 X14 Y-24
+G0 X12 Y-24
+G0 X12 Y-24
+G0 X12 Y-24
+G0 X12 Y-24
+G0 X12 Y-20
+S1000
+G1 X13 Y-24
+G1 X14 Y-20
+S0
+G0 X16 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+G0 X14 Y-24
+S1000
+G1 X14 Y-20
+G1 X16 Y-20
+S0
+G0 X14 Y-22
+S1000
+G1 X16 Y-22
+S0
+G0 X14 Y-24
+S1000
+G1 X16 Y-24
+S0
+G0 X18 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+G0 X16 Y-24
+S1000
+G1 X16 Y-20
+G1 X18 Y-20
+G1 X18 Y-21
+G1 X18 Y-22
+G1 X18 Y-23
+G1 X16 Y-23
+S0
+G0 X17 Y-23
+S1000
+G1 X18 Y-24
+S0
+G0 X20 Y-24
+G0 X18 Y-24
+G0 X18 Y-24
+G0 X18 Y-24
+G0 X18 Y-24
+G0 X18 Y-24
+G0 X19 Y-24
+S1000
+G1 X19 Y-20
+S0
+G0 X18 Y-20
+S1000
+G1 X20 Y-20
+S0
+G0 X22 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+G0 X20 Y-24
+S1000
+G1 X20 Y-24
+G1 X20 Y-21
+G1 X20 Y-20
+G1 X22 Y-20
+G1 X22 Y-21
+G1 X22 Y-24
+G1 X22 Y-24
+G1 X20 Y-24
+S0
+G0 X24 Y-24
+G0 X22 Y-24
+G0 X22 Y-24
+G0 X22 Y-24
+G0 X22 Y-24
+G0 X22 Y-24
+G0 X22 Y-24
+S1000
+G1 X22 Y-20
+G1 X24 Y-24
+G1 X24 Y-20
+S0
+G0 X26 Y-24
+G0 X23 Y-24
+G0 X23 Y-24
+G0 X23 Y-24
+G0 X23 Y-24
+G0 X24 Y-24
+S1000
+G1 X24 Y-24
+G1 X24 Y-24
+S0
+G0 X27 Y-24
+G0 X28 Y-24
+G0 X28 Y-24
+G0 X28 Y-24
+G0 X28 Y-24
+G0 X28 Y-24
+G0 X28 Y-24
+G0 X29 Y-24
+S1000
+G1 X29 Y-23
+G1 X28 Y-20
+S0
+G0 X29 Y-23
+S1000
+G1 X30 Y-20
+S0
+G0 X32 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-24
+G0 X30 Y-23
+S1000
+G1 X32 Y-23
+G1 X32 Y-22
+G1 X30 Y-22
+G1 X30 Y-22
+G1 X30 Y-24
+G1 X30 Y-24
+G1 X32 Y-24
+G1 X32 Y-24
+S0
+G0 X34 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+G0 X32 Y-24
+S1000
+G1 X33 Y-24
+G1 X34 Y-24
+G1 X34 Y-23
+G1 X32 Y-23
+G1 X32 Y-22
+G1 X33 Y-22
+G1 X34 Y-22
+S0
+G0 X36 Y-24
+G0 X34 Y-24
+G0 X34 Y-24
+G0 X34 Y-24
+G0 X34 Y-24
+G0 X34 Y-24
+S1000
+G1 X35 Y-24
+G1 X35 Y-24
+S0
+G0 X38 Y-24
+G0 X39 Y-24
+G0 X39 Y-24
+G0 X39 Y-24
+G0 X39 Y-24
+G0 X39 Y-24
+G0 X39 Y-24
+G0 X39 Y-24
+S1000
+G1 X39 Y-20
+G1 X41 Y-20
+S0
+G0 X39 Y-22
+S1000
+G1 X41 Y-22
+S0
+G0 X43 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-24
+G0 X41 Y-22
+S1000
+G1 X42 Y-22
+G1 X43 Y-22
+G1 X43 Y-24
+G1 X42 Y-24
+G1 X41 Y-24
+G1 X41 Y-24
+G1 X41 Y-23
+G1 X43 Y-23
+S0
+G0 X43 Y-24
+S1000
+G1 X43 Y-24
+S0
+G0 X45 Y-24
+G0 X43 Y-24
+G0 X43 Y-24
+G0 X43 Y-24
+G0 X43 Y-24
+G0 X43 Y-24
+G0 X43 Y-22
+S1000
+G1 X44 Y-24
+S0
+G0 X43 Y-25
+S1000
+G1 X45 Y-22
+S0
+G0 X47 Y-24
+G0 X44 Y-24
+G0 X44 Y-24
+G0 X44 Y-24
+G0 X44 Y-24
+G0 X45 Y-24
+S1000
+G1 X45 Y-24
+G1 X45 Y-24
+S0
+G0 X48 Y-24
+G0 X0 Y-34
+G0 X0 Y0
@@ -0,0 +1,3974 @@
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X20 Y-7
+S1000
+G1 X20 Y0
+S0
+G0 X18 Y0
+S1000
+G1 X23 Y0
+S0
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+G0 X25 Y-7
+S1000
+G1 X25 Y0
+S0
+G0 X25 Y-4
+S1000
+G1 X27 Y-3
+G1 X30 Y-4
+G1 X30 Y-7
+S0
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-5
+S1000
+G1 X37 Y-5
+G1 X35 Y-2
+G1 X33 Y-2
+G1 X32 Y-4
+G1 X32 Y-7
+G1 X33 Y-7
+G1 X35 Y-7
+G1 X37 Y-7
+S0
+G0 X39 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-3
+S1000
+G1 X47 Y-7
+G1 X48 Y-4
+G1 X49 Y-7
+G1 X51 Y-3
+S0
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-3
+S1000
+G1 X55 Y-2
+G1 X57 Y-3
+G1 X57 Y-7
+G1 X56 Y-7
+G1 X54 Y-7
+G1 X53 Y-7
+G1 X53 Y-5
+G1 X57 Y-5
+S0
+G0 X57 Y-7
+S1000
+G1 X58 Y-7
+S0
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-3
+S1000
+G1 X62 Y-7
+G1 X65 Y-3
+S0
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-5
+S1000
+G1 X72 Y-5
+G1 X70 Y-2
+G1 X68 Y-2
+G1 X67 Y-4
+G1 X67 Y-7
+G1 X68 Y-7
+G1 X70 Y-7
+G1 X72 Y-7
+S0
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+S1000
+G1 X76 Y-7
+G1 X79 Y-7
+G1 X79 Y-5
+G1 X74 Y-5
+G1 X74 Y-3
+G1 X76 Y-2
+G1 X79 Y-3
+S0
+G0 X81 Y-7
+G0 X0 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X12 Y-16
+S1000
+G1 X10 Y-15
+G1 X8 Y-16
+G1 X8 Y-19
+G1 X10 Y-19
+G1 X12 Y-19
+S0
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+S1000
+G1 X15 Y-15
+S0
+G0 X15 Y-16
+S1000
+G1 X17 Y-15
+G1 X20 Y-16
+S0
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-15
+S1000
+G1 X24 Y-14
+G1 X26 Y-15
+G1 X26 Y-19
+G1 X25 Y-19
+G1 X23 Y-19
+G1 X22 Y-19
+G1 X22 Y-17
+G1 X26 Y-17
+S0
+G0 X26 Y-19
+S1000
+G1 X27 Y-19
+S0
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+S1000
+G1 X31 Y-19
+G1 X34 Y-19
+G1 X34 Y-17
+G1 X29 Y-17
+G1 X29 Y-15
+G1 X31 Y-14
+G1 X34 Y-15
+S0
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+S1000
+G1 X36 Y-12
+S0
+G0 X36 Y-16
+S1000
+G1 X38 Y-15
+G1 X41 Y-16
+G1 X41 Y-19
+S0
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-17
+S1000
+G1 X48 Y-17
+G1 X46 Y-14
+G1 X44 Y-14
+G1 X43 Y-16
+G1 X43 Y-19
+G1 X44 Y-19
+G1 X46 Y-19
+G1 X48 Y-19
+S0
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X55 Y-19
+S1000
+G1 X52 Y-19
+G1 X50 Y-19
+G1 X50 Y-16
+G1 X52 Y-15
+G1 X55 Y-16
+S0
+G0 X55 Y-12
+S1000
+G1 X55 Y-19
+S0
+G0 X57 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X66 Y-19
+S1000
+G1 X66 Y-15
+G1 X65 Y-15
+S0
+G0 X66 Y-12
+S1000
+G1 X66 Y-12
+S0
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+S1000
+G1 X71 Y-15
+S0
+G0 X71 Y-16
+S1000
+G1 X73 Y-15
+G1 X76 Y-16
+G1 X76 Y-19
+S0
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X83 Y-19
+S1000
+G1 X81 Y-19
+G1 X79 Y-19
+G1 X79 Y-12
+S0
+G0 X78 Y-15
+S1000
+G1 X81 Y-15
+S0
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X87 Y-19
+S1000
+G1 X85 Y-19
+G1 X85 Y-16
+G1 X87 Y-15
+G1 X90 Y-16
+G1 X90 Y-19
+G1 X87 Y-19
+S0
+G0 X92 Y-19
+G0 X0 Y-31
+G0 X11 Y-31
+G0 X11 Y-31
+G0 X11 Y-31
+G0 X11 Y-31
+G0 X11 Y-31
+G0 X11 Y-31
+G0 X11 Y-31
+G0 X16 Y-31
+S1000
+G1 X14 Y-31
+G1 X12 Y-31
+G1 X12 Y-24
+S0
+G0 X11 Y-27
+S1000
+G1 X14 Y-27
+S0
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+G0 X18 Y-31
+S1000
+G1 X18 Y-24
+S0
+G0 X18 Y-28
+S1000
+G1 X20 Y-27
+G1 X23 Y-28
+G1 X23 Y-31
+S0
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-31
+G0 X25 Y-29
+S1000
+G1 X30 Y-29
+G1 X28 Y-26
+G1 X26 Y-26
+G1 X25 Y-28
+G1 X25 Y-31
+G1 X26 Y-31
+G1 X28 Y-31
+G1 X30 Y-31
+S0
+G0 X32 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+G0 X39 Y-31
+S1000
+G1 X41 Y-31
+G1 X44 Y-31
+G1 X44 Y-29
+G1 X39 Y-29
+G1 X39 Y-27
+G1 X41 Y-26
+G1 X44 Y-27
+S0
+G0 X46 Y-31
+G0 X46 Y-31
+G0 X46 Y-31
+G0 X46 Y-31
+G0 X46 Y-31
+G0 X46 Y-31
+G0 X46 Y-31
+G0 X48 Y-31
+S1000
+G1 X48 Y-27
+G1 X47 Y-27
+S0
+G0 X48 Y-24
+S1000
+G1 X48 Y-24
+S0
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X53 Y-31
+G0 X58 Y-31
+S1000
+G1 X55 Y-31
+G1 X53 Y-31
+G1 X53 Y-28
+G1 X55 Y-27
+G1 X58 Y-28
+S0
+G0 X58 Y-24
+S1000
+G1 X58 Y-31
+S0
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-31
+G0 X60 Y-29
+S1000
+G1 X65 Y-29
+G1 X63 Y-26
+G1 X61 Y-26
+G1 X60 Y-28
+G1 X60 Y-31
+G1 X61 Y-31
+G1 X63 Y-31
+G1 X65 Y-31
+S0
+G0 X67 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X74 Y-31
+G0 X76 Y-31
+S1000
+G1 X74 Y-31
+G1 X74 Y-28
+G1 X76 Y-27
+G1 X79 Y-28
+G1 X79 Y-31
+G1 X76 Y-31
+S0
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X81 Y-31
+G0 X82 Y-31
+S1000
+G1 X82 Y-25
+G1 X84 Y-24
+G1 X86 Y-25
+S0
+G0 X81 Y-28
+S1000
+G1 X84 Y-28
+S0
+G0 X88 Y-31
+G0 X0 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X23 Y-43
+S1000
+G1 X21 Y-43
+G1 X19 Y-43
+G1 X19 Y-36
+S0
+G0 X18 Y-39
+S1000
+G1 X21 Y-39
+S0
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+S1000
+G1 X25 Y-36
+S0
+G0 X25 Y-40
+S1000
+G1 X27 Y-39
+G1 X30 Y-40
+G1 X30 Y-43
+S0
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-41
+S1000
+G1 X37 Y-41
+G1 X35 Y-38
+G1 X33 Y-38
+G1 X32 Y-40
+G1 X32 Y-43
+G1 X33 Y-43
+G1 X35 Y-43
+G1 X37 Y-43
+S0
+G0 X39 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X50 Y-40
+S1000
+G1 X48 Y-39
+G1 X46 Y-40
+G1 X46 Y-43
+G1 X48 Y-43
+G1 X50 Y-43
+S0
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X54 Y-43
+S1000
+G1 X56 Y-43
+S0
+G0 X55 Y-43
+S1000
+G1 X55 Y-36
+G1 X54 Y-36
+S0
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X62 Y-43
+S1000
+G1 X62 Y-39
+G1 X61 Y-39
+S0
+G0 X62 Y-36
+S1000
+G1 X62 Y-36
+S0
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X68 Y-43
+S1000
+G1 X68 Y-37
+G1 X70 Y-36
+G1 X72 Y-37
+S0
+G0 X67 Y-40
+S1000
+G1 X70 Y-40
+S0
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X75 Y-43
+S1000
+G1 X75 Y-37
+G1 X77 Y-36
+G1 X79 Y-37
+S0
+G0 X74 Y-40
+S1000
+G1 X77 Y-40
+S0
+G0 X81 Y-43
+G0 X0 Y-55
+G0 X18 Y-55
+G0 X18 Y-55
+G0 X18 Y-55
+G0 X18 Y-55
+G0 X18 Y-55
+G0 X18 Y-55
+G0 X18 Y-51
+S1000
+G1 X19 Y-55
+G1 X20 Y-52
+G1 X21 Y-55
+G1 X23 Y-51
+S0
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+G0 X25 Y-55
+S1000
+G1 X25 Y-48
+S0
+G0 X25 Y-52
+S1000
+G1 X27 Y-51
+G1 X30 Y-52
+G1 X30 Y-55
+S0
+G0 X32 Y-55
+G0 X32 Y-55
+G0 X32 Y-55
+G0 X32 Y-55
+G0 X32 Y-55
+G0 X32 Y-55
+G0 X32 Y-55
+G0 X34 Y-55
+S1000
+G1 X34 Y-51
+G1 X33 Y-51
+S0
+G0 X34 Y-48
+S1000
+G1 X34 Y-48
+S0
+G0 X39 Y-55
+G0 X39 Y-55
+G0 X39 Y-55
+G0 X39 Y-55
+G0 X39 Y-55
+G0 X39 Y-55
+G0 X39 Y-55
+G0 X40 Y-55
+S1000
+G1 X42 Y-55
+S0
+G0 X41 Y-55
+S1000
+G1 X41 Y-48
+G1 X40 Y-48
+S0
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-55
+G0 X46 Y-53
+S1000
+G1 X51 Y-53
+G1 X49 Y-50
+G1 X47 Y-50
+G1 X46 Y-52
+G1 X46 Y-55
+G1 X47 Y-55
+G1 X49 Y-55
+G1 X51 Y-55
+S0
+G0 X53 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X65 Y-55
+S1000
+G1 X63 Y-55
+G1 X61 Y-55
+G1 X61 Y-48
+S0
+G0 X60 Y-51
+S1000
+G1 X63 Y-51
+S0
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+G0 X67 Y-55
+S1000
+G1 X67 Y-48
+S0
+G0 X67 Y-52
+S1000
+G1 X69 Y-51
+G1 X72 Y-52
+G1 X72 Y-55
+S0
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-55
+G0 X74 Y-53
+S1000
+G1 X79 Y-53
+G1 X77 Y-50
+G1 X75 Y-50
+G1 X74 Y-52
+G1 X74 Y-55
+G1 X75 Y-55
+G1 X77 Y-55
+G1 X79 Y-55
+S0
+G0 X81 Y-55
+G0 X0 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X4 Y-67
+G0 X8 Y-67
+S1000
+G1 X6 Y-67
+G1 X4 Y-67
+G1 X4 Y-64
+G1 X6 Y-63
+G1 X8 Y-64
+S0
+G0 X8 Y-63
+S1000
+G1 X8 Y-69
+G1 X6 Y-69
+G1 X4 Y-69
+S0
+G0 X11 Y-67
+G0 X11 Y-67
+G0 X11 Y-67
+G0 X11 Y-67
+G0 X11 Y-67
+G0 X11 Y-67
+G0 X11 Y-67
+G0 X11 Y-63
+S1000
+G1 X11 Y-67
+G1 X13 Y-67
+G1 X16 Y-67
+G1 X16 Y-63
+S0
+G0 X18 Y-67
+G0 X18 Y-67
+G0 X18 Y-67
+G0 X18 Y-67
+G0 X18 Y-67
+G0 X18 Y-67
+G0 X18 Y-67
+G0 X19 Y-67
+S1000
+G1 X21 Y-67
+S0
+G0 X20 Y-67
+S1000
+G1 X20 Y-60
+G1 X19 Y-60
+S0
+G0 X25 Y-67
+G0 X25 Y-67
+G0 X25 Y-67
+G0 X25 Y-67
+G0 X25 Y-67
+G0 X25 Y-67
+G0 X25 Y-67
+G0 X26 Y-67
+S1000
+G1 X28 Y-67
+S0
+G0 X27 Y-67
+S1000
+G1 X27 Y-60
+G1 X26 Y-60
+S0
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+G0 X32 Y-67
+S1000
+G1 X34 Y-67
+G1 X37 Y-67
+G1 X37 Y-65
+G1 X32 Y-65
+G1 X32 Y-63
+G1 X34 Y-62
+G1 X37 Y-63
+S0
+G0 X39 Y-67
+G0 X46 Y-67
+G0 X46 Y-67
+G0 X46 Y-67
+G0 X46 Y-67
+G0 X46 Y-67
+G0 X46 Y-67
+G0 X46 Y-63
+S1000
+G1 X47 Y-67
+G1 X48 Y-64
+G1 X49 Y-67
+G1 X51 Y-63
+S0
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+G0 X53 Y-67
+S1000
+G1 X53 Y-60
+S0
+G0 X53 Y-64
+S1000
+G1 X55 Y-63
+G1 X58 Y-64
+G1 X58 Y-67
+S0
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-67
+G0 X60 Y-65
+S1000
+G1 X65 Y-65
+G1 X63 Y-62
+G1 X61 Y-62
+G1 X60 Y-64
+G1 X60 Y-67
+G1 X61 Y-67
+G1 X63 Y-67
+G1 X65 Y-67
+S0
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-67
+G0 X67 Y-65
+S1000
+G1 X72 Y-65
+G1 X70 Y-62
+G1 X68 Y-62
+G1 X67 Y-64
+G1 X67 Y-67
+G1 X68 Y-67
+G1 X70 Y-67
+G1 X72 Y-67
+S0
+G0 X74 Y-67
+G0 X74 Y-67
+G0 X74 Y-67
+G0 X74 Y-67
+G0 X74 Y-67
+G0 X74 Y-67
+G0 X74 Y-67
+G0 X75 Y-67
+S1000
+G1 X77 Y-67
+S0
+G0 X76 Y-67
+S1000
+G1 X76 Y-60
+G1 X75 Y-60
+S0
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-67
+G0 X81 Y-65
+S1000
+G1 X86 Y-65
+G1 X84 Y-62
+G1 X82 Y-62
+G1 X81 Y-64
+G1 X81 Y-67
+G1 X82 Y-67
+G1 X84 Y-67
+G1 X86 Y-67
+S0
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X88 Y-67
+G0 X93 Y-67
+S1000
+G1 X90 Y-67
+G1 X88 Y-67
+G1 X88 Y-64
+G1 X90 Y-63
+G1 X93 Y-64
+S0
+G0 X93 Y-60
+S1000
+G1 X93 Y-67
+S0
+G0 X95 Y-67
+G0 X0 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-81
+G0 X1 Y-77
+S1000
+G1 X3 Y-76
+G1 X5 Y-77
+G1 X5 Y-81
+G1 X4 Y-81
+G1 X2 Y-81
+G1 X1 Y-81
+G1 X1 Y-79
+G1 X5 Y-79
+S0
+G0 X5 Y-81
+S1000
+G1 X6 Y-81
+S0
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+G0 X8 Y-81
+S1000
+G1 X8 Y-77
+S0
+G0 X8 Y-78
+S1000
+G1 X10 Y-77
+G1 X13 Y-78
+G1 X13 Y-81
+S0
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X15 Y-81
+G0 X20 Y-81
+S1000
+G1 X17 Y-81
+G1 X15 Y-81
+G1 X15 Y-78
+G1 X17 Y-77
+G1 X20 Y-78
+S0
+G0 X20 Y-74
+S1000
+G1 X20 Y-81
+S0
+G0 X22 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X33 Y-78
+S1000
+G1 X31 Y-77
+G1 X29 Y-78
+G1 X29 Y-81
+G1 X31 Y-81
+G1 X33 Y-81
+S0
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+S1000
+G1 X36 Y-77
+S0
+G0 X36 Y-78
+S1000
+G1 X38 Y-77
+G1 X41 Y-78
+S0
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X45 Y-81
+S1000
+G1 X45 Y-77
+G1 X44 Y-77
+S0
+G0 X45 Y-74
+S1000
+G1 X45 Y-74
+S0
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-79
+S1000
+G1 X55 Y-79
+G1 X53 Y-76
+G1 X51 Y-76
+G1 X50 Y-78
+G1 X50 Y-81
+G1 X51 Y-81
+G1 X53 Y-81
+G1 X55 Y-81
+S0
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X62 Y-81
+S1000
+G1 X59 Y-81
+G1 X57 Y-81
+G1 X57 Y-78
+G1 X59 Y-77
+G1 X62 Y-78
+S0
+G0 X62 Y-74
+S1000
+G1 X62 Y-81
+S0
+G0 X64 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X71 Y-81
+G0 X73 Y-81
+S1000
+G1 X71 Y-81
+G1 X71 Y-78
+G1 X73 Y-77
+G1 X76 Y-78
+G1 X76 Y-81
+G1 X73 Y-81
+S0
+G0 X78 Y-81
+G0 X78 Y-81
+G0 X78 Y-81
+G0 X78 Y-81
+G0 X78 Y-81
+G0 X78 Y-77
+S1000
+G1 X80 Y-81
+G1 X83 Y-77
+S0
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-81
+G0 X85 Y-79
+S1000
+G1 X90 Y-79
+G1 X88 Y-76
+G1 X86 Y-76
+G1 X85 Y-78
+G1 X85 Y-81
+G1 X86 Y-81
+G1 X88 Y-81
+G1 X90 Y-81
+S0
+G0 X92 Y-81
+G0 X92 Y-81
+G0 X92 Y-81
+G0 X92 Y-81
+G0 X92 Y-81
+G0 X92 Y-81
+G0 X92 Y-81
+G0 X92 Y-81
+S1000
+G1 X92 Y-77
+S0
+G0 X92 Y-78
+S1000
+G1 X94 Y-77
+G1 X97 Y-78
+S0
+G0 X99 Y-81
+G0 X0 Y-93
+G0 X15 Y-93
+G0 X15 Y-93
+G0 X15 Y-93
+G0 X15 Y-93
+G0 X15 Y-93
+G0 X15 Y-93
+G0 X15 Y-93
+G0 X20 Y-93
+S1000
+G1 X18 Y-93
+G1 X16 Y-93
+G1 X16 Y-86
+S0
+G0 X15 Y-89
+S1000
+G1 X18 Y-89
+S0
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+G0 X22 Y-93
+S1000
+G1 X22 Y-86
+S0
+G0 X22 Y-90
+S1000
+G1 X24 Y-89
+G1 X27 Y-90
+G1 X27 Y-93
+S0
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-93
+G0 X29 Y-91
+S1000
+G1 X34 Y-91
+G1 X32 Y-88
+G1 X30 Y-88
+G1 X29 Y-90
+G1 X29 Y-93
+G1 X30 Y-93
+G1 X32 Y-93
+G1 X34 Y-93
+S0
+G0 X36 Y-93
+G0 X43 Y-93
+G0 X43 Y-93
+G0 X43 Y-93
+G0 X43 Y-93
+G0 X43 Y-93
+G0 X43 Y-93
+G0 X44 Y-93
+S1000
+G1 X46 Y-93
+S0
+G0 X45 Y-93
+S1000
+G1 X45 Y-86
+G1 X44 Y-86
+S0
+G0 X50 Y-93
+G0 X50 Y-93
+G0 X50 Y-93
+G0 X50 Y-93
+G0 X50 Y-93
+G0 X50 Y-93
+G0 X50 Y-93
+G0 X52 Y-93
+S1000
+G1 X52 Y-89
+G1 X51 Y-89
+S0
+G0 X52 Y-86
+S1000
+G1 X52 Y-86
+S0
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X57 Y-93
+G0 X62 Y-93
+S1000
+G1 X60 Y-93
+G1 X58 Y-93
+G1 X58 Y-86
+S0
+G0 X57 Y-89
+S1000
+G1 X60 Y-89
+S0
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X64 Y-93
+G0 X69 Y-93
+S1000
+G1 X67 Y-93
+G1 X65 Y-93
+G1 X65 Y-86
+S0
+G0 X64 Y-89
+S1000
+G1 X67 Y-89
+S0
+G0 X71 Y-93
+G0 X71 Y-93
+G0 X71 Y-93
+G0 X71 Y-93
+G0 X71 Y-93
+G0 X71 Y-93
+G0 X71 Y-93
+G0 X72 Y-93
+S1000
+G1 X74 Y-93
+S0
+G0 X73 Y-93
+S1000
+G1 X73 Y-86
+G1 X72 Y-86
+S0
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-93
+G0 X78 Y-91
+S1000
+G1 X83 Y-91
+G1 X81 Y-88
+G1 X79 Y-88
+G1 X78 Y-90
+G1 X78 Y-93
+G1 X79 Y-93
+G1 X81 Y-93
+G1 X83 Y-93
+S0
+G0 X85 Y-93
+G0 X0 Y0
+M0
+G0 X0 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+G0 X1 Y-7
+S1000
+G1 X1 Y0
+S0
+G0 X1 Y-4
+S1000
+G1 X3 Y-3
+G1 X6 Y-4
+G1 X6 Y-7
+S0
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-7
+G0 X8 Y-3
+S1000
+G1 X10 Y-2
+G1 X12 Y-3
+G1 X12 Y-7
+G1 X11 Y-7
+G1 X9 Y-7
+G1 X8 Y-7
+G1 X8 Y-5
+G1 X12 Y-5
+S0
+G0 X12 Y-7
+S1000
+G1 X13 Y-7
+S0
+G0 X15 Y-7
+G0 X15 Y-7
+G0 X15 Y-7
+G0 X15 Y-7
+G0 X15 Y-7
+G0 X15 Y-7
+G0 X15 Y-7
+G0 X15 Y-7
+S1000
+G1 X15 Y-3
+S0
+G0 X15 Y-4
+S1000
+G1 X17 Y-3
+G1 X20 Y-4
+S0
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+G0 X22 Y-7
+S1000
+G1 X22 Y0
+S0
+G0 X22 Y-4
+S1000
+G1 X24 Y-3
+G1 X27 Y-4
+G1 X27 Y-7
+G1 X24 Y-7
+G1 X22 Y-7
+S0
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X29 Y-7
+G0 X31 Y-7
+S1000
+G1 X29 Y-7
+G1 X29 Y-4
+G1 X31 Y-3
+G1 X34 Y-4
+G1 X34 Y-7
+G1 X31 Y-7
+S0
+G0 X36 Y-7
+G0 X36 Y-7
+G0 X36 Y-7
+G0 X36 Y-7
+G0 X36 Y-7
+G0 X36 Y-7
+G0 X36 Y-7
+G0 X36 Y-3
+S1000
+G1 X36 Y-7
+G1 X38 Y-7
+G1 X41 Y-7
+G1 X41 Y-3
+S0
+G0 X43 Y-7
+G0 X43 Y-7
+G0 X43 Y-7
+G0 X43 Y-7
+G0 X43 Y-7
+G0 X43 Y-7
+G0 X43 Y-7
+G0 X43 Y-7
+S1000
+G1 X43 Y-3
+S0
+G0 X43 Y-4
+S1000
+G1 X45 Y-3
+G1 X48 Y-4
+S0
+G0 X50 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+G0 X57 Y-7
+S1000
+G1 X57 Y0
+S0
+G0 X57 Y-4
+S1000
+G1 X59 Y-3
+G1 X62 Y-4
+G1 X62 Y-7
+G1 X59 Y-7
+G1 X57 Y-7
+S0
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-7
+G0 X64 Y-5
+S1000
+G1 X69 Y-5
+G1 X67 Y-2
+G1 X65 Y-2
+G1 X64 Y-4
+G1 X64 Y-7
+G1 X65 Y-7
+G1 X67 Y-7
+G1 X69 Y-7
+S0
+G0 X71 Y-7
+G0 X71 Y-7
+G0 X71 Y-7
+G0 X71 Y-7
+G0 X71 Y-7
+G0 X71 Y-7
+G0 X71 Y-7
+G0 X72 Y-7
+S1000
+G1 X74 Y-7
+S0
+G0 X73 Y-7
+S1000
+G1 X73 Y0
+G1 X72 Y0
+S0
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X78 Y-7
+G0 X80 Y-7
+S1000
+G1 X78 Y-7
+G1 X78 Y-4
+G1 X80 Y-3
+G1 X83 Y-4
+G1 X83 Y-7
+G1 X80 Y-7
+S0
+G0 X85 Y-7
+G0 X85 Y-7
+G0 X85 Y-7
+G0 X85 Y-7
+G0 X85 Y-7
+G0 X85 Y-7
+G0 X85 Y-7
+G0 X85 Y-3
+S1000
+G1 X86 Y-7
+G1 X87 Y-4
+G1 X88 Y-7
+G1 X90 Y-3
+S0
+G0 X92 Y-7
+G0 X92 Y-7
+G0 X92 Y-7
+G0 X92 Y-7
+G0 X92 Y-7
+G0 X94 Y-7
+S1000
+G1 X94 Y-7
+G1 X94 Y-7
+S0
+G0 X99 Y-7
+G0 X0 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+S1000
+G1 X1 Y-12
+G1 X4 Y-12
+G1 X6 Y-13
+G1 X6 Y-15
+G1 X4 Y-16
+G1 X1 Y-16
+S0
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+S1000
+G1 X8 Y-15
+S0
+G0 X8 Y-16
+S1000
+G1 X10 Y-15
+G1 X13 Y-16
+G1 X13 Y-19
+S0
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-17
+S1000
+G1 X20 Y-17
+G1 X18 Y-14
+G1 X16 Y-14
+G1 X15 Y-16
+G1 X15 Y-19
+G1 X16 Y-19
+G1 X18 Y-19
+G1 X20 Y-19
+S0
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-15
+S1000
+G1 X22 Y-19
+G1 X24 Y-19
+G1 X27 Y-19
+G1 X27 Y-15
+S0
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+G0 X29 Y-19
+S1000
+G1 X29 Y-14
+S0
+G0 X29 Y-16
+S1000
+G1 X30 Y-14
+G1 X31 Y-16
+G1 X31 Y-19
+S0
+G0 X31 Y-16
+S1000
+G1 X33 Y-14
+G1 X34 Y-16
+G1 X34 Y-19
+S0
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X38 Y-19
+S1000
+G1 X36 Y-19
+G1 X36 Y-16
+G1 X38 Y-15
+G1 X41 Y-16
+G1 X41 Y-19
+G1 X38 Y-19
+S0
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+S1000
+G1 X43 Y-15
+S0
+G0 X43 Y-16
+S1000
+G1 X45 Y-15
+G1 X48 Y-16
+G1 X48 Y-19
+S0
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X52 Y-19
+S1000
+G1 X50 Y-19
+G1 X50 Y-16
+G1 X52 Y-15
+G1 X55 Y-16
+G1 X55 Y-19
+G1 X52 Y-19
+S0
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-15
+S1000
+G1 X57 Y-19
+G1 X59 Y-19
+G1 X62 Y-19
+G1 X62 Y-15
+S0
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X65 Y-19
+S1000
+G1 X67 Y-19
+S0
+G0 X66 Y-19
+S1000
+G1 X66 Y-12
+G1 X65 Y-12
+S0
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X76 Y-19
+S1000
+G1 X74 Y-19
+G1 X72 Y-19
+G1 X72 Y-12
+S0
+G0 X71 Y-15
+S1000
+G1 X74 Y-15
+S0
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+G0 X78 Y-19
+S1000
+G1 X78 Y-15
+S0
+G0 X78 Y-16
+S1000
+G1 X80 Y-15
+G1 X83 Y-16
+S0
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-15
+S1000
+G1 X87 Y-14
+G1 X89 Y-15
+G1 X89 Y-19
+G1 X88 Y-19
+G1 X86 Y-19
+G1 X85 Y-19
+G1 X85 Y-17
+G1 X89 Y-17
+S0
+G0 X89 Y-19
+S1000
+G1 X90 Y-19
+S0
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+S1000
+G1 X92 Y-14
+S0
+G0 X92 Y-16
+S1000
+G1 X93 Y-14
+G1 X94 Y-16
+G1 X94 Y-19
+S0
+G0 X94 Y-16
+S1000
+G1 X96 Y-14
+G1 X97 Y-16
+G1 X97 Y-19
+S0
+G0 X99 Y-19
+G0 X0 Y-31
+G0 X1 Y-31
+G0 X1 Y-31
+G0 X1 Y-31
+G0 X1 Y-31
+G0 X1 Y-31
+G0 X1 Y-31
+G0 X3 Y-31
+S1000
+G1 X3 Y-27
+G1 X2 Y-27
+S0
+G0 X3 Y-24
+S1000
+G1 X3 Y-24
+S0
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X8 Y-31
+G0 X12 Y-28
+S1000
+G1 X10 Y-27
+G1 X8 Y-28
+G1 X8 Y-31
+G1 X10 Y-31
+G1 X12 Y-31
+S0
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+S1000
+G1 X15 Y-27
+S0
+G0 X15 Y-28
+S1000
+G1 X17 Y-27
+G1 X20 Y-28
+S0
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X24 Y-31
+S1000
+G1 X22 Y-31
+G1 X22 Y-28
+G1 X24 Y-27
+G1 X27 Y-28
+G1 X27 Y-31
+G1 X24 Y-31
+S0
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+S1000
+G1 X31 Y-31
+G1 X34 Y-31
+G1 X34 Y-29
+G1 X29 Y-29
+G1 X29 Y-27
+G1 X31 Y-26
+G1 X34 Y-27
+S0
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X40 Y-28
+S1000
+G1 X38 Y-27
+G1 X36 Y-28
+G1 X36 Y-31
+G1 X38 Y-31
+G1 X40 Y-31
+S0
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X45 Y-31
+S1000
+G1 X43 Y-31
+G1 X43 Y-28
+G1 X45 Y-27
+G1 X48 Y-28
+G1 X48 Y-31
+G1 X45 Y-31
+S0
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-31
+G0 X50 Y-33
+S1000
+G1 X50 Y-27
+S0
+G0 X50 Y-28
+S1000
+G1 X52 Y-27
+G1 X55 Y-28
+G1 X55 Y-31
+G1 X52 Y-31
+G1 X50 Y-31
+S0
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X59 Y-31
+S1000
+G1 X59 Y-27
+G1 X58 Y-27
+S0
+G0 X59 Y-24
+S1000
+G1 X59 Y-24
+S0
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X68 Y-28
+S1000
+G1 X66 Y-27
+G1 X64 Y-28
+G1 X64 Y-31
+G1 X66 Y-31
+G1 X68 Y-31
+S0
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+S1000
+G1 X73 Y-31
+G1 X76 Y-31
+G1 X76 Y-29
+G1 X71 Y-29
+G1 X71 Y-27
+G1 X73 Y-26
+G1 X76 Y-27
+S0
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X80 Y-31
+S1000
+G1 X80 Y-27
+G1 X79 Y-27
+S0
+G0 X80 Y-24
+S1000
+G1 X80 Y-24
+S0
+G0 X85 Y-31
+G0 X85 Y-31
+G0 X85 Y-31
+G0 X85 Y-31
+G0 X85 Y-31
+G0 X85 Y-31
+G0 X85 Y-31
+G0 X86 Y-31
+S1000
+G1 X88 Y-31
+S0
+G0 X87 Y-31
+S1000
+G1 X87 Y-24
+G1 X86 Y-24
+S0
+G0 X92 Y-31
+G0 X92 Y-31
+G0 X92 Y-31
+G0 X92 Y-31
+G0 X92 Y-31
+G0 X92 Y-31
+G0 X92 Y-31
+G0 X94 Y-31
+S1000
+G1 X94 Y-27
+G1 X93 Y-27
+S0
+G0 X94 Y-24
+S1000
+G1 X94 Y-24
+S0
+G0 X99 Y-31
+G0 X0 Y-45
+G0 X1 Y-45
+G0 X1 Y-45
+G0 X1 Y-45
+G0 X1 Y-45
+G0 X1 Y-45
+G0 X1 Y-45
+G0 X1 Y-45
+G0 X5 Y-42
+S1000
+G1 X3 Y-41
+G1 X1 Y-42
+G1 X1 Y-45
+G1 X3 Y-45
+G1 X5 Y-45
+S0
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X8 Y-45
+G0 X10 Y-45
+S1000
+G1 X8 Y-45
+G1 X8 Y-42
+G1 X10 Y-41
+G1 X13 Y-42
+G1 X13 Y-45
+G1 X10 Y-45
+S0
+G0 X15 Y-45
+G0 X15 Y-45
+G0 X15 Y-45
+G0 X15 Y-45
+G0 X15 Y-45
+G0 X15 Y-41
+S1000
+G1 X17 Y-45
+G1 X20 Y-41
+S0
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X22 Y-45
+G0 X24 Y-45
+S1000
+G1 X22 Y-45
+G1 X22 Y-42
+G1 X24 Y-41
+G1 X27 Y-42
+G1 X27 Y-45
+G1 X24 Y-45
+S0
+G0 X29 Y-45
+G0 X29 Y-45
+G0 X29 Y-45
+G0 X29 Y-45
+G0 X29 Y-45
+G0 X29 Y-45
+G0 X29 Y-45
+G0 X30 Y-45
+S1000
+G1 X32 Y-45
+S0
+G0 X31 Y-45
+S1000
+G1 X31 Y-38
+G1 X30 Y-38
+S0
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X36 Y-45
+G0 X40 Y-42
+S1000
+G1 X38 Y-41
+G1 X36 Y-42
+G1 X36 Y-45
+G1 X38 Y-45
+G1 X40 Y-45
+S0
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-45
+G0 X43 Y-41
+S1000
+G1 X45 Y-40
+G1 X47 Y-41
+G1 X47 Y-45
+G1 X46 Y-45
+G1 X44 Y-45
+G1 X43 Y-45
+G1 X43 Y-43
+G1 X47 Y-43
+S0
+G0 X47 Y-45
+S1000
+G1 X48 Y-45
+S0
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+G0 X50 Y-45
+S1000
+G1 X50 Y-41
+S0
+G0 X50 Y-42
+S1000
+G1 X52 Y-41
+G1 X55 Y-42
+G1 X55 Y-45
+S0
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X57 Y-45
+G0 X59 Y-45
+S1000
+G1 X57 Y-45
+G1 X57 Y-42
+G1 X59 Y-41
+G1 X62 Y-42
+G1 X62 Y-45
+G1 X59 Y-45
+S0
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X64 Y-45
+G0 X68 Y-42
+S1000
+G1 X66 Y-41
+G1 X64 Y-42
+G1 X64 Y-45
+G1 X66 Y-45
+G1 X68 Y-45
+S0
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X71 Y-45
+G0 X73 Y-45
+S1000
+G1 X71 Y-45
+G1 X71 Y-42
+G1 X73 Y-41
+G1 X76 Y-42
+G1 X76 Y-45
+G1 X73 Y-45
+S0
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+G0 X78 Y-45
+S1000
+G1 X78 Y-41
+S0
+G0 X78 Y-42
+S1000
+G1 X80 Y-41
+G1 X83 Y-42
+G1 X83 Y-45
+S0
+G0 X85 Y-45
+G0 X85 Y-45
+G0 X85 Y-45
+G0 X85 Y-45
+G0 X85 Y-45
+G0 X85 Y-45
+G0 X85 Y-45
+G0 X87 Y-45
+S1000
+G1 X87 Y-41
+G1 X86 Y-41
+S0
+G0 X87 Y-38
+S1000
+G1 X87 Y-38
+S0
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X92 Y-45
+G0 X94 Y-45
+S1000
+G1 X92 Y-45
+G1 X92 Y-42
+G1 X94 Y-41
+G1 X97 Y-42
+G1 X97 Y-45
+G1 X94 Y-45
+S0
+G0 X99 Y-45
+G0 X0 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+G0 X39 Y-57
+S1000
+G1 X41 Y-57
+G1 X44 Y-57
+G1 X44 Y-55
+G1 X39 Y-55
+G1 X39 Y-53
+G1 X41 Y-52
+G1 X44 Y-53
+S0
+G0 X46 Y-57
+G0 X46 Y-57
+G0 X46 Y-57
+G0 X46 Y-57
+G0 X46 Y-57
+G0 X46 Y-57
+G0 X46 Y-57
+G0 X48 Y-57
+S1000
+G1 X48 Y-53
+G1 X47 Y-53
+S0
+G0 X48 Y-50
+S1000
+G1 X48 Y-50
+S0
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+G0 X53 Y-57
+S1000
+G1 X55 Y-57
+G1 X58 Y-57
+G1 X58 Y-55
+G1 X53 Y-55
+G1 X53 Y-53
+G1 X55 Y-52
+G1 X58 Y-53
+S0
+G0 X60 Y-57
+G0 X0 Y-69
+G0 X4 Y-69
+G0 X4 Y-69
+G0 X4 Y-69
+G0 X4 Y-69
+G0 X4 Y-69
+G0 X4 Y-69
+G0 X4 Y-69
+S1000
+G1 X6 Y-62
+G1 X9 Y-69
+S0
+G0 X5 Y-66
+S1000
+G1 X7 Y-66
+S0
+G0 X11 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+G0 X18 Y-69
+S1000
+G1 X20 Y-69
+G1 X23 Y-69
+G1 X23 Y-67
+G1 X18 Y-67
+G1 X18 Y-65
+G1 X20 Y-64
+G1 X23 Y-65
+S0
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+G0 X25 Y-69
+S1000
+G1 X25 Y-62
+S0
+G0 X25 Y-66
+S1000
+G1 X27 Y-65
+G1 X30 Y-66
+G1 X30 Y-69
+S0
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X32 Y-69
+G0 X34 Y-69
+S1000
+G1 X32 Y-69
+G1 X32 Y-66
+G1 X34 Y-65
+G1 X37 Y-66
+G1 X37 Y-69
+G1 X34 Y-69
+S0
+G0 X39 Y-69
+G0 X39 Y-69
+G0 X39 Y-69
+G0 X39 Y-69
+G0 X39 Y-69
+G0 X39 Y-69
+G0 X39 Y-69
+G0 X39 Y-69
+S1000
+G1 X39 Y-65
+S0
+G0 X39 Y-66
+S1000
+G1 X41 Y-65
+G1 X44 Y-66
+S0
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X46 Y-69
+G0 X51 Y-69
+S1000
+G1 X49 Y-69
+G1 X47 Y-69
+G1 X47 Y-62
+S0
+G0 X46 Y-65
+S1000
+G1 X49 Y-65
+S0
+G0 X53 Y-69
+G0 X60 Y-69
+G0 X60 Y-69
+G0 X60 Y-69
+G0 X60 Y-69
+G0 X60 Y-69
+G0 X60 Y-69
+G0 X61 Y-69
+S1000
+G1 X63 Y-69
+S0
+G0 X62 Y-69
+S1000
+G1 X62 Y-62
+G1 X61 Y-62
+S0
+G0 X67 Y-69
+G0 X67 Y-69
+G0 X67 Y-69
+G0 X67 Y-69
+G0 X67 Y-69
+G0 X67 Y-69
+G0 X67 Y-69
+G0 X69 Y-69
+S1000
+G1 X69 Y-65
+G1 X68 Y-65
+S0
+G0 X69 Y-62
+S1000
+G1 X69 Y-62
+S0
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+G0 X74 Y-69
+S1000
+G1 X74 Y-65
+S0
+G0 X74 Y-66
+S1000
+G1 X76 Y-65
+G1 X79 Y-66
+G1 X79 Y-69
+S0
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-69
+G0 X81 Y-67
+S1000
+G1 X86 Y-67
+G1 X84 Y-64
+G1 X82 Y-64
+G1 X81 Y-66
+G1 X81 Y-69
+G1 X82 Y-69
+G1 X84 Y-69
+G1 X86 Y-69
+S0
+G0 X88 Y-69
+G0 X88 Y-69
+G0 X88 Y-69
+G0 X88 Y-69
+G0 X88 Y-69
+G0 X89 Y-70
+S1000
+G1 X90 Y-69
+G1 X90 Y-69
+S0
+G0 X95 Y-69
+G0 X0 Y-82
+G0 X4 Y-82
+G0 X4 Y-82
+G0 X4 Y-82
+G0 X4 Y-82
+G0 X4 Y-82
+G0 X4 Y-82
+G0 X4 Y-82
+G0 X9 Y-82
+S1000
+G1 X7 Y-82
+G1 X5 Y-82
+G1 X5 Y-75
+S0
+G0 X4 Y-78
+S1000
+G1 X7 Y-78
+S0
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+G0 X11 Y-82
+S1000
+G1 X11 Y-75
+S0
+G0 X11 Y-79
+S1000
+G1 X13 Y-78
+G1 X16 Y-79
+G1 X16 Y-82
+S0
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-82
+G0 X18 Y-80
+S1000
+G1 X23 Y-80
+G1 X21 Y-77
+G1 X19 Y-77
+G1 X18 Y-79
+G1 X18 Y-82
+G1 X19 Y-82
+G1 X21 Y-82
+G1 X23 Y-82
+S0
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+G0 X25 Y-82
+S1000
+G1 X25 Y-78
+S0
+G0 X25 Y-79
+S1000
+G1 X27 Y-78
+G1 X30 Y-79
+G1 X30 Y-82
+S0
+G0 X32 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-82
+G0 X39 Y-78
+S1000
+G1 X41 Y-77
+G1 X43 Y-78
+G1 X43 Y-82
+G1 X42 Y-82
+G1 X40 Y-82
+G1 X39 Y-82
+G1 X39 Y-80
+G1 X43 Y-80
+S0
+G0 X43 Y-82
+S1000
+G1 X44 Y-82
+S0
+G0 X46 Y-82
+G0 X53 Y-82
+G0 X53 Y-82
+G0 X53 Y-82
+G0 X53 Y-82
+G0 X53 Y-82
+G0 X53 Y-82
+G0 X54 Y-82
+S1000
+G1 X56 Y-82
+S0
+G0 X55 Y-82
+S1000
+G1 X55 Y-75
+G1 X54 Y-75
+S0
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X60 Y-82
+G0 X62 Y-82
+S1000
+G1 X60 Y-82
+G1 X60 Y-79
+G1 X62 Y-78
+G1 X65 Y-79
+G1 X65 Y-82
+G1 X62 Y-82
+S0
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+G0 X67 Y-82
+S1000
+G1 X67 Y-78
+S0
+G0 X67 Y-79
+S1000
+G1 X69 Y-78
+G1 X72 Y-79
+G1 X72 Y-82
+S0
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X74 Y-82
+G0 X78 Y-82
+S1000
+G1 X76 Y-82
+G1 X74 Y-82
+G1 X74 Y-79
+G1 X76 Y-78
+G1 X78 Y-79
+S0
+G0 X78 Y-78
+S1000
+G1 X78 Y-84
+G1 X76 Y-84
+G1 X74 Y-84
+S0
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-82
+G0 X81 Y-80
+S1000
+G1 X86 Y-80
+G1 X84 Y-77
+G1 X82 Y-77
+G1 X81 Y-79
+G1 X81 Y-82
+G1 X82 Y-82
+G1 X84 Y-82
+G1 X86 Y-82
+S0
+G0 X88 Y-82
+G0 X88 Y-82
+G0 X88 Y-82
+G0 X88 Y-82
+G0 X88 Y-82
+G0 X88 Y-82
+G0 X88 Y-82
+G0 X88 Y-82
+S1000
+G1 X88 Y-78
+S0
+G0 X88 Y-79
+S1000
+G1 X90 Y-78
+G1 X93 Y-79
+S0
+G0 X95 Y-82
+G0 X0 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X11 Y-96
+G0 X13 Y-96
+S1000
+G1 X11 Y-96
+G1 X11 Y-93
+G1 X13 Y-92
+G1 X16 Y-93
+G1 X16 Y-96
+G1 X13 Y-96
+S0
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+G0 X18 Y-96
+S1000
+G1 X18 Y-92
+S0
+G0 X18 Y-93
+S1000
+G1 X20 Y-92
+G1 X23 Y-93
+G1 X23 Y-96
+S0
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-96
+G0 X25 Y-94
+S1000
+G1 X30 Y-94
+G1 X28 Y-91
+G1 X26 Y-91
+G1 X25 Y-93
+G1 X25 Y-96
+G1 X26 Y-96
+G1 X28 Y-96
+G1 X30 Y-96
+S0
+G0 X32 Y-96
+G0 X39 Y-96
+G0 X39 Y-96
+G0 X39 Y-96
+G0 X39 Y-96
+G0 X39 Y-96
+G0 X39 Y-96
+G0 X39 Y-96
+G0 X44 Y-96
+S1000
+G1 X42 Y-96
+G1 X40 Y-96
+G1 X40 Y-89
+S0
+G0 X39 Y-92
+S1000
+G1 X42 Y-92
+S0
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X46 Y-96
+G0 X48 Y-96
+S1000
+G1 X46 Y-96
+G1 X46 Y-93
+G1 X48 Y-92
+G1 X51 Y-93
+G1 X51 Y-96
+G1 X48 Y-96
+S0
+G0 X53 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X60 Y-96
+G0 X64 Y-96
+S1000
+G1 X62 Y-96
+G1 X60 Y-96
+G1 X60 Y-93
+G1 X62 Y-92
+G1 X64 Y-93
+S0
+G0 X64 Y-92
+S1000
+G1 X64 Y-98
+G1 X62 Y-98
+G1 X60 Y-98
+S0
+G0 X67 Y-96
+G0 X67 Y-96
+G0 X67 Y-96
+G0 X67 Y-96
+G0 X67 Y-96
+G0 X67 Y-96
+G0 X67 Y-96
+G0 X69 Y-96
+S1000
+G1 X69 Y-92
+G1 X68 Y-92
+S0
+G0 X69 Y-89
+S1000
+G1 X69 Y-89
+S0
+G0 X74 Y-96
+G0 X74 Y-96
+G0 X74 Y-96
+G0 X74 Y-96
+G0 X74 Y-96
+G0 X74 Y-92
+S1000
+G1 X76 Y-96
+G1 X79 Y-92
+S0
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-96
+G0 X81 Y-94
+S1000
+G1 X86 Y-94
+G1 X84 Y-91
+G1 X82 Y-91
+G1 X81 Y-93
+G1 X81 Y-96
+G1 X82 Y-96
+G1 X84 Y-96
+G1 X86 Y-96
+S0
+G0 X88 Y-96
+G0 X0 Y0
+M0
+G0 X0 Y-7
+G0 X4 Y-7
+G0 X4 Y-7
+G0 X4 Y-7
+G0 X4 Y-7
+G0 X4 Y-7
+G0 X4 Y-7
+G0 X4 Y-7
+G0 X9 Y-7
+S1000
+G1 X7 Y-7
+G1 X5 Y-7
+G1 X5 Y0
+S0
+G0 X4 Y-3
+S1000
+G1 X7 Y-3
+S0
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+G0 X11 Y-7
+S1000
+G1 X11 Y0
+S0
+G0 X11 Y-4
+S1000
+G1 X13 Y-3
+G1 X16 Y-4
+G1 X16 Y-7
+S0
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-7
+G0 X18 Y-5
+S1000
+G1 X23 Y-5
+G1 X21 Y-2
+G1 X19 Y-2
+G1 X18 Y-4
+G1 X18 Y-7
+G1 X19 Y-7
+G1 X21 Y-7
+G1 X23 Y-7
+S0
+G0 X25 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+G0 X32 Y-7
+S1000
+G1 X32 Y0
+S0
+G0 X32 Y-4
+S1000
+G1 X34 Y-3
+G1 X37 Y-4
+G1 X37 Y-7
+G1 X34 Y-7
+G1 X32 Y-7
+S0
+G0 X39 Y-7
+G0 X39 Y-7
+G0 X39 Y-7
+G0 X39 Y-7
+G0 X39 Y-7
+G0 X39 Y-7
+G0 X39 Y-7
+G0 X39 Y-7
+S1000
+G1 X39 Y-3
+S0
+G0 X39 Y-4
+S1000
+G1 X41 Y-3
+G1 X44 Y-4
+S0
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-7
+G0 X46 Y-5
+S1000
+G1 X51 Y-5
+G1 X49 Y-2
+G1 X47 Y-2
+G1 X46 Y-4
+G1 X46 Y-7
+G1 X47 Y-7
+G1 X49 Y-7
+G1 X51 Y-7
+S0
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-7
+G0 X53 Y-3
+S1000
+G1 X55 Y-2
+G1 X57 Y-3
+G1 X57 Y-7
+G1 X56 Y-7
+G1 X54 Y-7
+G1 X53 Y-7
+G1 X53 Y-5
+G1 X57 Y-5
+S0
+G0 X57 Y-7
+S1000
+G1 X58 Y-7
+S0
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+G0 X60 Y-7
+S1000
+G1 X60 Y0
+S0
+G0 X60 Y-5
+S1000
+G1 X65 Y-3
+S0
+G0 X61 Y-5
+S1000
+G1 X65 Y-7
+S0
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-7
+G0 X67 Y-5
+S1000
+G1 X72 Y-5
+G1 X70 Y-2
+G1 X68 Y-2
+G1 X67 Y-4
+G1 X67 Y-7
+G1 X68 Y-7
+G1 X70 Y-7
+G1 X72 Y-7
+S0
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+G0 X74 Y-7
+S1000
+G1 X74 Y-3
+S0
+G0 X74 Y-4
+S1000
+G1 X76 Y-3
+G1 X79 Y-4
+S0
+G0 X81 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-7
+G0 X88 Y-3
+S1000
+G1 X90 Y-2
+G1 X92 Y-3
+G1 X92 Y-7
+G1 X91 Y-7
+G1 X89 Y-7
+G1 X88 Y-7
+G1 X88 Y-5
+G1 X92 Y-5
+S0
+G0 X92 Y-7
+S1000
+G1 X93 Y-7
+S0
+G0 X95 Y-7
+G0 X0 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+G0 X1 Y-19
+S1000
+G1 X1 Y-15
+S0
+G0 X1 Y-16
+S1000
+G1 X3 Y-15
+G1 X6 Y-16
+S0
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-19
+G0 X8 Y-17
+S1000
+G1 X13 Y-17
+G1 X11 Y-14
+G1 X9 Y-14
+G1 X8 Y-16
+G1 X8 Y-19
+G1 X9 Y-19
+G1 X11 Y-19
+G1 X13 Y-19
+S0
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-19
+G0 X15 Y-15
+S1000
+G1 X17 Y-14
+G1 X19 Y-15
+G1 X19 Y-19
+G1 X18 Y-19
+G1 X16 Y-19
+G1 X15 Y-19
+G1 X15 Y-17
+G1 X19 Y-17
+S0
+G0 X19 Y-19
+S1000
+G1 X20 Y-19
+S0
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X22 Y-19
+G0 X23 Y-19
+S1000
+G1 X25 Y-19
+S0
+G0 X24 Y-19
+S1000
+G1 X24 Y-12
+G1 X23 Y-12
+S0
+G0 X29 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X36 Y-19
+G0 X40 Y-16
+S1000
+G1 X38 Y-15
+G1 X36 Y-16
+G1 X36 Y-19
+G1 X38 Y-19
+G1 X40 Y-19
+S0
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+G0 X43 Y-19
+S1000
+G1 X43 Y-12
+S0
+G0 X43 Y-16
+S1000
+G1 X45 Y-15
+G1 X48 Y-16
+G1 X48 Y-19
+S0
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X50 Y-19
+G0 X52 Y-19
+S1000
+G1 X50 Y-19
+G1 X50 Y-16
+G1 X52 Y-15
+G1 X55 Y-16
+G1 X55 Y-19
+G1 X52 Y-19
+S0
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X57 Y-19
+G0 X59 Y-19
+S1000
+G1 X59 Y-15
+G1 X58 Y-15
+S0
+G0 X59 Y-12
+S1000
+G1 X59 Y-12
+S0
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X64 Y-19
+G0 X68 Y-16
+S1000
+G1 X66 Y-15
+G1 X64 Y-16
+G1 X64 Y-19
+G1 X66 Y-19
+G1 X68 Y-19
+S0
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-19
+G0 X71 Y-17
+S1000
+G1 X76 Y-17
+G1 X74 Y-14
+G1 X72 Y-14
+G1 X71 Y-16
+G1 X71 Y-19
+G1 X72 Y-19
+G1 X74 Y-19
+G1 X76 Y-19
+S0
+G0 X78 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X85 Y-19
+G0 X87 Y-19
+S1000
+G1 X85 Y-19
+G1 X85 Y-16
+G1 X87 Y-15
+G1 X90 Y-16
+G1 X90 Y-19
+G1 X87 Y-19
+S0
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X92 Y-19
+G0 X93 Y-19
+S1000
+G1 X93 Y-13
+G1 X95 Y-12
+G1 X97 Y-13
+S0
+G0 X92 Y-16
+S1000
+G1 X95 Y-16
+S0
+G0 X99 Y-19
+G0 X0 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-31
+G0 X15 Y-27
+S1000
+G1 X16 Y-31
+G1 X17 Y-28
+G1 X18 Y-31
+G1 X20 Y-27
+S0
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+G0 X22 Y-31
+S1000
+G1 X22 Y-24
+S0
+G0 X22 Y-28
+S1000
+G1 X24 Y-27
+G1 X27 Y-28
+G1 X27 Y-31
+S0
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-31
+G0 X29 Y-29
+S1000
+G1 X34 Y-29
+G1 X32 Y-26
+G1 X30 Y-26
+G1 X29 Y-28
+G1 X29 Y-31
+G1 X30 Y-31
+G1 X32 Y-31
+G1 X34 Y-31
+S0
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+G0 X36 Y-31
+S1000
+G1 X36 Y-27
+S0
+G0 X36 Y-28
+S1000
+G1 X38 Y-27
+G1 X41 Y-28
+S0
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-31
+G0 X43 Y-29
+S1000
+G1 X48 Y-29
+G1 X46 Y-26
+G1 X44 Y-26
+G1 X43 Y-28
+G1 X43 Y-31
+G1 X44 Y-31
+G1 X46 Y-31
+G1 X48 Y-31
+S0
+G0 X50 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-31
+G0 X57 Y-29
+S1000
+G1 X62 Y-29
+G1 X60 Y-26
+G1 X58 Y-26
+G1 X57 Y-28
+G1 X57 Y-31
+G1 X58 Y-31
+G1 X60 Y-31
+G1 X62 Y-31
+S0
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-31
+G0 X64 Y-27
+S1000
+G1 X66 Y-26
+G1 X68 Y-27
+G1 X68 Y-31
+G1 X67 Y-31
+G1 X65 Y-31
+G1 X64 Y-31
+G1 X64 Y-29
+G1 X68 Y-29
+S0
+G0 X68 Y-31
+S1000
+G1 X69 Y-31
+S0
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X71 Y-31
+G0 X75 Y-28
+S1000
+G1 X73 Y-27
+G1 X71 Y-28
+G1 X71 Y-31
+G1 X73 Y-31
+G1 X75 Y-31
+S0
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+G0 X78 Y-31
+S1000
+G1 X78 Y-24
+S0
+G0 X78 Y-28
+S1000
+G1 X80 Y-27
+G1 X83 Y-28
+G1 X83 Y-31
+S0
+G0 X85 Y-31
+G0 X0 Y-43
+G0 X11 Y-43
+G0 X11 Y-43
+G0 X11 Y-43
+G0 X11 Y-43
+G0 X11 Y-43
+G0 X11 Y-43
+G0 X12 Y-43
+S1000
+G1 X14 Y-43
+S0
+G0 X13 Y-43
+S1000
+G1 X13 Y-36
+G1 X12 Y-36
+S0
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X18 Y-43
+G0 X20 Y-43
+S1000
+G1 X20 Y-39
+G1 X19 Y-39
+S0
+G0 X20 Y-36
+S1000
+G1 X20 Y-36
+S0
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+G0 X25 Y-43
+S1000
+G1 X25 Y-39
+S0
+G0 X25 Y-40
+S1000
+G1 X27 Y-39
+G1 X30 Y-40
+G1 X30 Y-43
+S0
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-43
+G0 X32 Y-41
+S1000
+G1 X37 Y-41
+G1 X35 Y-38
+G1 X33 Y-38
+G1 X32 Y-40
+G1 X32 Y-43
+G1 X33 Y-43
+G1 X35 Y-43
+G1 X37 Y-43
+S0
+G0 X39 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+G0 X46 Y-43
+S1000
+G1 X48 Y-43
+G1 X51 Y-43
+G1 X51 Y-41
+G1 X46 Y-41
+G1 X46 Y-39
+G1 X48 Y-38
+G1 X51 Y-39
+S0
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+G0 X53 Y-43
+S1000
+G1 X53 Y-36
+S0
+G0 X53 Y-40
+S1000
+G1 X55 Y-39
+G1 X58 Y-40
+G1 X58 Y-43
+S0
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X60 Y-43
+G0 X62 Y-43
+S1000
+G1 X60 Y-43
+G1 X60 Y-40
+G1 X62 Y-39
+G1 X65 Y-40
+G1 X65 Y-43
+G1 X62 Y-43
+S0
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-43
+G0 X67 Y-39
+S1000
+G1 X67 Y-43
+G1 X69 Y-43
+G1 X72 Y-43
+G1 X72 Y-39
+S0
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X74 Y-43
+G0 X75 Y-43
+S1000
+G1 X77 Y-43
+S0
+G0 X76 Y-43
+S1000
+G1 X76 Y-36
+G1 X75 Y-36
+S0
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X81 Y-43
+G0 X86 Y-43
+S1000
+G1 X83 Y-43
+G1 X81 Y-43
+G1 X81 Y-40
+G1 X83 Y-39
+G1 X86 Y-40
+S0
+G0 X86 Y-36
+S1000
+G1 X86 Y-43
+S0
+G0 X88 Y-43
+G0 X0 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-55
+G0 X36 Y-53
+S1000
+G1 X41 Y-53
+G1 X39 Y-50
+G1 X37 Y-50
+G1 X36 Y-52
+G1 X36 Y-55
+G1 X37 Y-55
+G1 X39 Y-55
+G1 X41 Y-55
+S0
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+G0 X43 Y-55
+S1000
+G1 X43 Y-51
+S0
+G0 X43 Y-52
+S1000
+G1 X45 Y-51
+G1 X48 Y-52
+G1 X48 Y-55
+S0
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X55 Y-55
+S1000
+G1 X52 Y-55
+G1 X50 Y-55
+G1 X50 Y-52
+G1 X52 Y-51
+G1 X55 Y-52
+S0
+G0 X55 Y-48
+S1000
+G1 X55 Y-55
+S0
+G0 X57 Y-55
+G0 X57 Y-55
+G0 X57 Y-55
+G0 X57 Y-55
+G0 X57 Y-55
+G0 X59 Y-55
+S1000
+G1 X59 Y-55
+G1 X59 Y-55
+S0
+G0 X64 Y-55
+G0 X0 Y-67
+G0 X0 Y0
@@ -0,0 +1,4028 @@
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X3 Y-10
+S1000
+G1 X3 Y0
+S0
+G0 X0 Y0
+S1000
+G1 X6 Y0
+S0
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+S1000
+G1 X10 Y0
+S0
+G0 X10 Y-5
+S1000
+G1 X13 Y-4
+G1 X16 Y-5
+G1 X16 Y-10
+S0
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-7
+S1000
+G1 X26 Y-7
+G1 X25 Y-4
+G1 X21 Y-4
+G1 X20 Y-5
+G1 X20 Y-9
+G1 X21 Y-10
+G1 X25 Y-10
+G1 X26 Y-9
+S0
+G0 X30 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-4
+S1000
+G1 X51 Y-10
+G1 X53 Y-6
+G1 X55 Y-10
+G1 X56 Y-4
+S0
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-5
+S1000
+G1 X62 Y-4
+G1 X66 Y-5
+G1 X66 Y-9
+G1 X64 Y-10
+G1 X62 Y-10
+G1 X60 Y-9
+G1 X60 Y-8
+G1 X66 Y-7
+S0
+G0 X66 Y-9
+S1000
+G1 X67 Y-10
+S0
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-4
+S1000
+G1 X73 Y-10
+G1 X76 Y-4
+S0
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-7
+S1000
+G1 X86 Y-7
+G1 X85 Y-4
+G1 X81 Y-4
+G1 X80 Y-5
+G1 X80 Y-9
+G1 X81 Y-10
+G1 X85 Y-10
+G1 X86 Y-9
+S0
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-9
+S1000
+G1 X93 Y-10
+G1 X96 Y-9
+G1 X96 Y-8
+G1 X90 Y-7
+G1 X90 Y-5
+G1 X93 Y-4
+G1 X96 Y-5
+S0
+G0 X100 Y-10
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X6 Y-20
+S1000
+G1 X3 Y-19
+G1 X0 Y-20
+G1 X0 Y-24
+G1 X3 Y-25
+G1 X6 Y-24
+S0
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+S1000
+G1 X10 Y-19
+S0
+G0 X10 Y-21
+S1000
+G1 X13 Y-19
+G1 X16 Y-21
+S0
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-20
+S1000
+G1 X22 Y-19
+G1 X26 Y-20
+G1 X26 Y-24
+G1 X24 Y-25
+G1 X22 Y-25
+G1 X20 Y-24
+G1 X20 Y-23
+G1 X26 Y-22
+S0
+G0 X26 Y-24
+S1000
+G1 X27 Y-25
+S0
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-24
+S1000
+G1 X33 Y-25
+G1 X36 Y-24
+G1 X36 Y-23
+G1 X30 Y-22
+G1 X30 Y-20
+G1 X33 Y-19
+G1 X36 Y-20
+S0
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+S1000
+G1 X40 Y-15
+S0
+G0 X40 Y-20
+S1000
+G1 X43 Y-19
+G1 X46 Y-20
+G1 X46 Y-25
+S0
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-22
+S1000
+G1 X56 Y-22
+G1 X55 Y-19
+G1 X51 Y-19
+G1 X50 Y-20
+G1 X50 Y-24
+G1 X51 Y-25
+G1 X55 Y-25
+G1 X56 Y-24
+S0
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X66 Y-24
+S1000
+G1 X63 Y-25
+G1 X60 Y-24
+G1 X60 Y-20
+G1 X63 Y-19
+G1 X66 Y-20
+S0
+G0 X66 Y-15
+S1000
+G1 X66 Y-25
+S0
+G0 X70 Y-25
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X3 Y-40
+S1000
+G1 X3 Y-34
+G1 X2 Y-34
+S0
+G0 X3 Y-30
+S1000
+G1 X3 Y-30
+S0
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+S1000
+G1 X10 Y-34
+S0
+G0 X10 Y-36
+S1000
+G1 X13 Y-34
+G1 X16 Y-36
+G1 X16 Y-40
+S0
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X26 Y-39
+S1000
+G1 X24 Y-40
+G1 X22 Y-39
+G1 X22 Y-30
+S0
+G0 X20 Y-34
+S1000
+G1 X24 Y-34
+S0
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X33 Y-40
+S1000
+G1 X30 Y-39
+G1 X30 Y-35
+G1 X33 Y-34
+G1 X36 Y-35
+G1 X36 Y-39
+G1 X33 Y-40
+S0
+G0 X40 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X76 Y-39
+S1000
+G1 X74 Y-40
+G1 X72 Y-39
+G1 X72 Y-30
+S0
+G0 X70 Y-34
+S1000
+G1 X74 Y-34
+S0
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+S1000
+G1 X80 Y-30
+S0
+G0 X80 Y-35
+S1000
+G1 X83 Y-34
+G1 X86 Y-35
+G1 X86 Y-40
+S0
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-37
+S1000
+G1 X96 Y-37
+G1 X95 Y-34
+G1 X91 Y-34
+G1 X90 Y-35
+G1 X90 Y-39
+G1 X91 Y-40
+G1 X95 Y-40
+G1 X96 Y-39
+S0
+G0 X100 Y-40
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-54
+S1000
+G1 X3 Y-55
+G1 X6 Y-54
+G1 X6 Y-53
+G1 X0 Y-52
+G1 X0 Y-50
+G1 X3 Y-49
+G1 X6 Y-50
+S0
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X13 Y-55
+S1000
+G1 X13 Y-49
+G1 X12 Y-49
+S0
+G0 X13 Y-45
+S1000
+G1 X13 Y-45
+S0
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X26 Y-54
+S1000
+G1 X23 Y-55
+G1 X20 Y-54
+G1 X20 Y-50
+G1 X23 Y-49
+G1 X26 Y-50
+S0
+G0 X26 Y-45
+S1000
+G1 X26 Y-55
+S0
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-52
+S1000
+G1 X36 Y-52
+G1 X35 Y-49
+G1 X31 Y-49
+G1 X30 Y-50
+G1 X30 Y-54
+G1 X31 Y-55
+G1 X35 Y-55
+G1 X36 Y-54
+S0
+G0 X40 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X80 Y-55
+G0 X83 Y-55
+S1000
+G1 X80 Y-54
+G1 X80 Y-50
+G1 X83 Y-49
+G1 X86 Y-50
+G1 X86 Y-54
+G1 X83 Y-55
+S0
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X90 Y-55
+G0 X92 Y-55
+S1000
+G1 X92 Y-47
+G1 X94 Y-45
+G1 X96 Y-47
+S0
+G0 X90 Y-50
+S1000
+G1 X94 Y-50
+S0
+G0 X100 Y-55
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X6 Y-69
+S1000
+G1 X4 Y-70
+G1 X2 Y-69
+G1 X2 Y-60
+S0
+G0 X0 Y-64
+S1000
+G1 X4 Y-64
+S0
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+S1000
+G1 X10 Y-60
+S0
+G0 X10 Y-65
+S1000
+G1 X13 Y-64
+G1 X16 Y-65
+G1 X16 Y-70
+S0
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-67
+S1000
+G1 X26 Y-67
+G1 X25 Y-64
+G1 X21 Y-64
+G1 X20 Y-65
+G1 X20 Y-69
+G1 X21 Y-70
+G1 X25 Y-70
+G1 X26 Y-69
+S0
+G0 X30 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X56 Y-65
+S1000
+G1 X53 Y-64
+G1 X50 Y-65
+G1 X50 Y-69
+G1 X53 Y-70
+G1 X56 Y-69
+S0
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X61 Y-70
+S1000
+G1 X65 Y-70
+S0
+G0 X63 Y-70
+S1000
+G1 X63 Y-60
+G1 X61 Y-60
+S0
+G0 X70 Y-70
+G0 X70 Y-70
+G0 X70 Y-70
+G0 X70 Y-70
+G0 X70 Y-70
+G0 X70 Y-70
+G0 X70 Y-70
+G0 X73 Y-70
+S1000
+G1 X73 Y-64
+G1 X72 Y-64
+S0
+G0 X73 Y-60
+S1000
+G1 X73 Y-60
+S0
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X80 Y-70
+G0 X82 Y-70
+S1000
+G1 X82 Y-62
+G1 X84 Y-60
+G1 X86 Y-62
+S0
+G0 X80 Y-65
+S1000
+G1 X84 Y-65
+S0
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X90 Y-70
+G0 X92 Y-70
+S1000
+G1 X92 Y-62
+G1 X94 Y-60
+G1 X96 Y-62
+S0
+G0 X90 Y-65
+S1000
+G1 X94 Y-65
+S0
+G0 X100 Y-70
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-79
+S1000
+G1 X1 Y-85
+G1 X3 Y-81
+G1 X5 Y-85
+G1 X6 Y-79
+S0
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+S1000
+G1 X10 Y-75
+S0
+G0 X10 Y-80
+S1000
+G1 X13 Y-79
+G1 X16 Y-80
+G1 X16 Y-85
+S0
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X23 Y-85
+S1000
+G1 X23 Y-79
+G1 X22 Y-79
+S0
+G0 X23 Y-75
+S1000
+G1 X23 Y-75
+S0
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X31 Y-85
+S1000
+G1 X35 Y-85
+S0
+G0 X33 Y-85
+S1000
+G1 X33 Y-75
+G1 X31 Y-75
+S0
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-82
+S1000
+G1 X46 Y-82
+G1 X45 Y-79
+G1 X41 Y-79
+G1 X40 Y-80
+G1 X40 Y-84
+G1 X41 Y-85
+G1 X45 Y-85
+G1 X46 Y-84
+S0
+G0 X50 Y-85
+G0 X70 Y-85
+G0 X70 Y-85
+G0 X70 Y-85
+G0 X70 Y-85
+G0 X70 Y-85
+G0 X70 Y-85
+G0 X70 Y-85
+G0 X76 Y-84
+S1000
+G1 X74 Y-85
+G1 X72 Y-84
+G1 X72 Y-75
+S0
+G0 X70 Y-79
+S1000
+G1 X74 Y-79
+S0
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+G0 X80 Y-85
+S1000
+G1 X80 Y-75
+S0
+G0 X80 Y-80
+S1000
+G1 X83 Y-79
+G1 X86 Y-80
+G1 X86 Y-85
+S0
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-85
+G0 X90 Y-82
+S1000
+G1 X96 Y-82
+G1 X95 Y-79
+G1 X91 Y-79
+G1 X90 Y-80
+G1 X90 Y-84
+G1 X91 Y-85
+G1 X95 Y-85
+G1 X96 Y-84
+S0
+G0 X100 Y-85
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X6 Y-99
+S1000
+G1 X3 Y-100
+G1 X0 Y-99
+G1 X0 Y-95
+G1 X3 Y-94
+G1 X6 Y-95
+S0
+G0 X6 Y-94
+S1000
+G1 X6 Y-102
+G1 X3 Y-103
+G1 X0 Y-102
+S0
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-94
+S1000
+G1 X10 Y-99
+G1 X13 Y-100
+G1 X16 Y-99
+G1 X16 Y-94
+S0
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X21 Y-100
+S1000
+G1 X25 Y-100
+S0
+G0 X23 Y-100
+S1000
+G1 X23 Y-90
+G1 X21 Y-90
+S0
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X31 Y-100
+S1000
+G1 X35 Y-100
+S0
+G0 X33 Y-100
+S1000
+G1 X33 Y-90
+G1 X31 Y-90
+S0
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-99
+S1000
+G1 X43 Y-100
+G1 X46 Y-99
+G1 X46 Y-98
+G1 X40 Y-97
+G1 X40 Y-95
+G1 X43 Y-94
+G1 X46 Y-95
+S0
+G0 X50 Y-100
+G0 X0 Y0
+M0
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-4
+S1000
+G1 X1 Y-10
+G1 X3 Y-6
+G1 X5 Y-10
+G1 X6 Y-4
+S0
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+S1000
+G1 X10 Y0
+S0
+G0 X10 Y-5
+S1000
+G1 X13 Y-4
+G1 X16 Y-5
+G1 X16 Y-10
+S0
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-7
+S1000
+G1 X26 Y-7
+G1 X25 Y-4
+G1 X21 Y-4
+G1 X20 Y-5
+G1 X20 Y-9
+G1 X21 Y-10
+G1 X25 Y-10
+G1 X26 Y-9
+S0
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-7
+S1000
+G1 X36 Y-7
+G1 X35 Y-4
+G1 X31 Y-4
+G1 X30 Y-5
+G1 X30 Y-9
+G1 X31 Y-10
+G1 X35 Y-10
+G1 X36 Y-9
+S0
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X41 Y-10
+S1000
+G1 X45 Y-10
+S0
+G0 X43 Y-10
+S1000
+G1 X43 Y0
+G1 X41 Y0
+S0
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-7
+S1000
+G1 X56 Y-7
+G1 X55 Y-4
+G1 X51 Y-4
+G1 X50 Y-5
+G1 X50 Y-9
+G1 X51 Y-10
+G1 X55 Y-10
+G1 X56 Y-9
+S0
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X66 Y-9
+S1000
+G1 X63 Y-10
+G1 X60 Y-9
+G1 X60 Y-5
+G1 X63 Y-4
+G1 X66 Y-5
+S0
+G0 X66 Y0
+S1000
+G1 X66 Y-10
+S0
+G0 X70 Y-10
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-20
+S1000
+G1 X2 Y-19
+G1 X6 Y-20
+G1 X6 Y-24
+G1 X4 Y-25
+G1 X2 Y-25
+G1 X0 Y-24
+G1 X0 Y-23
+G1 X6 Y-22
+S0
+G0 X6 Y-24
+S1000
+G1 X7 Y-25
+S0
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+S1000
+G1 X10 Y-19
+S0
+G0 X10 Y-21
+S1000
+G1 X13 Y-19
+G1 X16 Y-21
+G1 X16 Y-25
+S0
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X26 Y-24
+S1000
+G1 X23 Y-25
+G1 X20 Y-24
+G1 X20 Y-20
+G1 X23 Y-19
+G1 X26 Y-20
+S0
+G0 X26 Y-15
+S1000
+G1 X26 Y-25
+S0
+G0 X30 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X56 Y-20
+S1000
+G1 X53 Y-19
+G1 X50 Y-20
+G1 X50 Y-24
+G1 X53 Y-25
+G1 X56 Y-24
+S0
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+S1000
+G1 X60 Y-19
+S0
+G0 X60 Y-21
+S1000
+G1 X63 Y-19
+G1 X66 Y-21
+S0
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X73 Y-25
+S1000
+G1 X73 Y-19
+G1 X72 Y-19
+S0
+G0 X73 Y-15
+S1000
+G1 X73 Y-15
+S0
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-22
+S1000
+G1 X86 Y-22
+G1 X85 Y-19
+G1 X81 Y-19
+G1 X80 Y-20
+G1 X80 Y-24
+G1 X81 Y-25
+G1 X85 Y-25
+G1 X86 Y-24
+S0
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X96 Y-24
+S1000
+G1 X93 Y-25
+G1 X90 Y-24
+G1 X90 Y-20
+G1 X93 Y-19
+G1 X96 Y-20
+S0
+G0 X96 Y-15
+S1000
+G1 X96 Y-25
+S0
+G0 X100 Y-25
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X3 Y-40
+S1000
+G1 X0 Y-39
+G1 X0 Y-35
+G1 X3 Y-34
+G1 X6 Y-35
+G1 X6 Y-39
+G1 X3 Y-40
+S0
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-34
+S1000
+G1 X13 Y-40
+G1 X16 Y-34
+S0
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-37
+S1000
+G1 X26 Y-37
+G1 X25 Y-34
+G1 X21 Y-34
+G1 X20 Y-35
+G1 X20 Y-39
+G1 X21 Y-40
+G1 X25 Y-40
+G1 X26 Y-39
+S0
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+S1000
+G1 X30 Y-34
+S0
+G0 X30 Y-36
+S1000
+G1 X33 Y-34
+G1 X36 Y-36
+S0
+G0 X40 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X76 Y-39
+S1000
+G1 X74 Y-40
+G1 X72 Y-39
+G1 X72 Y-30
+S0
+G0 X70 Y-34
+S1000
+G1 X74 Y-34
+S0
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+S1000
+G1 X80 Y-30
+S0
+G0 X80 Y-35
+S1000
+G1 X83 Y-34
+G1 X86 Y-35
+G1 X86 Y-40
+S0
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-37
+S1000
+G1 X96 Y-37
+G1 X95 Y-34
+G1 X91 Y-34
+G1 X90 Y-35
+G1 X90 Y-39
+G1 X91 Y-40
+G1 X95 Y-40
+G1 X96 Y-39
+S0
+G0 X100 Y-40
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X1 Y-55
+S1000
+G1 X5 Y-55
+S0
+G0 X3 Y-55
+S1000
+G1 X3 Y-45
+G1 X1 Y-45
+S0
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X13 Y-55
+S1000
+G1 X13 Y-49
+G1 X12 Y-49
+S0
+G0 X13 Y-45
+S1000
+G1 X13 Y-45
+S0
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X26 Y-54
+S1000
+G1 X24 Y-55
+G1 X22 Y-54
+G1 X22 Y-45
+S0
+G0 X20 Y-49
+S1000
+G1 X24 Y-49
+S0
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X36 Y-54
+S1000
+G1 X34 Y-55
+G1 X32 Y-54
+G1 X32 Y-45
+S0
+G0 X30 Y-49
+S1000
+G1 X34 Y-49
+S0
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X41 Y-55
+S1000
+G1 X45 Y-55
+S0
+G0 X43 Y-55
+S1000
+G1 X43 Y-45
+G1 X41 Y-45
+S0
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-52
+S1000
+G1 X56 Y-52
+G1 X55 Y-49
+G1 X51 Y-49
+G1 X50 Y-50
+G1 X50 Y-54
+G1 X51 Y-55
+G1 X55 Y-55
+G1 X56 Y-54
+S0
+G0 X60 Y-55
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+S1000
+G1 X0 Y-60
+S0
+G0 X0 Y-65
+S1000
+G1 X3 Y-64
+G1 X6 Y-65
+G1 X6 Y-70
+S0
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-65
+S1000
+G1 X12 Y-64
+G1 X16 Y-65
+G1 X16 Y-69
+G1 X14 Y-70
+G1 X12 Y-70
+G1 X10 Y-69
+G1 X10 Y-68
+G1 X16 Y-67
+S0
+G0 X16 Y-69
+S1000
+G1 X17 Y-70
+S0
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+S1000
+G1 X20 Y-64
+S0
+G0 X20 Y-66
+S1000
+G1 X23 Y-64
+G1 X26 Y-66
+S0
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+S1000
+G1 X30 Y-60
+S0
+G0 X30 Y-65
+S1000
+G1 X33 Y-64
+G1 X36 Y-65
+G1 X36 Y-69
+G1 X33 Y-70
+G1 X30 Y-69
+S0
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X43 Y-70
+S1000
+G1 X40 Y-69
+G1 X40 Y-65
+G1 X43 Y-64
+G1 X46 Y-65
+G1 X46 Y-69
+G1 X43 Y-70
+S0
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-64
+S1000
+G1 X50 Y-69
+G1 X53 Y-70
+G1 X56 Y-69
+G1 X56 Y-64
+S0
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+G0 X60 Y-70
+S1000
+G1 X60 Y-64
+S0
+G0 X60 Y-66
+S1000
+G1 X63 Y-64
+G1 X66 Y-66
+S0
+G0 X70 Y-70
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+S1000
+G1 X0 Y-75
+S0
+G0 X0 Y-80
+S1000
+G1 X3 Y-79
+G1 X6 Y-80
+G1 X6 Y-84
+G1 X3 Y-85
+G1 X0 Y-84
+S0
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-82
+S1000
+G1 X16 Y-82
+G1 X15 Y-79
+G1 X11 Y-79
+G1 X10 Y-80
+G1 X10 Y-84
+G1 X11 Y-85
+G1 X15 Y-85
+G1 X16 Y-84
+S0
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X21 Y-85
+S1000
+G1 X25 Y-85
+S0
+G0 X23 Y-85
+S1000
+G1 X23 Y-75
+G1 X21 Y-75
+S0
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X33 Y-85
+S1000
+G1 X30 Y-84
+G1 X30 Y-80
+G1 X33 Y-79
+G1 X36 Y-80
+G1 X36 Y-84
+G1 X33 Y-85
+S0
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-79
+S1000
+G1 X41 Y-85
+G1 X43 Y-81
+G1 X45 Y-85
+G1 X46 Y-79
+S0
+G0 X50 Y-85
+G0 X50 Y-85
+G0 X50 Y-85
+G0 X50 Y-85
+G0 X50 Y-85
+G0 X53 Y-85
+S1000
+G1 X53 Y-85
+G1 X53 Y-85
+S0
+G0 X60 Y-85
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+G0 X0 Y-100
+S1000
+G1 X0 Y-90
+G1 X5 Y-90
+G1 X6 Y-92
+G1 X6 Y-94
+G1 X5 Y-96
+G1 X0 Y-96
+S0
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+G0 X10 Y-100
+S1000
+G1 X10 Y-94
+S0
+G0 X10 Y-96
+S1000
+G1 X13 Y-94
+G1 X16 Y-96
+G1 X16 Y-100
+S0
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-100
+G0 X20 Y-97
+S1000
+G1 X26 Y-97
+G1 X25 Y-94
+G1 X21 Y-94
+G1 X20 Y-95
+G1 X20 Y-99
+G1 X21 Y-100
+G1 X25 Y-100
+G1 X26 Y-99
+S0
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-100
+G0 X30 Y-94
+S1000
+G1 X30 Y-99
+G1 X33 Y-100
+G1 X36 Y-99
+G1 X36 Y-94
+S0
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+G0 X40 Y-100
+S1000
+G1 X40 Y-94
+S0
+G0 X40 Y-95
+S1000
+G1 X42 Y-94
+G1 X43 Y-95
+G1 X43 Y-100
+S0
+G0 X43 Y-95
+S1000
+G1 X45 Y-94
+G1 X46 Y-95
+G1 X46 Y-100
+S0
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X50 Y-100
+G0 X53 Y-100
+S1000
+G1 X50 Y-99
+G1 X50 Y-95
+G1 X53 Y-94
+G1 X56 Y-95
+G1 X56 Y-99
+G1 X53 Y-100
+S0
+G0 X60 Y-100
+G0 X60 Y-100
+G0 X60 Y-100
+G0 X60 Y-100
+G0 X60 Y-95
+S1000
+G1 X66 Y-95
+S0
+G0 X70 Y-100
+G0 X0 Y0
+M0
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+S1000
+G1 X0 Y-4
+S0
+G0 X0 Y-6
+S1000
+G1 X3 Y-4
+G1 X6 Y-6
+G1 X6 Y-10
+S0
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X13 Y-10
+S1000
+G1 X10 Y-9
+G1 X10 Y-5
+G1 X13 Y-4
+G1 X16 Y-5
+G1 X16 Y-9
+G1 X13 Y-10
+S0
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-4
+S1000
+G1 X20 Y-9
+G1 X23 Y-10
+G1 X26 Y-9
+G1 X26 Y-4
+S0
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X31 Y-10
+S1000
+G1 X35 Y-10
+S0
+G0 X33 Y-10
+S1000
+G1 X33 Y0
+G1 X31 Y0
+S0
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X46 Y-9
+S1000
+G1 X44 Y-10
+G1 X42 Y-9
+G1 X42 Y0
+S0
+G0 X40 Y-4
+S1000
+G1 X44 Y-4
+S0
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+S1000
+G1 X50 Y-4
+S0
+G0 X50 Y-6
+S1000
+G1 X53 Y-4
+G1 X56 Y-6
+S0
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-5
+S1000
+G1 X62 Y-4
+G1 X66 Y-5
+G1 X66 Y-9
+G1 X64 Y-10
+G1 X62 Y-10
+G1 X60 Y-9
+G1 X60 Y-8
+G1 X66 Y-7
+S0
+G0 X66 Y-9
+S1000
+G1 X67 Y-10
+S0
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-5
+S1000
+G1 X76 Y-5
+S0
+G0 X80 Y-10
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+S1000
+G1 X0 Y-19
+S0
+G0 X0 Y-20
+S1000
+G1 X2 Y-19
+G1 X3 Y-20
+G1 X3 Y-25
+S0
+G0 X3 Y-20
+S1000
+G1 X5 Y-19
+G1 X6 Y-20
+G1 X6 Y-25
+S0
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X13 Y-25
+S1000
+G1 X13 Y-19
+G1 X12 Y-19
+S0
+G0 X13 Y-15
+S1000
+G1 X13 Y-15
+S0
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X26 Y-20
+S1000
+G1 X23 Y-19
+G1 X20 Y-20
+G1 X20 Y-24
+G1 X23 Y-25
+G1 X26 Y-24
+S0
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+S1000
+G1 X30 Y-19
+S0
+G0 X30 Y-21
+S1000
+G1 X33 Y-19
+G1 X36 Y-21
+S0
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X43 Y-25
+S1000
+G1 X40 Y-24
+G1 X40 Y-20
+G1 X43 Y-19
+G1 X46 Y-20
+G1 X46 Y-24
+G1 X43 Y-25
+S0
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-24
+S1000
+G1 X53 Y-25
+G1 X56 Y-24
+G1 X56 Y-23
+G1 X50 Y-22
+G1 X50 Y-20
+G1 X53 Y-19
+G1 X56 Y-20
+S0
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X66 Y-20
+S1000
+G1 X63 Y-19
+G1 X60 Y-20
+G1 X60 Y-24
+G1 X63 Y-25
+G1 X66 Y-24
+S0
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X73 Y-25
+S1000
+G1 X70 Y-24
+G1 X70 Y-20
+G1 X73 Y-19
+G1 X76 Y-20
+G1 X76 Y-24
+G1 X73 Y-25
+S0
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-20
+S1000
+G1 X86 Y-20
+S0
+G0 X90 Y-25
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-43
+S1000
+G1 X0 Y-34
+S0
+G0 X0 Y-35
+S1000
+G1 X3 Y-34
+G1 X6 Y-35
+G1 X6 Y-39
+G1 X3 Y-40
+G1 X0 Y-39
+S0
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X13 Y-40
+S1000
+G1 X13 Y-34
+G1 X12 Y-34
+S0
+G0 X13 Y-30
+S1000
+G1 X13 Y-30
+S0
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X26 Y-35
+S1000
+G1 X23 Y-34
+G1 X20 Y-35
+G1 X20 Y-39
+G1 X23 Y-40
+G1 X26 Y-39
+S0
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-39
+S1000
+G1 X33 Y-40
+G1 X36 Y-39
+G1 X36 Y-38
+G1 X30 Y-37
+G1 X30 Y-35
+G1 X33 Y-34
+G1 X36 Y-35
+S0
+G0 X40 Y-40
+G0 X40 Y-40
+G0 X40 Y-40
+G0 X40 Y-40
+G0 X40 Y-40
+G0 X40 Y-40
+G0 X40 Y-40
+G0 X43 Y-40
+S1000
+G1 X43 Y-34
+G1 X42 Y-34
+S0
+G0 X43 Y-30
+S1000
+G1 X43 Y-30
+S0
+G0 X50 Y-40
+G0 X50 Y-40
+G0 X50 Y-40
+G0 X50 Y-40
+G0 X50 Y-40
+G0 X50 Y-40
+G0 X50 Y-40
+G0 X51 Y-40
+S1000
+G1 X55 Y-40
+S0
+G0 X53 Y-40
+S1000
+G1 X53 Y-30
+G1 X51 Y-30
+S0
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X63 Y-40
+S1000
+G1 X63 Y-34
+G1 X62 Y-34
+S0
+G0 X63 Y-30
+S1000
+G1 X63 Y-30
+S0
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X76 Y-35
+S1000
+G1 X73 Y-34
+G1 X70 Y-35
+G1 X70 Y-39
+G1 X73 Y-40
+G1 X76 Y-39
+S0
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X83 Y-40
+S1000
+G1 X80 Y-39
+G1 X80 Y-35
+G1 X83 Y-34
+G1 X86 Y-35
+G1 X86 Y-39
+G1 X83 Y-40
+S0
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-35
+S1000
+G1 X96 Y-35
+S0
+G0 X100 Y-40
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-58
+G0 X0 Y-52
+S1000
+G1 X3 Y-58
+G1 X6 Y-52
+S0
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X10 Y-58
+G0 X13 Y-58
+S1000
+G1 X10 Y-57
+G1 X10 Y-53
+G1 X13 Y-52
+G1 X16 Y-53
+G1 X16 Y-57
+G1 X13 Y-58
+S0
+G0 X20 Y-58
+G0 X20 Y-58
+G0 X20 Y-58
+G0 X20 Y-58
+G0 X20 Y-58
+G0 X20 Y-58
+G0 X20 Y-58
+G0 X21 Y-58
+S1000
+G1 X25 Y-58
+S0
+G0 X23 Y-58
+S1000
+G1 X23 Y-48
+G1 X21 Y-48
+S0
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X30 Y-58
+G0 X36 Y-53
+S1000
+G1 X33 Y-52
+G1 X30 Y-53
+G1 X30 Y-57
+G1 X33 Y-58
+G1 X36 Y-57
+S0
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-58
+G0 X40 Y-53
+S1000
+G1 X42 Y-52
+G1 X46 Y-53
+G1 X46 Y-57
+G1 X44 Y-58
+G1 X42 Y-58
+G1 X40 Y-57
+G1 X40 Y-56
+G1 X46 Y-55
+S0
+G0 X46 Y-57
+S1000
+G1 X47 Y-58
+S0
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+G0 X50 Y-58
+S1000
+G1 X50 Y-52
+S0
+G0 X50 Y-54
+S1000
+G1 X53 Y-52
+G1 X56 Y-54
+G1 X56 Y-58
+S0
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X60 Y-58
+G0 X63 Y-58
+S1000
+G1 X60 Y-57
+G1 X60 Y-53
+G1 X63 Y-52
+G1 X66 Y-53
+G1 X66 Y-57
+G1 X63 Y-58
+S0
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X70 Y-58
+G0 X76 Y-53
+S1000
+G1 X73 Y-52
+G1 X70 Y-53
+G1 X70 Y-57
+G1 X73 Y-58
+G1 X76 Y-57
+S0
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X80 Y-58
+G0 X83 Y-58
+S1000
+G1 X80 Y-57
+G1 X80 Y-53
+G1 X83 Y-52
+G1 X86 Y-53
+G1 X86 Y-57
+G1 X83 Y-58
+S0
+G0 X90 Y-58
+G0 X90 Y-58
+G0 X90 Y-58
+G0 X90 Y-58
+G0 X90 Y-53
+S1000
+G1 X96 Y-53
+S0
+G0 X100 Y-58
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+G0 X0 Y-73
+S1000
+G1 X0 Y-67
+S0
+G0 X0 Y-69
+S1000
+G1 X3 Y-67
+G1 X6 Y-69
+G1 X6 Y-73
+S0
+G0 X10 Y-73
+G0 X10 Y-73
+G0 X10 Y-73
+G0 X10 Y-73
+G0 X10 Y-73
+G0 X10 Y-73
+G0 X10 Y-73
+G0 X13 Y-73
+S1000
+G1 X13 Y-67
+G1 X12 Y-67
+S0
+G0 X13 Y-63
+S1000
+G1 X13 Y-63
+S0
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X20 Y-73
+G0 X23 Y-73
+S1000
+G1 X20 Y-72
+G1 X20 Y-68
+G1 X23 Y-67
+G1 X26 Y-68
+G1 X26 Y-72
+G1 X23 Y-73
+S0
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-73
+G0 X30 Y-72
+S1000
+G1 X33 Y-73
+G1 X36 Y-72
+G1 X36 Y-71
+G1 X30 Y-70
+G1 X30 Y-68
+G1 X33 Y-67
+G1 X36 Y-68
+S0
+G0 X40 Y-73
+G0 X40 Y-73
+G0 X40 Y-73
+G0 X40 Y-73
+G0 X40 Y-73
+G0 X40 Y-73
+G0 X40 Y-73
+G0 X43 Y-73
+S1000
+G1 X43 Y-67
+G1 X42 Y-67
+S0
+G0 X43 Y-63
+S1000
+G1 X43 Y-63
+S0
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-73
+G0 X50 Y-72
+S1000
+G1 X53 Y-73
+G1 X56 Y-72
+G1 X56 Y-71
+G1 X50 Y-70
+G1 X50 Y-68
+G1 X53 Y-67
+G1 X56 Y-68
+S0
+G0 X60 Y-73
+G0 X0 Y-88
+G0 X0 Y-88
+G0 X0 Y-88
+G0 X0 Y-88
+G0 X0 Y-88
+G0 X0 Y-88
+G0 X0 Y-88
+G0 X0 Y-88
+S1000
+G1 X3 Y-78
+G1 X6 Y-88
+S0
+G0 X1 Y-83
+S1000
+G1 X5 Y-83
+S0
+G0 X10 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-88
+G0 X50 Y-87
+S1000
+G1 X53 Y-88
+G1 X56 Y-87
+G1 X56 Y-86
+G1 X50 Y-85
+G1 X50 Y-83
+G1 X53 Y-82
+G1 X56 Y-83
+S0
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+G0 X60 Y-88
+S1000
+G1 X60 Y-78
+S0
+G0 X60 Y-83
+S1000
+G1 X63 Y-82
+G1 X66 Y-83
+G1 X66 Y-88
+S0
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X70 Y-88
+G0 X73 Y-88
+S1000
+G1 X70 Y-87
+G1 X70 Y-83
+G1 X73 Y-82
+G1 X76 Y-83
+G1 X76 Y-87
+G1 X73 Y-88
+S0
+G0 X80 Y-88
+G0 X80 Y-88
+G0 X80 Y-88
+G0 X80 Y-88
+G0 X80 Y-88
+G0 X80 Y-88
+G0 X80 Y-88
+G0 X80 Y-88
+S1000
+G1 X80 Y-82
+S0
+G0 X80 Y-84
+S1000
+G1 X83 Y-82
+G1 X86 Y-84
+S0
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X90 Y-88
+G0 X96 Y-87
+S1000
+G1 X94 Y-88
+G1 X92 Y-87
+G1 X92 Y-78
+S0
+G0 X90 Y-82
+S1000
+G1 X94 Y-82
+S0
+G0 X100 Y-88
+G0 X0 Y0
+M0
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X1 Y-10
+S1000
+G1 X5 Y-10
+S0
+G0 X3 Y-10
+S1000
+G1 X3 Y0
+G1 X1 Y0
+S0
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X13 Y-10
+S1000
+G1 X13 Y-4
+G1 X12 Y-4
+S0
+G0 X13 Y0
+S1000
+G1 X13 Y0
+S0
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+S1000
+G1 X20 Y-4
+S0
+G0 X20 Y-6
+S1000
+G1 X23 Y-4
+G1 X26 Y-6
+G1 X26 Y-10
+S0
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-7
+S1000
+G1 X36 Y-7
+G1 X35 Y-4
+G1 X31 Y-4
+G1 X30 Y-5
+G1 X30 Y-9
+G1 X31 Y-10
+G1 X35 Y-10
+G1 X36 Y-9
+S0
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X42 Y-12
+S1000
+G1 X43 Y-10
+G1 X43 Y-10
+S0
+G0 X50 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X66 Y-9
+S1000
+G1 X64 Y-10
+G1 X62 Y-9
+G1 X62 Y0
+S0
+G0 X60 Y-4
+S1000
+G1 X64 Y-4
+S0
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+S1000
+G1 X70 Y0
+S0
+G0 X70 Y-5
+S1000
+G1 X73 Y-4
+G1 X76 Y-5
+G1 X76 Y-10
+S0
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-7
+S1000
+G1 X86 Y-7
+G1 X85 Y-4
+G1 X81 Y-4
+G1 X80 Y-5
+G1 X80 Y-9
+G1 X81 Y-10
+G1 X85 Y-10
+G1 X86 Y-9
+S0
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+G0 X90 Y-10
+S1000
+G1 X90 Y-4
+S0
+G0 X90 Y-6
+S1000
+G1 X93 Y-4
+G1 X96 Y-6
+G1 X96 Y-10
+S0
+G0 X100 Y-10
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-27
+G0 X0 Y-22
+S1000
+G1 X2 Y-21
+G1 X6 Y-22
+G1 X6 Y-26
+G1 X4 Y-27
+G1 X2 Y-27
+G1 X0 Y-26
+G1 X0 Y-25
+G1 X6 Y-24
+S0
+G0 X6 Y-26
+S1000
+G1 X7 Y-27
+S0
+G0 X10 Y-27
+G0 X40 Y-27
+G0 X40 Y-27
+G0 X40 Y-27
+G0 X40 Y-27
+G0 X40 Y-27
+G0 X40 Y-27
+G0 X41 Y-27
+S1000
+G1 X45 Y-27
+S0
+G0 X43 Y-27
+S1000
+G1 X43 Y-17
+G1 X41 Y-17
+S0
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X50 Y-27
+G0 X53 Y-27
+S1000
+G1 X50 Y-26
+G1 X50 Y-22
+G1 X53 Y-21
+G1 X56 Y-22
+G1 X56 Y-26
+G1 X53 Y-27
+S0
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+G0 X60 Y-27
+S1000
+G1 X60 Y-21
+S0
+G0 X60 Y-23
+S1000
+G1 X63 Y-21
+G1 X66 Y-23
+G1 X66 Y-27
+S0
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X70 Y-27
+G0 X76 Y-26
+S1000
+G1 X73 Y-27
+G1 X70 Y-26
+G1 X70 Y-22
+G1 X73 Y-21
+G1 X76 Y-22
+S0
+G0 X76 Y-21
+S1000
+G1 X76 Y-29
+G1 X73 Y-30
+G1 X70 Y-29
+S0
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-27
+G0 X80 Y-24
+S1000
+G1 X86 Y-24
+G1 X85 Y-21
+G1 X81 Y-21
+G1 X80 Y-22
+G1 X80 Y-26
+G1 X81 Y-27
+G1 X85 Y-27
+G1 X86 Y-26
+S0
+G0 X90 Y-27
+G0 X90 Y-27
+G0 X90 Y-27
+G0 X90 Y-27
+G0 X90 Y-27
+G0 X90 Y-27
+G0 X90 Y-27
+G0 X90 Y-27
+S1000
+G1 X90 Y-21
+S0
+G0 X90 Y-23
+S1000
+G1 X93 Y-21
+G1 X96 Y-23
+S0
+G0 X100 Y-27
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X3 Y-45
+S1000
+G1 X0 Y-44
+G1 X0 Y-40
+G1 X3 Y-39
+G1 X6 Y-40
+G1 X6 Y-44
+G1 X3 Y-45
+S0
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+G0 X10 Y-45
+S1000
+G1 X10 Y-39
+S0
+G0 X10 Y-41
+S1000
+G1 X13 Y-39
+G1 X16 Y-41
+G1 X16 Y-45
+S0
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-45
+G0 X20 Y-42
+S1000
+G1 X26 Y-42
+G1 X25 Y-39
+G1 X21 Y-39
+G1 X20 Y-40
+G1 X20 Y-44
+G1 X21 Y-45
+G1 X25 Y-45
+G1 X26 Y-44
+S0
+G0 X30 Y-45
+G0 X80 Y-45
+G0 X80 Y-45
+G0 X80 Y-45
+G0 X80 Y-45
+G0 X80 Y-45
+G0 X80 Y-45
+G0 X80 Y-45
+G0 X86 Y-44
+S1000
+G1 X84 Y-45
+G1 X82 Y-44
+G1 X82 Y-35
+S0
+G0 X80 Y-39
+S1000
+G1 X84 Y-39
+S0
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X90 Y-45
+G0 X93 Y-45
+S1000
+G1 X90 Y-44
+G1 X90 Y-40
+G1 X93 Y-39
+G1 X96 Y-40
+G1 X96 Y-44
+G1 X93 Y-45
+S0
+G0 X100 Y-45
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X0 Y-60
+G0 X6 Y-59
+S1000
+G1 X3 Y-60
+G1 X0 Y-59
+G1 X0 Y-55
+G1 X3 Y-54
+G1 X6 Y-55
+S0
+G0 X6 Y-54
+S1000
+G1 X6 Y-62
+G1 X3 Y-63
+G1 X0 Y-62
+S0
+G0 X10 Y-60
+G0 X10 Y-60
+G0 X10 Y-60
+G0 X10 Y-60
+G0 X10 Y-60
+G0 X10 Y-60
+G0 X10 Y-60
+G0 X13 Y-60
+S1000
+G1 X13 Y-54
+G1 X12 Y-54
+S0
+G0 X13 Y-50
+S1000
+G1 X13 Y-50
+S0
+G0 X20 Y-60
+G0 X20 Y-60
+G0 X20 Y-60
+G0 X20 Y-60
+G0 X20 Y-60
+G0 X20 Y-54
+S1000
+G1 X23 Y-60
+G1 X26 Y-54
+S0
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-60
+G0 X30 Y-57
+S1000
+G1 X36 Y-57
+G1 X35 Y-54
+G1 X31 Y-54
+G1 X30 Y-55
+G1 X30 Y-59
+G1 X31 Y-60
+G1 X35 Y-60
+G1 X36 Y-59
+S0
+G0 X40 Y-60
+G0 X70 Y-60
+G0 X70 Y-60
+G0 X70 Y-60
+G0 X70 Y-60
+G0 X70 Y-60
+G0 X70 Y-60
+G0 X70 Y-60
+G0 X76 Y-59
+S1000
+G1 X74 Y-60
+G1 X72 Y-59
+G1 X72 Y-50
+S0
+G0 X70 Y-54
+S1000
+G1 X74 Y-54
+S0
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+G0 X80 Y-60
+S1000
+G1 X80 Y-50
+S0
+G0 X80 Y-55
+S1000
+G1 X83 Y-54
+G1 X86 Y-55
+G1 X86 Y-60
+S0
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-60
+G0 X90 Y-57
+S1000
+G1 X96 Y-57
+G1 X95 Y-54
+G1 X91 Y-54
+G1 X90 Y-55
+G1 X90 Y-59
+G1 X91 Y-60
+G1 X95 Y-60
+G1 X96 Y-59
+S0
+G0 X100 Y-60
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+G0 X0 Y-78
+S1000
+G1 X0 Y-68
+S0
+G0 X0 Y-73
+S1000
+G1 X3 Y-72
+G1 X6 Y-73
+G1 X6 Y-77
+G1 X3 Y-78
+G1 X0 Y-77
+S0
+G0 X10 Y-78
+G0 X10 Y-78
+G0 X10 Y-78
+G0 X10 Y-78
+G0 X10 Y-78
+G0 X10 Y-78
+G0 X10 Y-78
+G0 X10 Y-78
+S1000
+G1 X10 Y-72
+S0
+G0 X10 Y-74
+S1000
+G1 X13 Y-72
+G1 X16 Y-74
+S0
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-78
+G0 X20 Y-75
+S1000
+G1 X26 Y-75
+G1 X25 Y-72
+G1 X21 Y-72
+G1 X20 Y-73
+G1 X20 Y-77
+G1 X21 Y-78
+G1 X25 Y-78
+G1 X26 Y-77
+S0
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-78
+G0 X30 Y-73
+S1000
+G1 X32 Y-72
+G1 X36 Y-73
+G1 X36 Y-77
+G1 X34 Y-78
+G1 X32 Y-78
+G1 X30 Y-77
+G1 X30 Y-76
+G1 X36 Y-75
+S0
+G0 X36 Y-77
+S1000
+G1 X37 Y-78
+S0
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+G0 X40 Y-78
+S1000
+G1 X40 Y-68
+S0
+G0 X40 Y-76
+S1000
+G1 X46 Y-72
+S0
+G0 X42 Y-75
+S1000
+G1 X46 Y-78
+S0
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-78
+G0 X50 Y-75
+S1000
+G1 X56 Y-75
+G1 X55 Y-72
+G1 X51 Y-72
+G1 X50 Y-73
+G1 X50 Y-77
+G1 X51 Y-78
+G1 X55 Y-78
+G1 X56 Y-77
+S0
+G0 X60 Y-78
+G0 X60 Y-78
+G0 X60 Y-78
+G0 X60 Y-78
+G0 X60 Y-78
+G0 X60 Y-78
+G0 X60 Y-78
+G0 X60 Y-78
+S1000
+G1 X60 Y-72
+S0
+G0 X60 Y-74
+S1000
+G1 X63 Y-72
+G1 X66 Y-74
+S0
+G0 X70 Y-78
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-88
+S1000
+G1 X2 Y-87
+G1 X6 Y-88
+G1 X6 Y-92
+G1 X4 Y-93
+G1 X2 Y-93
+G1 X0 Y-92
+G1 X0 Y-91
+G1 X6 Y-90
+S0
+G0 X6 Y-92
+S1000
+G1 X7 Y-93
+S0
+G0 X10 Y-93
+G0 X60 Y-93
+G0 X60 Y-93
+G0 X60 Y-93
+G0 X60 Y-93
+G0 X60 Y-93
+G0 X60 Y-93
+G0 X60 Y-93
+S1000
+G1 X60 Y-87
+S0
+G0 X60 Y-89
+S1000
+G1 X63 Y-87
+G1 X66 Y-89
+S0
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-93
+G0 X70 Y-90
+S1000
+G1 X76 Y-90
+G1 X75 Y-87
+G1 X71 Y-87
+G1 X70 Y-88
+G1 X70 Y-92
+G1 X71 Y-93
+G1 X75 Y-93
+G1 X76 Y-92
+S0
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-93
+G0 X80 Y-88
+S1000
+G1 X82 Y-87
+G1 X86 Y-88
+G1 X86 Y-92
+G1 X84 Y-93
+G1 X82 Y-93
+G1 X80 Y-92
+G1 X80 Y-91
+G1 X86 Y-90
+S0
+G0 X86 Y-92
+S1000
+G1 X87 Y-93
+S0
+G0 X90 Y-93
+G0 X90 Y-93
+G0 X90 Y-93
+G0 X90 Y-93
+G0 X90 Y-93
+G0 X90 Y-93
+G0 X90 Y-93
+G0 X91 Y-93
+S1000
+G1 X95 Y-93
+S0
+G0 X93 Y-93
+S1000
+G1 X93 Y-83
+G1 X91 Y-83
+S0
+G0 X100 Y-93
+G0 X0 Y0
+M0
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X6 Y-5
+S1000
+G1 X3 Y-4
+G1 X0 Y-5
+G1 X0 Y-9
+G1 X3 Y-10
+G1 X6 Y-9
+S0
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+S1000
+G1 X10 Y0
+S0
+G0 X10 Y-5
+S1000
+G1 X13 Y-4
+G1 X16 Y-5
+G1 X16 Y-10
+S0
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X23 Y-10
+S1000
+G1 X20 Y-9
+G1 X20 Y-5
+G1 X23 Y-4
+G1 X26 Y-5
+G1 X26 Y-9
+G1 X23 Y-10
+S0
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X30 Y-10
+G0 X33 Y-10
+S1000
+G1 X33 Y-4
+G1 X32 Y-4
+S0
+G0 X33 Y0
+S1000
+G1 X33 Y0
+S0
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X46 Y-5
+S1000
+G1 X43 Y-4
+G1 X40 Y-5
+G1 X40 Y-9
+G1 X43 Y-10
+G1 X46 Y-9
+S0
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-7
+S1000
+G1 X56 Y-7
+G1 X55 Y-4
+G1 X51 Y-4
+G1 X50 Y-5
+G1 X50 Y-9
+G1 X51 Y-10
+G1 X55 Y-10
+G1 X56 Y-9
+S0
+G0 X60 Y-10
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X3 Y-25
+S1000
+G1 X0 Y-24
+G1 X0 Y-20
+G1 X3 Y-19
+G1 X6 Y-20
+G1 X6 Y-24
+G1 X3 Y-25
+S0
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X12 Y-25
+S1000
+G1 X12 Y-17
+G1 X14 Y-15
+G1 X16 Y-17
+S0
+G0 X10 Y-20
+S1000
+G1 X14 Y-20
+S0
+G0 X20 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-19
+S1000
+G1 X51 Y-25
+G1 X53 Y-21
+G1 X55 Y-25
+G1 X56 Y-19
+S0
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+S1000
+G1 X60 Y-15
+S0
+G0 X60 Y-20
+S1000
+G1 X63 Y-19
+G1 X66 Y-20
+G1 X66 Y-25
+S0
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-25
+G0 X70 Y-22
+S1000
+G1 X76 Y-22
+G1 X75 Y-19
+G1 X71 Y-19
+G1 X70 Y-20
+G1 X70 Y-24
+G1 X71 Y-25
+G1 X75 Y-25
+G1 X76 Y-24
+S0
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+G0 X80 Y-25
+S1000
+G1 X80 Y-19
+S0
+G0 X80 Y-21
+S1000
+G1 X83 Y-19
+G1 X86 Y-21
+S0
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-25
+G0 X90 Y-22
+S1000
+G1 X96 Y-22
+G1 X95 Y-19
+G1 X91 Y-19
+G1 X90 Y-20
+G1 X90 Y-24
+G1 X91 Y-25
+G1 X95 Y-25
+G1 X96 Y-24
+S0
+G0 X100 Y-25
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-37
+S1000
+G1 X6 Y-37
+G1 X5 Y-34
+G1 X1 Y-34
+G1 X0 Y-35
+G1 X0 Y-39
+G1 X1 Y-40
+G1 X5 Y-40
+G1 X6 Y-39
+S0
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-35
+S1000
+G1 X12 Y-34
+G1 X16 Y-35
+G1 X16 Y-39
+G1 X14 Y-40
+G1 X12 Y-40
+G1 X10 Y-39
+G1 X10 Y-38
+G1 X16 Y-37
+S0
+G0 X16 Y-39
+S1000
+G1 X17 Y-40
+S0
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X26 Y-35
+S1000
+G1 X23 Y-34
+G1 X20 Y-35
+G1 X20 Y-39
+G1 X23 Y-40
+G1 X26 Y-39
+S0
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+S1000
+G1 X30 Y-30
+S0
+G0 X30 Y-35
+S1000
+G1 X33 Y-34
+G1 X36 Y-35
+G1 X36 Y-40
+S0
+G0 X40 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X60 Y-40
+G0 X61 Y-40
+S1000
+G1 X65 Y-40
+S0
+G0 X63 Y-40
+S1000
+G1 X63 Y-30
+G1 X61 Y-30
+S0
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X70 Y-40
+G0 X73 Y-40
+S1000
+G1 X73 Y-34
+G1 X72 Y-34
+S0
+G0 X73 Y-30
+S1000
+G1 X73 Y-30
+S0
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+G0 X80 Y-40
+S1000
+G1 X80 Y-34
+S0
+G0 X80 Y-36
+S1000
+G1 X83 Y-34
+G1 X86 Y-36
+G1 X86 Y-40
+S0
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-40
+G0 X90 Y-37
+S1000
+G1 X96 Y-37
+G1 X95 Y-34
+G1 X91 Y-34
+G1 X90 Y-35
+G1 X90 Y-39
+G1 X91 Y-40
+G1 X95 Y-40
+G1 X96 Y-39
+S0
+G0 X100 Y-40
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-54
+S1000
+G1 X3 Y-55
+G1 X6 Y-54
+G1 X6 Y-53
+G1 X0 Y-52
+G1 X0 Y-50
+G1 X3 Y-49
+G1 X6 Y-50
+S0
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+S1000
+G1 X10 Y-45
+S0
+G0 X10 Y-50
+S1000
+G1 X13 Y-49
+G1 X16 Y-50
+G1 X16 Y-55
+S0
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X23 Y-55
+S1000
+G1 X20 Y-54
+G1 X20 Y-50
+G1 X23 Y-49
+G1 X26 Y-50
+G1 X26 Y-54
+G1 X23 Y-55
+S0
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-55
+G0 X30 Y-49
+S1000
+G1 X30 Y-54
+G1 X33 Y-55
+G1 X36 Y-54
+G1 X36 Y-49
+S0
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X41 Y-55
+S1000
+G1 X45 Y-55
+S0
+G0 X43 Y-55
+S1000
+G1 X43 Y-45
+G1 X41 Y-45
+S0
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X56 Y-54
+S1000
+G1 X53 Y-55
+G1 X50 Y-54
+G1 X50 Y-50
+G1 X53 Y-49
+G1 X56 Y-50
+S0
+G0 X56 Y-45
+S1000
+G1 X56 Y-55
+S0
+G0 X60 Y-55
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-67
+S1000
+G1 X6 Y-67
+G1 X5 Y-64
+G1 X1 Y-64
+G1 X0 Y-65
+G1 X0 Y-69
+G1 X1 Y-70
+G1 X5 Y-70
+G1 X6 Y-69
+S0
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+S1000
+G1 X10 Y-64
+S0
+G0 X10 Y-66
+S1000
+G1 X13 Y-64
+G1 X16 Y-66
+G1 X16 Y-70
+S0
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X20 Y-70
+G0 X26 Y-69
+S1000
+G1 X23 Y-70
+G1 X20 Y-69
+G1 X20 Y-65
+G1 X23 Y-64
+G1 X26 Y-65
+S0
+G0 X26 Y-60
+S1000
+G1 X26 Y-70
+S0
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X33 Y-70
+S1000
+G1 X33 Y-70
+G1 X33 Y-70
+S0
+G0 X40 Y-70
+G0 X0 Y-85
+G0 X0 Y0
@@ -0,0 +1,3998 @@
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X2 Y-7
+S1000
+G1 X2 Y0
+S0
+G0 X0 Y0
+S1000
+G1 X5 Y0
+S0
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+S1000
+G1 X7 Y0
+S0
+G0 X7 Y-4
+S1000
+G1 X9 Y-3
+G1 X12 Y-4
+G1 X12 Y-7
+S0
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-5
+S1000
+G1 X19 Y-5
+G1 X17 Y-2
+G1 X15 Y-2
+G1 X14 Y-4
+G1 X14 Y-7
+G1 X15 Y-7
+G1 X17 Y-7
+G1 X19 Y-7
+S0
+G0 X21 Y-7
+G0 X65 Y-7
+G0 X65 Y-7
+G0 X65 Y-7
+G0 X65 Y-7
+G0 X65 Y-7
+G0 X65 Y-7
+G0 X65 Y-3
+S1000
+G1 X66 Y-7
+G1 X67 Y-4
+G1 X68 Y-7
+G1 X70 Y-3
+S0
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-7
+G0 X72 Y-3
+S1000
+G1 X74 Y-2
+G1 X76 Y-3
+G1 X76 Y-7
+G1 X75 Y-7
+G1 X73 Y-7
+G1 X72 Y-7
+G1 X72 Y-5
+G1 X76 Y-5
+S0
+G0 X76 Y-7
+S1000
+G1 X77 Y-7
+S0
+G0 X79 Y-7
+G0 X79 Y-7
+G0 X79 Y-7
+G0 X79 Y-7
+G0 X79 Y-7
+G0 X79 Y-3
+S1000
+G1 X81 Y-7
+G1 X84 Y-3
+S0
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-7
+G0 X86 Y-5
+S1000
+G1 X91 Y-5
+G1 X89 Y-2
+G1 X87 Y-2
+G1 X86 Y-4
+G1 X86 Y-7
+G1 X87 Y-7
+G1 X89 Y-7
+G1 X91 Y-7
+S0
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+S1000
+G1 X95 Y-7
+G1 X98 Y-7
+G1 X98 Y-5
+G1 X93 Y-5
+G1 X93 Y-3
+G1 X95 Y-2
+G1 X98 Y-3
+S0
+G0 X100 Y-7
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X4 Y-16
+S1000
+G1 X2 Y-15
+G1 X0 Y-16
+G1 X0 Y-19
+G1 X2 Y-19
+G1 X4 Y-19
+S0
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+S1000
+G1 X7 Y-15
+S0
+G0 X7 Y-16
+S1000
+G1 X9 Y-15
+G1 X12 Y-16
+S0
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-15
+S1000
+G1 X16 Y-14
+G1 X18 Y-15
+G1 X18 Y-19
+G1 X17 Y-19
+G1 X15 Y-19
+G1 X14 Y-19
+G1 X14 Y-17
+G1 X18 Y-17
+S0
+G0 X18 Y-19
+S1000
+G1 X19 Y-19
+S0
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+S1000
+G1 X23 Y-19
+G1 X26 Y-19
+G1 X26 Y-17
+G1 X21 Y-17
+G1 X21 Y-15
+G1 X23 Y-14
+G1 X26 Y-15
+S0
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+S1000
+G1 X28 Y-12
+S0
+G0 X28 Y-16
+S1000
+G1 X30 Y-15
+G1 X33 Y-16
+G1 X33 Y-19
+S0
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-17
+S1000
+G1 X40 Y-17
+G1 X38 Y-14
+G1 X36 Y-14
+G1 X35 Y-16
+G1 X35 Y-19
+G1 X36 Y-19
+G1 X38 Y-19
+G1 X40 Y-19
+S0
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X47 Y-19
+S1000
+G1 X44 Y-19
+G1 X42 Y-19
+G1 X42 Y-16
+G1 X44 Y-15
+G1 X47 Y-16
+S0
+G0 X47 Y-12
+S1000
+G1 X47 Y-19
+S0
+G0 X49 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X74 Y-19
+S1000
+G1 X74 Y-15
+G1 X73 Y-15
+S0
+G0 X74 Y-12
+S1000
+G1 X74 Y-12
+S0
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+S1000
+G1 X79 Y-15
+S0
+G0 X79 Y-16
+S1000
+G1 X81 Y-15
+G1 X84 Y-16
+G1 X84 Y-19
+S0
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X91 Y-19
+S1000
+G1 X89 Y-19
+G1 X87 Y-19
+G1 X87 Y-12
+S0
+G0 X86 Y-15
+S1000
+G1 X89 Y-15
+S0
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X95 Y-19
+S1000
+G1 X93 Y-19
+G1 X93 Y-16
+G1 X95 Y-15
+G1 X98 Y-16
+G1 X98 Y-19
+G1 X95 Y-19
+S0
+G0 X100 Y-19
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X5 Y-31
+S1000
+G1 X3 Y-31
+G1 X1 Y-31
+G1 X1 Y-24
+S0
+G0 X0 Y-27
+S1000
+G1 X3 Y-27
+S0
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+S1000
+G1 X7 Y-24
+S0
+G0 X7 Y-28
+S1000
+G1 X9 Y-27
+G1 X12 Y-28
+G1 X12 Y-31
+S0
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-29
+S1000
+G1 X19 Y-29
+G1 X17 Y-26
+G1 X15 Y-26
+G1 X14 Y-28
+G1 X14 Y-31
+G1 X15 Y-31
+G1 X17 Y-31
+G1 X19 Y-31
+S0
+G0 X21 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+S1000
+G1 X42 Y-31
+G1 X45 Y-31
+G1 X45 Y-29
+G1 X40 Y-29
+G1 X40 Y-27
+G1 X42 Y-26
+G1 X45 Y-27
+S0
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X49 Y-31
+S1000
+G1 X49 Y-27
+G1 X48 Y-27
+S0
+G0 X49 Y-24
+S1000
+G1 X49 Y-24
+S0
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X59 Y-31
+S1000
+G1 X56 Y-31
+G1 X54 Y-31
+G1 X54 Y-28
+G1 X56 Y-27
+G1 X59 Y-28
+S0
+G0 X59 Y-24
+S1000
+G1 X59 Y-31
+S0
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-31
+G0 X61 Y-29
+S1000
+G1 X66 Y-29
+G1 X64 Y-26
+G1 X62 Y-26
+G1 X61 Y-28
+G1 X61 Y-31
+G1 X62 Y-31
+G1 X64 Y-31
+G1 X66 Y-31
+S0
+G0 X68 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X88 Y-31
+S1000
+G1 X86 Y-31
+G1 X86 Y-28
+G1 X88 Y-27
+G1 X91 Y-28
+G1 X91 Y-31
+G1 X88 Y-31
+S0
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X94 Y-31
+S1000
+G1 X94 Y-25
+G1 X96 Y-24
+G1 X98 Y-25
+S0
+G0 X93 Y-28
+S1000
+G1 X96 Y-28
+S0
+G0 X100 Y-31
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X5 Y-43
+S1000
+G1 X3 Y-43
+G1 X1 Y-43
+G1 X1 Y-36
+S0
+G0 X0 Y-39
+S1000
+G1 X3 Y-39
+S0
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+S1000
+G1 X7 Y-36
+S0
+G0 X7 Y-40
+S1000
+G1 X9 Y-39
+G1 X12 Y-40
+G1 X12 Y-43
+S0
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-41
+S1000
+G1 X19 Y-41
+G1 X17 Y-38
+G1 X15 Y-38
+G1 X14 Y-40
+G1 X14 Y-43
+G1 X15 Y-43
+G1 X17 Y-43
+G1 X19 Y-43
+S0
+G0 X21 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X69 Y-40
+S1000
+G1 X67 Y-39
+G1 X65 Y-40
+G1 X65 Y-43
+G1 X67 Y-43
+G1 X69 Y-43
+S0
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X73 Y-43
+S1000
+G1 X75 Y-43
+S0
+G0 X74 Y-43
+S1000
+G1 X74 Y-36
+G1 X73 Y-36
+S0
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X81 Y-43
+S1000
+G1 X81 Y-39
+G1 X80 Y-39
+S0
+G0 X81 Y-36
+S1000
+G1 X81 Y-36
+S0
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X87 Y-43
+S1000
+G1 X87 Y-37
+G1 X89 Y-36
+G1 X91 Y-37
+S0
+G0 X86 Y-40
+S1000
+G1 X89 Y-40
+S0
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X94 Y-43
+S1000
+G1 X94 Y-37
+G1 X96 Y-36
+G1 X98 Y-37
+S0
+G0 X93 Y-40
+S1000
+G1 X96 Y-40
+S0
+G0 X100 Y-43
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-51
+S1000
+G1 X1 Y-55
+G1 X2 Y-52
+G1 X3 Y-55
+G1 X5 Y-51
+S0
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+S1000
+G1 X7 Y-48
+S0
+G0 X7 Y-52
+S1000
+G1 X9 Y-51
+G1 X12 Y-52
+G1 X12 Y-55
+S0
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X16 Y-55
+S1000
+G1 X16 Y-51
+G1 X15 Y-51
+S0
+G0 X16 Y-48
+S1000
+G1 X16 Y-48
+S0
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X22 Y-55
+S1000
+G1 X24 Y-55
+S0
+G0 X23 Y-55
+S1000
+G1 X23 Y-48
+G1 X22 Y-48
+S0
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-55
+G0 X28 Y-53
+S1000
+G1 X33 Y-53
+G1 X31 Y-50
+G1 X29 Y-50
+G1 X28 Y-52
+G1 X28 Y-55
+G1 X29 Y-55
+G1 X31 Y-55
+G1 X33 Y-55
+S0
+G0 X35 Y-55
+G0 X79 Y-55
+G0 X79 Y-55
+G0 X79 Y-55
+G0 X79 Y-55
+G0 X79 Y-55
+G0 X79 Y-55
+G0 X79 Y-55
+G0 X84 Y-55
+S1000
+G1 X82 Y-55
+G1 X80 Y-55
+G1 X80 Y-48
+S0
+G0 X79 Y-51
+S1000
+G1 X82 Y-51
+S0
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+G0 X86 Y-55
+S1000
+G1 X86 Y-48
+S0
+G0 X86 Y-52
+S1000
+G1 X88 Y-51
+G1 X91 Y-52
+G1 X91 Y-55
+S0
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-55
+G0 X93 Y-53
+S1000
+G1 X98 Y-53
+G1 X96 Y-50
+G1 X94 Y-50
+G1 X93 Y-52
+G1 X93 Y-55
+G1 X94 Y-55
+G1 X96 Y-55
+G1 X98 Y-55
+S0
+G0 X100 Y-55
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X0 Y-67
+G0 X4 Y-67
+S1000
+G1 X2 Y-67
+G1 X0 Y-67
+G1 X0 Y-64
+G1 X2 Y-63
+G1 X4 Y-64
+S0
+G0 X4 Y-63
+S1000
+G1 X4 Y-69
+G1 X2 Y-69
+G1 X0 Y-69
+S0
+G0 X7 Y-67
+G0 X7 Y-67
+G0 X7 Y-67
+G0 X7 Y-67
+G0 X7 Y-67
+G0 X7 Y-67
+G0 X7 Y-67
+G0 X7 Y-63
+S1000
+G1 X7 Y-67
+G1 X9 Y-67
+G1 X12 Y-67
+G1 X12 Y-63
+S0
+G0 X14 Y-67
+G0 X14 Y-67
+G0 X14 Y-67
+G0 X14 Y-67
+G0 X14 Y-67
+G0 X14 Y-67
+G0 X14 Y-67
+G0 X15 Y-67
+S1000
+G1 X17 Y-67
+S0
+G0 X16 Y-67
+S1000
+G1 X16 Y-60
+G1 X15 Y-60
+S0
+G0 X21 Y-67
+G0 X21 Y-67
+G0 X21 Y-67
+G0 X21 Y-67
+G0 X21 Y-67
+G0 X21 Y-67
+G0 X21 Y-67
+G0 X22 Y-67
+S1000
+G1 X24 Y-67
+S0
+G0 X23 Y-67
+S1000
+G1 X23 Y-60
+G1 X22 Y-60
+S0
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+G0 X28 Y-67
+S1000
+G1 X30 Y-67
+G1 X33 Y-67
+G1 X33 Y-65
+G1 X28 Y-65
+G1 X28 Y-63
+G1 X30 Y-62
+G1 X33 Y-63
+S0
+G0 X35 Y-67
+G0 X51 Y-67
+G0 X51 Y-67
+G0 X51 Y-67
+G0 X51 Y-67
+G0 X51 Y-67
+G0 X51 Y-67
+G0 X51 Y-63
+S1000
+G1 X52 Y-67
+G1 X53 Y-64
+G1 X54 Y-67
+G1 X56 Y-63
+S0
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+G0 X58 Y-67
+S1000
+G1 X58 Y-60
+S0
+G0 X58 Y-64
+S1000
+G1 X60 Y-63
+G1 X63 Y-64
+G1 X63 Y-67
+S0
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-67
+G0 X65 Y-65
+S1000
+G1 X70 Y-65
+G1 X68 Y-62
+G1 X66 Y-62
+G1 X65 Y-64
+G1 X65 Y-67
+G1 X66 Y-67
+G1 X68 Y-67
+G1 X70 Y-67
+S0
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-67
+G0 X72 Y-65
+S1000
+G1 X77 Y-65
+G1 X75 Y-62
+G1 X73 Y-62
+G1 X72 Y-64
+G1 X72 Y-67
+G1 X73 Y-67
+G1 X75 Y-67
+G1 X77 Y-67
+S0
+G0 X79 Y-67
+G0 X79 Y-67
+G0 X79 Y-67
+G0 X79 Y-67
+G0 X79 Y-67
+G0 X79 Y-67
+G0 X79 Y-67
+G0 X80 Y-67
+S1000
+G1 X82 Y-67
+S0
+G0 X81 Y-67
+S1000
+G1 X81 Y-60
+G1 X80 Y-60
+S0
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-67
+G0 X86 Y-65
+S1000
+G1 X91 Y-65
+G1 X89 Y-62
+G1 X87 Y-62
+G1 X86 Y-64
+G1 X86 Y-67
+G1 X87 Y-67
+G1 X89 Y-67
+G1 X91 Y-67
+S0
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X93 Y-67
+G0 X98 Y-67
+S1000
+G1 X95 Y-67
+G1 X93 Y-67
+G1 X93 Y-64
+G1 X95 Y-63
+G1 X98 Y-64
+S0
+G0 X98 Y-60
+S1000
+G1 X98 Y-67
+S0
+G0 X100 Y-67
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-81
+G0 X0 Y-77
+S1000
+G1 X2 Y-76
+G1 X4 Y-77
+G1 X4 Y-81
+G1 X3 Y-81
+G1 X1 Y-81
+G1 X0 Y-81
+G1 X0 Y-79
+G1 X4 Y-79
+S0
+G0 X4 Y-81
+S1000
+G1 X5 Y-81
+S0
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+G0 X7 Y-81
+S1000
+G1 X7 Y-77
+S0
+G0 X7 Y-78
+S1000
+G1 X9 Y-77
+G1 X12 Y-78
+G1 X12 Y-81
+S0
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X14 Y-81
+G0 X19 Y-81
+S1000
+G1 X16 Y-81
+G1 X14 Y-81
+G1 X14 Y-78
+G1 X16 Y-77
+G1 X19 Y-78
+S0
+G0 X19 Y-74
+S1000
+G1 X19 Y-81
+S0
+G0 X21 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X29 Y-81
+G0 X33 Y-78
+S1000
+G1 X31 Y-77
+G1 X29 Y-78
+G1 X29 Y-81
+G1 X31 Y-81
+G1 X33 Y-81
+S0
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+G0 X36 Y-81
+S1000
+G1 X36 Y-77
+S0
+G0 X36 Y-78
+S1000
+G1 X38 Y-77
+G1 X41 Y-78
+S0
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X43 Y-81
+G0 X45 Y-81
+S1000
+G1 X45 Y-77
+G1 X44 Y-77
+S0
+G0 X45 Y-74
+S1000
+G1 X45 Y-74
+S0
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-81
+G0 X50 Y-79
+S1000
+G1 X55 Y-79
+G1 X53 Y-76
+G1 X51 Y-76
+G1 X50 Y-78
+G1 X50 Y-81
+G1 X51 Y-81
+G1 X53 Y-81
+G1 X55 Y-81
+S0
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X57 Y-81
+G0 X62 Y-81
+S1000
+G1 X59 Y-81
+G1 X57 Y-81
+G1 X57 Y-78
+G1 X59 Y-77
+G1 X62 Y-78
+S0
+G0 X62 Y-74
+S1000
+G1 X62 Y-81
+S0
+G0 X64 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X72 Y-81
+G0 X74 Y-81
+S1000
+G1 X72 Y-81
+G1 X72 Y-78
+G1 X74 Y-77
+G1 X77 Y-78
+G1 X77 Y-81
+G1 X74 Y-81
+S0
+G0 X79 Y-81
+G0 X79 Y-81
+G0 X79 Y-81
+G0 X79 Y-81
+G0 X79 Y-81
+G0 X79 Y-77
+S1000
+G1 X81 Y-81
+G1 X84 Y-77
+S0
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-81
+G0 X86 Y-79
+S1000
+G1 X91 Y-79
+G1 X89 Y-76
+G1 X87 Y-76
+G1 X86 Y-78
+G1 X86 Y-81
+G1 X87 Y-81
+G1 X89 Y-81
+G1 X91 Y-81
+S0
+G0 X93 Y-81
+G0 X93 Y-81
+G0 X93 Y-81
+G0 X93 Y-81
+G0 X93 Y-81
+G0 X93 Y-81
+G0 X93 Y-81
+G0 X93 Y-81
+S1000
+G1 X93 Y-77
+S0
+G0 X93 Y-78
+S1000
+G1 X95 Y-77
+G1 X98 Y-78
+S0
+G0 X100 Y-81
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X0 Y-93
+G0 X5 Y-93
+S1000
+G1 X3 Y-93
+G1 X1 Y-93
+G1 X1 Y-86
+S0
+G0 X0 Y-89
+S1000
+G1 X3 Y-89
+S0
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+G0 X7 Y-93
+S1000
+G1 X7 Y-86
+S0
+G0 X7 Y-90
+S1000
+G1 X9 Y-89
+G1 X12 Y-90
+G1 X12 Y-93
+S0
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-93
+G0 X14 Y-91
+S1000
+G1 X19 Y-91
+G1 X17 Y-88
+G1 X15 Y-88
+G1 X14 Y-90
+G1 X14 Y-93
+G1 X15 Y-93
+G1 X17 Y-93
+G1 X19 Y-93
+S0
+G0 X21 Y-93
+G0 X58 Y-93
+G0 X58 Y-93
+G0 X58 Y-93
+G0 X58 Y-93
+G0 X58 Y-93
+G0 X58 Y-93
+G0 X59 Y-93
+S1000
+G1 X61 Y-93
+S0
+G0 X60 Y-93
+S1000
+G1 X60 Y-86
+G1 X59 Y-86
+S0
+G0 X65 Y-93
+G0 X65 Y-93
+G0 X65 Y-93
+G0 X65 Y-93
+G0 X65 Y-93
+G0 X65 Y-93
+G0 X65 Y-93
+G0 X67 Y-93
+S1000
+G1 X67 Y-89
+G1 X66 Y-89
+S0
+G0 X67 Y-86
+S1000
+G1 X67 Y-86
+S0
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X72 Y-93
+G0 X77 Y-93
+S1000
+G1 X75 Y-93
+G1 X73 Y-93
+G1 X73 Y-86
+S0
+G0 X72 Y-89
+S1000
+G1 X75 Y-89
+S0
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X79 Y-93
+G0 X84 Y-93
+S1000
+G1 X82 Y-93
+G1 X80 Y-93
+G1 X80 Y-86
+S0
+G0 X79 Y-89
+S1000
+G1 X82 Y-89
+S0
+G0 X86 Y-93
+G0 X86 Y-93
+G0 X86 Y-93
+G0 X86 Y-93
+G0 X86 Y-93
+G0 X86 Y-93
+G0 X86 Y-93
+G0 X87 Y-93
+S1000
+G1 X89 Y-93
+S0
+G0 X88 Y-93
+S1000
+G1 X88 Y-86
+G1 X87 Y-86
+S0
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-93
+G0 X93 Y-91
+S1000
+G1 X98 Y-91
+G1 X96 Y-88
+G1 X94 Y-88
+G1 X93 Y-90
+G1 X93 Y-93
+G1 X94 Y-93
+G1 X96 Y-93
+G1 X98 Y-93
+S0
+G0 X100 Y-93
+G0 X0 Y0
+M0
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+S1000
+G1 X0 Y0
+S0
+G0 X0 Y-4
+S1000
+G1 X2 Y-3
+G1 X5 Y-4
+G1 X5 Y-7
+S0
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-3
+S1000
+G1 X9 Y-2
+G1 X11 Y-3
+G1 X11 Y-7
+G1 X10 Y-7
+G1 X8 Y-7
+G1 X7 Y-7
+G1 X7 Y-5
+G1 X11 Y-5
+S0
+G0 X11 Y-7
+S1000
+G1 X12 Y-7
+S0
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+S1000
+G1 X14 Y-3
+S0
+G0 X14 Y-4
+S1000
+G1 X16 Y-3
+G1 X19 Y-4
+S0
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+G0 X21 Y-7
+S1000
+G1 X21 Y0
+S0
+G0 X21 Y-4
+S1000
+G1 X23 Y-3
+G1 X26 Y-4
+G1 X26 Y-7
+G1 X23 Y-7
+G1 X21 Y-7
+S0
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X30 Y-7
+S1000
+G1 X28 Y-7
+G1 X28 Y-4
+G1 X30 Y-3
+G1 X33 Y-4
+G1 X33 Y-7
+G1 X30 Y-7
+S0
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-3
+S1000
+G1 X35 Y-7
+G1 X37 Y-7
+G1 X40 Y-7
+G1 X40 Y-3
+S0
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+S1000
+G1 X42 Y-3
+S0
+G0 X42 Y-4
+S1000
+G1 X44 Y-3
+G1 X47 Y-4
+S0
+G0 X49 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+S1000
+G1 X56 Y0
+S0
+G0 X56 Y-4
+S1000
+G1 X58 Y-3
+G1 X61 Y-4
+G1 X61 Y-7
+G1 X58 Y-7
+G1 X56 Y-7
+S0
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-7
+G0 X63 Y-5
+S1000
+G1 X68 Y-5
+G1 X66 Y-2
+G1 X64 Y-2
+G1 X63 Y-4
+G1 X63 Y-7
+G1 X64 Y-7
+G1 X66 Y-7
+G1 X68 Y-7
+S0
+G0 X70 Y-7
+G0 X70 Y-7
+G0 X70 Y-7
+G0 X70 Y-7
+G0 X70 Y-7
+G0 X70 Y-7
+G0 X70 Y-7
+G0 X71 Y-7
+S1000
+G1 X73 Y-7
+S0
+G0 X72 Y-7
+S1000
+G1 X72 Y0
+G1 X71 Y0
+S0
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X77 Y-7
+G0 X79 Y-7
+S1000
+G1 X77 Y-7
+G1 X77 Y-4
+G1 X79 Y-3
+G1 X82 Y-4
+G1 X82 Y-7
+G1 X79 Y-7
+S0
+G0 X84 Y-7
+G0 X84 Y-7
+G0 X84 Y-7
+G0 X84 Y-7
+G0 X84 Y-7
+G0 X84 Y-7
+G0 X84 Y-7
+G0 X84 Y-3
+S1000
+G1 X85 Y-7
+G1 X86 Y-4
+G1 X87 Y-7
+G1 X89 Y-3
+S0
+G0 X91 Y-7
+G0 X91 Y-7
+G0 X91 Y-7
+G0 X91 Y-7
+G0 X91 Y-7
+G0 X93 Y-7
+S1000
+G1 X93 Y-7
+G1 X93 Y-7
+S0
+G0 X98 Y-7
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+S1000
+G1 X0 Y-12
+G1 X3 Y-12
+G1 X5 Y-13
+G1 X5 Y-15
+G1 X3 Y-16
+G1 X0 Y-16
+S0
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+S1000
+G1 X7 Y-15
+S0
+G0 X7 Y-16
+S1000
+G1 X9 Y-15
+G1 X12 Y-16
+G1 X12 Y-19
+S0
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-17
+S1000
+G1 X19 Y-17
+G1 X17 Y-14
+G1 X15 Y-14
+G1 X14 Y-16
+G1 X14 Y-19
+G1 X15 Y-19
+G1 X17 Y-19
+G1 X19 Y-19
+S0
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-15
+S1000
+G1 X21 Y-19
+G1 X23 Y-19
+G1 X26 Y-19
+G1 X26 Y-15
+S0
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+S1000
+G1 X28 Y-14
+S0
+G0 X28 Y-16
+S1000
+G1 X29 Y-14
+G1 X30 Y-16
+G1 X30 Y-19
+S0
+G0 X30 Y-16
+S1000
+G1 X32 Y-14
+G1 X33 Y-16
+G1 X33 Y-19
+S0
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X37 Y-19
+S1000
+G1 X35 Y-19
+G1 X35 Y-16
+G1 X37 Y-15
+G1 X40 Y-16
+G1 X40 Y-19
+G1 X37 Y-19
+S0
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+S1000
+G1 X42 Y-15
+S0
+G0 X42 Y-16
+S1000
+G1 X44 Y-15
+G1 X47 Y-16
+G1 X47 Y-19
+S0
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X49 Y-19
+G0 X51 Y-19
+S1000
+G1 X49 Y-19
+G1 X49 Y-16
+G1 X51 Y-15
+G1 X54 Y-16
+G1 X54 Y-19
+G1 X51 Y-19
+S0
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-15
+S1000
+G1 X56 Y-19
+G1 X58 Y-19
+G1 X61 Y-19
+G1 X61 Y-15
+S0
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X64 Y-19
+S1000
+G1 X66 Y-19
+S0
+G0 X65 Y-19
+S1000
+G1 X65 Y-12
+G1 X64 Y-12
+S0
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X75 Y-19
+S1000
+G1 X73 Y-19
+G1 X71 Y-19
+G1 X71 Y-12
+S0
+G0 X70 Y-15
+S1000
+G1 X73 Y-15
+S0
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+S1000
+G1 X77 Y-15
+S0
+G0 X77 Y-16
+S1000
+G1 X79 Y-15
+G1 X82 Y-16
+S0
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-19
+G0 X84 Y-15
+S1000
+G1 X86 Y-14
+G1 X88 Y-15
+G1 X88 Y-19
+G1 X87 Y-19
+G1 X85 Y-19
+G1 X84 Y-19
+G1 X84 Y-17
+G1 X88 Y-17
+S0
+G0 X88 Y-19
+S1000
+G1 X89 Y-19
+S0
+G0 X91 Y-19
+G0 X91 Y-19
+G0 X91 Y-19
+G0 X91 Y-19
+G0 X91 Y-16
+S1000
+G1 X96 Y-16
+S0
+G0 X98 Y-19
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+S1000
+G1 X0 Y-26
+S0
+G0 X0 Y-28
+S1000
+G1 X1 Y-26
+G1 X2 Y-28
+G1 X2 Y-31
+S0
+G0 X2 Y-28
+S1000
+G1 X4 Y-26
+G1 X5 Y-28
+G1 X5 Y-31
+S0
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X9 Y-31
+S1000
+G1 X9 Y-27
+G1 X8 Y-27
+S0
+G0 X9 Y-24
+S1000
+G1 X9 Y-24
+S0
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X18 Y-28
+S1000
+G1 X16 Y-27
+G1 X14 Y-28
+G1 X14 Y-31
+G1 X16 Y-31
+G1 X18 Y-31
+S0
+G0 X21 Y-31
+G0 X21 Y-31
+G0 X21 Y-31
+G0 X21 Y-31
+G0 X21 Y-31
+G0 X21 Y-31
+G0 X21 Y-31
+G0 X21 Y-31
+S1000
+G1 X21 Y-27
+S0
+G0 X21 Y-28
+S1000
+G1 X23 Y-27
+G1 X26 Y-28
+S0
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X30 Y-31
+S1000
+G1 X28 Y-31
+G1 X28 Y-28
+G1 X30 Y-27
+G1 X33 Y-28
+G1 X33 Y-31
+G1 X30 Y-31
+S0
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+S1000
+G1 X37 Y-31
+G1 X40 Y-31
+G1 X40 Y-29
+G1 X35 Y-29
+G1 X35 Y-27
+G1 X37 Y-26
+G1 X40 Y-27
+S0
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X46 Y-28
+S1000
+G1 X44 Y-27
+G1 X42 Y-28
+G1 X42 Y-31
+G1 X44 Y-31
+G1 X46 Y-31
+S0
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X51 Y-31
+S1000
+G1 X49 Y-31
+G1 X49 Y-28
+G1 X51 Y-27
+G1 X54 Y-28
+G1 X54 Y-31
+G1 X51 Y-31
+S0
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-31
+G0 X56 Y-33
+S1000
+G1 X56 Y-27
+S0
+G0 X56 Y-28
+S1000
+G1 X58 Y-27
+G1 X61 Y-28
+G1 X61 Y-31
+G1 X58 Y-31
+G1 X56 Y-31
+S0
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X65 Y-31
+S1000
+G1 X65 Y-27
+G1 X64 Y-27
+S0
+G0 X65 Y-24
+S1000
+G1 X65 Y-24
+S0
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X74 Y-28
+S1000
+G1 X72 Y-27
+G1 X70 Y-28
+G1 X70 Y-31
+G1 X72 Y-31
+G1 X74 Y-31
+S0
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+G0 X77 Y-31
+S1000
+G1 X79 Y-31
+G1 X82 Y-31
+G1 X82 Y-29
+G1 X77 Y-29
+G1 X77 Y-27
+G1 X79 Y-26
+G1 X82 Y-27
+S0
+G0 X84 Y-31
+G0 X84 Y-31
+G0 X84 Y-31
+G0 X84 Y-31
+G0 X84 Y-31
+G0 X84 Y-31
+G0 X84 Y-31
+G0 X86 Y-31
+S1000
+G1 X86 Y-27
+G1 X85 Y-27
+S0
+G0 X86 Y-24
+S1000
+G1 X86 Y-24
+S0
+G0 X91 Y-31
+G0 X91 Y-31
+G0 X91 Y-31
+G0 X91 Y-31
+G0 X91 Y-28
+S1000
+G1 X96 Y-28
+S0
+G0 X98 Y-31
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X0 Y-45
+G0 X1 Y-45
+S1000
+G1 X3 Y-45
+S0
+G0 X2 Y-45
+S1000
+G1 X2 Y-38
+G1 X1 Y-38
+S0
+G0 X7 Y-45
+G0 X7 Y-45
+G0 X7 Y-45
+G0 X7 Y-45
+G0 X7 Y-45
+G0 X7 Y-45
+G0 X7 Y-45
+G0 X9 Y-45
+S1000
+G1 X9 Y-41
+G1 X8 Y-41
+S0
+G0 X9 Y-38
+S1000
+G1 X9 Y-38
+S0
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X14 Y-45
+G0 X18 Y-42
+S1000
+G1 X16 Y-41
+G1 X14 Y-42
+G1 X14 Y-45
+G1 X16 Y-45
+G1 X18 Y-45
+S0
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X21 Y-45
+G0 X23 Y-45
+S1000
+G1 X21 Y-45
+G1 X21 Y-42
+G1 X23 Y-41
+G1 X26 Y-42
+G1 X26 Y-45
+G1 X23 Y-45
+S0
+G0 X28 Y-45
+G0 X28 Y-45
+G0 X28 Y-45
+G0 X28 Y-45
+G0 X28 Y-45
+G0 X28 Y-41
+S1000
+G1 X30 Y-45
+G1 X33 Y-41
+S0
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X35 Y-45
+G0 X37 Y-45
+S1000
+G1 X35 Y-45
+G1 X35 Y-42
+G1 X37 Y-41
+G1 X40 Y-42
+G1 X40 Y-45
+G1 X37 Y-45
+S0
+G0 X42 Y-45
+G0 X42 Y-45
+G0 X42 Y-45
+G0 X42 Y-45
+G0 X42 Y-45
+G0 X42 Y-45
+G0 X42 Y-45
+G0 X43 Y-45
+S1000
+G1 X45 Y-45
+S0
+G0 X44 Y-45
+S1000
+G1 X44 Y-38
+G1 X43 Y-38
+S0
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X49 Y-45
+G0 X53 Y-42
+S1000
+G1 X51 Y-41
+G1 X49 Y-42
+G1 X49 Y-45
+G1 X51 Y-45
+G1 X53 Y-45
+S0
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-45
+G0 X56 Y-41
+S1000
+G1 X58 Y-40
+G1 X60 Y-41
+G1 X60 Y-45
+G1 X59 Y-45
+G1 X57 Y-45
+G1 X56 Y-45
+G1 X56 Y-43
+G1 X60 Y-43
+S0
+G0 X60 Y-45
+S1000
+G1 X61 Y-45
+S0
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+G0 X63 Y-45
+S1000
+G1 X63 Y-41
+S0
+G0 X63 Y-42
+S1000
+G1 X65 Y-41
+G1 X68 Y-42
+G1 X68 Y-45
+S0
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X70 Y-45
+G0 X72 Y-45
+S1000
+G1 X70 Y-45
+G1 X70 Y-42
+G1 X72 Y-41
+G1 X75 Y-42
+G1 X75 Y-45
+G1 X72 Y-45
+S0
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X77 Y-45
+G0 X81 Y-42
+S1000
+G1 X79 Y-41
+G1 X77 Y-42
+G1 X77 Y-45
+G1 X79 Y-45
+G1 X81 Y-45
+S0
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X84 Y-45
+G0 X86 Y-45
+S1000
+G1 X84 Y-45
+G1 X84 Y-42
+G1 X86 Y-41
+G1 X89 Y-42
+G1 X89 Y-45
+G1 X86 Y-45
+S0
+G0 X91 Y-45
+G0 X91 Y-45
+G0 X91 Y-45
+G0 X91 Y-45
+G0 X91 Y-42
+S1000
+G1 X96 Y-42
+S0
+G0 X98 Y-45
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+G0 X0 Y-57
+S1000
+G1 X0 Y-53
+S0
+G0 X0 Y-54
+S1000
+G1 X2 Y-53
+G1 X5 Y-54
+G1 X5 Y-57
+S0
+G0 X7 Y-57
+G0 X7 Y-57
+G0 X7 Y-57
+G0 X7 Y-57
+G0 X7 Y-57
+G0 X7 Y-57
+G0 X7 Y-57
+G0 X9 Y-57
+S1000
+G1 X9 Y-53
+G1 X8 Y-53
+S0
+G0 X9 Y-50
+S1000
+G1 X9 Y-50
+S0
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X14 Y-57
+G0 X16 Y-57
+S1000
+G1 X14 Y-57
+G1 X14 Y-54
+G1 X16 Y-53
+G1 X19 Y-54
+G1 X19 Y-57
+G1 X16 Y-57
+S0
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+G0 X21 Y-57
+S1000
+G1 X23 Y-57
+G1 X26 Y-57
+G1 X26 Y-55
+G1 X21 Y-55
+G1 X21 Y-53
+G1 X23 Y-52
+G1 X26 Y-53
+S0
+G0 X28 Y-57
+G0 X28 Y-57
+G0 X28 Y-57
+G0 X28 Y-57
+G0 X28 Y-57
+G0 X28 Y-57
+G0 X28 Y-57
+G0 X30 Y-57
+S1000
+G1 X30 Y-53
+G1 X29 Y-53
+S0
+G0 X30 Y-50
+S1000
+G1 X30 Y-50
+S0
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+G0 X35 Y-57
+S1000
+G1 X37 Y-57
+G1 X40 Y-57
+G1 X40 Y-55
+G1 X35 Y-55
+G1 X35 Y-53
+G1 X37 Y-52
+G1 X40 Y-53
+S0
+G0 X42 Y-57
+G0 X0 Y-69
+G0 X0 Y-69
+G0 X0 Y-69
+G0 X0 Y-69
+G0 X0 Y-69
+G0 X0 Y-69
+G0 X0 Y-69
+G0 X0 Y-69
+S1000
+G1 X2 Y-62
+G1 X5 Y-69
+S0
+G0 X1 Y-66
+S1000
+G1 X3 Y-66
+S0
+G0 X7 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+G0 X19 Y-69
+S1000
+G1 X21 Y-69
+G1 X24 Y-69
+G1 X24 Y-67
+G1 X19 Y-67
+G1 X19 Y-65
+G1 X21 Y-64
+G1 X24 Y-65
+S0
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+G0 X26 Y-69
+S1000
+G1 X26 Y-62
+S0
+G0 X26 Y-66
+S1000
+G1 X28 Y-65
+G1 X31 Y-66
+G1 X31 Y-69
+S0
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X33 Y-69
+G0 X35 Y-69
+S1000
+G1 X33 Y-69
+G1 X33 Y-66
+G1 X35 Y-65
+G1 X38 Y-66
+G1 X38 Y-69
+G1 X35 Y-69
+S0
+G0 X40 Y-69
+G0 X40 Y-69
+G0 X40 Y-69
+G0 X40 Y-69
+G0 X40 Y-69
+G0 X40 Y-69
+G0 X40 Y-69
+G0 X40 Y-69
+S1000
+G1 X40 Y-65
+S0
+G0 X40 Y-66
+S1000
+G1 X42 Y-65
+G1 X45 Y-66
+S0
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X47 Y-69
+G0 X52 Y-69
+S1000
+G1 X50 Y-69
+G1 X48 Y-69
+G1 X48 Y-62
+S0
+G0 X47 Y-65
+S1000
+G1 X50 Y-65
+S0
+G0 X54 Y-69
+G0 X65 Y-69
+G0 X65 Y-69
+G0 X65 Y-69
+G0 X65 Y-69
+G0 X65 Y-69
+G0 X65 Y-69
+G0 X66 Y-69
+S1000
+G1 X68 Y-69
+S0
+G0 X67 Y-69
+S1000
+G1 X67 Y-62
+G1 X66 Y-62
+S0
+G0 X72 Y-69
+G0 X72 Y-69
+G0 X72 Y-69
+G0 X72 Y-69
+G0 X72 Y-69
+G0 X72 Y-69
+G0 X72 Y-69
+G0 X74 Y-69
+S1000
+G1 X74 Y-65
+G1 X73 Y-65
+S0
+G0 X74 Y-62
+S1000
+G1 X74 Y-62
+S0
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+G0 X79 Y-69
+S1000
+G1 X79 Y-65
+S0
+G0 X79 Y-66
+S1000
+G1 X81 Y-65
+G1 X84 Y-66
+G1 X84 Y-69
+S0
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-69
+G0 X86 Y-67
+S1000
+G1 X91 Y-67
+G1 X89 Y-64
+G1 X87 Y-64
+G1 X86 Y-66
+G1 X86 Y-69
+G1 X87 Y-69
+G1 X89 Y-69
+G1 X91 Y-69
+S0
+G0 X93 Y-69
+G0 X93 Y-69
+G0 X93 Y-69
+G0 X93 Y-69
+G0 X93 Y-69
+G0 X94 Y-70
+S1000
+G1 X95 Y-69
+G1 X95 Y-69
+S0
+G0 X100 Y-69
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X0 Y-82
+G0 X5 Y-82
+S1000
+G1 X3 Y-82
+G1 X1 Y-82
+G1 X1 Y-75
+S0
+G0 X0 Y-78
+S1000
+G1 X3 Y-78
+S0
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+G0 X7 Y-82
+S1000
+G1 X7 Y-75
+S0
+G0 X7 Y-79
+S1000
+G1 X9 Y-78
+G1 X12 Y-79
+G1 X12 Y-82
+S0
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-82
+G0 X14 Y-80
+S1000
+G1 X19 Y-80
+G1 X17 Y-77
+G1 X15 Y-77
+G1 X14 Y-79
+G1 X14 Y-82
+G1 X15 Y-82
+G1 X17 Y-82
+G1 X19 Y-82
+S0
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+G0 X21 Y-82
+S1000
+G1 X21 Y-78
+S0
+G0 X21 Y-79
+S1000
+G1 X23 Y-78
+G1 X26 Y-79
+G1 X26 Y-82
+S0
+G0 X28 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-82
+G0 X40 Y-78
+S1000
+G1 X42 Y-77
+G1 X44 Y-78
+G1 X44 Y-82
+G1 X43 Y-82
+G1 X41 Y-82
+G1 X40 Y-82
+G1 X40 Y-80
+G1 X44 Y-80
+S0
+G0 X44 Y-82
+S1000
+G1 X45 Y-82
+S0
+G0 X47 Y-82
+G0 X58 Y-82
+G0 X58 Y-82
+G0 X58 Y-82
+G0 X58 Y-82
+G0 X58 Y-82
+G0 X58 Y-82
+G0 X59 Y-82
+S1000
+G1 X61 Y-82
+S0
+G0 X60 Y-82
+S1000
+G1 X60 Y-75
+G1 X59 Y-75
+S0
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X65 Y-82
+G0 X67 Y-82
+S1000
+G1 X65 Y-82
+G1 X65 Y-79
+G1 X67 Y-78
+G1 X70 Y-79
+G1 X70 Y-82
+G1 X67 Y-82
+S0
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+G0 X72 Y-82
+S1000
+G1 X72 Y-78
+S0
+G0 X72 Y-79
+S1000
+G1 X74 Y-78
+G1 X77 Y-79
+G1 X77 Y-82
+S0
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X79 Y-82
+G0 X83 Y-82
+S1000
+G1 X81 Y-82
+G1 X79 Y-82
+G1 X79 Y-79
+G1 X81 Y-78
+G1 X83 Y-79
+S0
+G0 X83 Y-78
+S1000
+G1 X83 Y-84
+G1 X81 Y-84
+G1 X79 Y-84
+S0
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-82
+G0 X86 Y-80
+S1000
+G1 X91 Y-80
+G1 X89 Y-77
+G1 X87 Y-77
+G1 X86 Y-79
+G1 X86 Y-82
+G1 X87 Y-82
+G1 X89 Y-82
+G1 X91 Y-82
+S0
+G0 X93 Y-82
+G0 X93 Y-82
+G0 X93 Y-82
+G0 X93 Y-82
+G0 X93 Y-82
+G0 X93 Y-82
+G0 X93 Y-82
+G0 X93 Y-82
+S1000
+G1 X93 Y-78
+S0
+G0 X93 Y-79
+S1000
+G1 X95 Y-78
+G1 X98 Y-79
+S0
+G0 X100 Y-82
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X0 Y-96
+G0 X2 Y-96
+S1000
+G1 X0 Y-96
+G1 X0 Y-93
+G1 X2 Y-92
+G1 X5 Y-93
+G1 X5 Y-96
+G1 X2 Y-96
+S0
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+G0 X7 Y-96
+S1000
+G1 X7 Y-92
+S0
+G0 X7 Y-93
+S1000
+G1 X9 Y-92
+G1 X12 Y-93
+G1 X12 Y-96
+S0
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-96
+G0 X14 Y-94
+S1000
+G1 X19 Y-94
+G1 X17 Y-91
+G1 X15 Y-91
+G1 X14 Y-93
+G1 X14 Y-96
+G1 X15 Y-96
+G1 X17 Y-96
+G1 X19 Y-96
+S0
+G0 X21 Y-96
+G0 X40 Y-96
+G0 X40 Y-96
+G0 X40 Y-96
+G0 X40 Y-96
+G0 X40 Y-96
+G0 X40 Y-96
+G0 X40 Y-96
+G0 X45 Y-96
+S1000
+G1 X43 Y-96
+G1 X41 Y-96
+G1 X41 Y-89
+S0
+G0 X40 Y-92
+S1000
+G1 X43 Y-92
+S0
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X47 Y-96
+G0 X49 Y-96
+S1000
+G1 X47 Y-96
+G1 X47 Y-93
+G1 X49 Y-92
+G1 X52 Y-93
+G1 X52 Y-96
+G1 X49 Y-96
+S0
+G0 X54 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X72 Y-96
+G0 X76 Y-96
+S1000
+G1 X74 Y-96
+G1 X72 Y-96
+G1 X72 Y-93
+G1 X74 Y-92
+G1 X76 Y-93
+S0
+G0 X76 Y-92
+S1000
+G1 X76 Y-98
+G1 X74 Y-98
+G1 X72 Y-98
+S0
+G0 X79 Y-96
+G0 X79 Y-96
+G0 X79 Y-96
+G0 X79 Y-96
+G0 X79 Y-96
+G0 X79 Y-96
+G0 X79 Y-96
+G0 X81 Y-96
+S1000
+G1 X81 Y-92
+G1 X80 Y-92
+S0
+G0 X81 Y-89
+S1000
+G1 X81 Y-89
+S0
+G0 X86 Y-96
+G0 X86 Y-96
+G0 X86 Y-96
+G0 X86 Y-96
+G0 X86 Y-96
+G0 X86 Y-92
+S1000
+G1 X88 Y-96
+G1 X91 Y-92
+S0
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-96
+G0 X93 Y-94
+S1000
+G1 X98 Y-94
+G1 X96 Y-91
+G1 X94 Y-91
+G1 X93 Y-93
+G1 X93 Y-96
+G1 X94 Y-96
+G1 X96 Y-96
+G1 X98 Y-96
+S0
+G0 X100 Y-96
+G0 X0 Y0
+M0
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X5 Y-7
+S1000
+G1 X3 Y-7
+G1 X1 Y-7
+G1 X1 Y0
+S0
+G0 X0 Y-3
+S1000
+G1 X3 Y-3
+S0
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+S1000
+G1 X7 Y0
+S0
+G0 X7 Y-4
+S1000
+G1 X9 Y-3
+G1 X12 Y-4
+G1 X12 Y-7
+S0
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-5
+S1000
+G1 X19 Y-5
+G1 X17 Y-2
+G1 X15 Y-2
+G1 X14 Y-4
+G1 X14 Y-7
+G1 X15 Y-7
+G1 X17 Y-7
+G1 X19 Y-7
+S0
+G0 X21 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+G0 X33 Y-7
+S1000
+G1 X33 Y0
+S0
+G0 X33 Y-4
+S1000
+G1 X35 Y-3
+G1 X38 Y-4
+G1 X38 Y-7
+G1 X35 Y-7
+G1 X33 Y-7
+S0
+G0 X40 Y-7
+G0 X40 Y-7
+G0 X40 Y-7
+G0 X40 Y-7
+G0 X40 Y-7
+G0 X40 Y-7
+G0 X40 Y-7
+G0 X40 Y-7
+S1000
+G1 X40 Y-3
+S0
+G0 X40 Y-4
+S1000
+G1 X42 Y-3
+G1 X45 Y-4
+S0
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-7
+G0 X47 Y-5
+S1000
+G1 X52 Y-5
+G1 X50 Y-2
+G1 X48 Y-2
+G1 X47 Y-4
+G1 X47 Y-7
+G1 X48 Y-7
+G1 X50 Y-7
+G1 X52 Y-7
+S0
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-7
+G0 X54 Y-3
+S1000
+G1 X56 Y-2
+G1 X58 Y-3
+G1 X58 Y-7
+G1 X57 Y-7
+G1 X55 Y-7
+G1 X54 Y-7
+G1 X54 Y-5
+G1 X58 Y-5
+S0
+G0 X58 Y-7
+S1000
+G1 X59 Y-7
+S0
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+G0 X61 Y-7
+S1000
+G1 X61 Y0
+S0
+G0 X61 Y-5
+S1000
+G1 X66 Y-3
+S0
+G0 X62 Y-5
+S1000
+G1 X66 Y-7
+S0
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-7
+G0 X68 Y-5
+S1000
+G1 X73 Y-5
+G1 X71 Y-2
+G1 X69 Y-2
+G1 X68 Y-4
+G1 X68 Y-7
+G1 X69 Y-7
+G1 X71 Y-7
+G1 X73 Y-7
+S0
+G0 X75 Y-7
+G0 X75 Y-7
+G0 X75 Y-7
+G0 X75 Y-7
+G0 X75 Y-7
+G0 X75 Y-7
+G0 X75 Y-7
+G0 X75 Y-7
+S1000
+G1 X75 Y-3
+S0
+G0 X75 Y-4
+S1000
+G1 X77 Y-3
+G1 X80 Y-4
+S0
+G0 X82 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-7
+G0 X93 Y-3
+S1000
+G1 X95 Y-2
+G1 X97 Y-3
+G1 X97 Y-7
+G1 X96 Y-7
+G1 X94 Y-7
+G1 X93 Y-7
+G1 X93 Y-5
+G1 X97 Y-5
+S0
+G0 X97 Y-7
+S1000
+G1 X98 Y-7
+S0
+G0 X100 Y-7
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+S1000
+G1 X0 Y-15
+S0
+G0 X0 Y-16
+S1000
+G1 X2 Y-15
+G1 X5 Y-16
+S0
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-17
+S1000
+G1 X12 Y-17
+G1 X10 Y-14
+G1 X8 Y-14
+G1 X7 Y-16
+G1 X7 Y-19
+G1 X8 Y-19
+G1 X10 Y-19
+G1 X12 Y-19
+S0
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-15
+S1000
+G1 X16 Y-14
+G1 X18 Y-15
+G1 X18 Y-19
+G1 X17 Y-19
+G1 X15 Y-19
+G1 X14 Y-19
+G1 X14 Y-17
+G1 X18 Y-17
+S0
+G0 X18 Y-19
+S1000
+G1 X19 Y-19
+S0
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X22 Y-19
+S1000
+G1 X24 Y-19
+S0
+G0 X23 Y-19
+S1000
+G1 X23 Y-12
+G1 X22 Y-12
+S0
+G0 X28 Y-19
+G0 X58 Y-19
+G0 X58 Y-19
+G0 X58 Y-19
+G0 X58 Y-19
+G0 X58 Y-19
+G0 X58 Y-19
+G0 X58 Y-19
+G0 X62 Y-16
+S1000
+G1 X60 Y-15
+G1 X58 Y-16
+G1 X58 Y-19
+G1 X60 Y-19
+G1 X62 Y-19
+S0
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+G0 X65 Y-19
+S1000
+G1 X65 Y-12
+S0
+G0 X65 Y-16
+S1000
+G1 X67 Y-15
+G1 X70 Y-16
+G1 X70 Y-19
+S0
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X72 Y-19
+G0 X74 Y-19
+S1000
+G1 X72 Y-19
+G1 X72 Y-16
+G1 X74 Y-15
+G1 X77 Y-16
+G1 X77 Y-19
+G1 X74 Y-19
+S0
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X79 Y-19
+G0 X81 Y-19
+S1000
+G1 X81 Y-15
+G1 X80 Y-15
+S0
+G0 X81 Y-12
+S1000
+G1 X81 Y-12
+S0
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X86 Y-19
+G0 X90 Y-16
+S1000
+G1 X88 Y-15
+G1 X86 Y-16
+G1 X86 Y-19
+G1 X88 Y-19
+G1 X90 Y-19
+S0
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-19
+G0 X93 Y-17
+S1000
+G1 X98 Y-17
+G1 X96 Y-14
+G1 X94 Y-14
+G1 X93 Y-16
+G1 X93 Y-19
+G1 X94 Y-19
+G1 X96 Y-19
+G1 X98 Y-19
+S0
+G0 X100 Y-19
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X2 Y-31
+S1000
+G1 X0 Y-31
+G1 X0 Y-28
+G1 X2 Y-27
+G1 X5 Y-28
+G1 X5 Y-31
+G1 X2 Y-31
+S0
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X8 Y-31
+S1000
+G1 X8 Y-25
+G1 X10 Y-24
+G1 X12 Y-25
+S0
+G0 X7 Y-28
+S1000
+G1 X10 Y-28
+S0
+G0 X14 Y-31
+G0 X26 Y-31
+G0 X26 Y-31
+G0 X26 Y-31
+G0 X26 Y-31
+G0 X26 Y-31
+G0 X26 Y-31
+G0 X26 Y-27
+S1000
+G1 X27 Y-31
+G1 X28 Y-28
+G1 X29 Y-31
+G1 X31 Y-27
+S0
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+G0 X33 Y-31
+S1000
+G1 X33 Y-24
+S0
+G0 X33 Y-28
+S1000
+G1 X35 Y-27
+G1 X38 Y-28
+G1 X38 Y-31
+S0
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-31
+G0 X40 Y-29
+S1000
+G1 X45 Y-29
+G1 X43 Y-26
+G1 X41 Y-26
+G1 X40 Y-28
+G1 X40 Y-31
+G1 X41 Y-31
+G1 X43 Y-31
+G1 X45 Y-31
+S0
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+G0 X47 Y-31
+S1000
+G1 X47 Y-27
+S0
+G0 X47 Y-28
+S1000
+G1 X49 Y-27
+G1 X52 Y-28
+S0
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-31
+G0 X54 Y-29
+S1000
+G1 X59 Y-29
+G1 X57 Y-26
+G1 X55 Y-26
+G1 X54 Y-28
+G1 X54 Y-31
+G1 X55 Y-31
+G1 X57 Y-31
+G1 X59 Y-31
+S0
+G0 X61 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-31
+G0 X72 Y-29
+S1000
+G1 X77 Y-29
+G1 X75 Y-26
+G1 X73 Y-26
+G1 X72 Y-28
+G1 X72 Y-31
+G1 X73 Y-31
+G1 X75 Y-31
+G1 X77 Y-31
+S0
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-31
+G0 X79 Y-27
+S1000
+G1 X81 Y-26
+G1 X83 Y-27
+G1 X83 Y-31
+G1 X82 Y-31
+G1 X80 Y-31
+G1 X79 Y-31
+G1 X79 Y-29
+G1 X83 Y-29
+S0
+G0 X83 Y-31
+S1000
+G1 X84 Y-31
+S0
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X86 Y-31
+G0 X90 Y-28
+S1000
+G1 X88 Y-27
+G1 X86 Y-28
+G1 X86 Y-31
+G1 X88 Y-31
+G1 X90 Y-31
+S0
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+G0 X93 Y-31
+S1000
+G1 X93 Y-24
+S0
+G0 X93 Y-28
+S1000
+G1 X95 Y-27
+G1 X98 Y-28
+G1 X98 Y-31
+S0
+G0 X100 Y-31
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X1 Y-43
+S1000
+G1 X3 Y-43
+S0
+G0 X2 Y-43
+S1000
+G1 X2 Y-36
+G1 X1 Y-36
+S0
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X9 Y-43
+S1000
+G1 X9 Y-39
+G1 X8 Y-39
+S0
+G0 X9 Y-36
+S1000
+G1 X9 Y-36
+S0
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+S1000
+G1 X14 Y-39
+S0
+G0 X14 Y-40
+S1000
+G1 X16 Y-39
+G1 X19 Y-40
+G1 X19 Y-43
+S0
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-43
+G0 X21 Y-41
+S1000
+G1 X26 Y-41
+G1 X24 Y-38
+G1 X22 Y-38
+G1 X21 Y-40
+G1 X21 Y-43
+G1 X22 Y-43
+G1 X24 Y-43
+G1 X26 Y-43
+S0
+G0 X28 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+G0 X58 Y-43
+S1000
+G1 X60 Y-43
+G1 X63 Y-43
+G1 X63 Y-41
+G1 X58 Y-41
+G1 X58 Y-39
+G1 X60 Y-38
+G1 X63 Y-39
+S0
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+G0 X65 Y-43
+S1000
+G1 X65 Y-36
+S0
+G0 X65 Y-40
+S1000
+G1 X67 Y-39
+G1 X70 Y-40
+G1 X70 Y-43
+S0
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X72 Y-43
+G0 X74 Y-43
+S1000
+G1 X72 Y-43
+G1 X72 Y-40
+G1 X74 Y-39
+G1 X77 Y-40
+G1 X77 Y-43
+G1 X74 Y-43
+S0
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-43
+G0 X79 Y-39
+S1000
+G1 X79 Y-43
+G1 X81 Y-43
+G1 X84 Y-43
+G1 X84 Y-39
+S0
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X86 Y-43
+G0 X87 Y-43
+S1000
+G1 X89 Y-43
+S0
+G0 X88 Y-43
+S1000
+G1 X88 Y-36
+G1 X87 Y-36
+S0
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X93 Y-43
+G0 X98 Y-43
+S1000
+G1 X95 Y-43
+G1 X93 Y-43
+G1 X93 Y-40
+G1 X95 Y-39
+G1 X98 Y-40
+S0
+G0 X98 Y-36
+S1000
+G1 X98 Y-43
+S0
+G0 X100 Y-43
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-53
+S1000
+G1 X5 Y-53
+G1 X3 Y-50
+G1 X1 Y-50
+G1 X0 Y-52
+G1 X0 Y-55
+G1 X1 Y-55
+G1 X3 Y-55
+G1 X5 Y-55
+S0
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+G0 X7 Y-55
+S1000
+G1 X7 Y-51
+S0
+G0 X7 Y-52
+S1000
+G1 X9 Y-51
+G1 X12 Y-52
+G1 X12 Y-55
+S0
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X14 Y-55
+G0 X19 Y-55
+S1000
+G1 X16 Y-55
+G1 X14 Y-55
+G1 X14 Y-52
+G1 X16 Y-51
+G1 X19 Y-52
+S0
+G0 X19 Y-48
+S1000
+G1 X19 Y-55
+S0
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X21 Y-55
+G0 X23 Y-55
+S1000
+G1 X23 Y-55
+G1 X23 Y-55
+S0
+G0 X28 Y-55
+G0 X0 Y-67
+G0 X0 Y0
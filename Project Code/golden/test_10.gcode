@@ -0,0 +1,682 @@
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X0 Y-10
+G0 X3 Y-10
+S1000
+G1 X3 Y0
+S0
+G0 X0 Y0
+S1000
+G1 X6 Y0
+S0
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+G0 X10 Y-10
+S1000
+G1 X10 Y0
+S0
+G0 X10 Y-5
+S1000
+G1 X13 Y-4
+G1 X16 Y-5
+G1 X16 Y-10
+S0
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-10
+G0 X20 Y-7
+S1000
+G1 X26 Y-7
+G1 X25 Y-4
+G1 X21 Y-4
+G1 X20 Y-5
+G1 X20 Y-9
+G1 X21 Y-10
+G1 X25 Y-10
+G1 X26 Y-9
+S0
+G0 X30 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-10
+G0 X40 Y-4
+S1000
+G1 X41 Y-10
+G1 X43 Y-6
+G1 X45 Y-10
+G1 X46 Y-4
+S0
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-10
+G0 X50 Y-5
+S1000
+G1 X52 Y-4
+G1 X56 Y-5
+G1 X56 Y-9
+G1 X54 Y-10
+G1 X52 Y-10
+G1 X50 Y-9
+G1 X50 Y-8
+G1 X56 Y-7
+S0
+G0 X56 Y-9
+S1000
+G1 X57 Y-10
+S0
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-10
+G0 X60 Y-4
+S1000
+G1 X63 Y-10
+G1 X66 Y-4
+S0
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-10
+G0 X70 Y-7
+S1000
+G1 X76 Y-7
+G1 X75 Y-4
+G1 X71 Y-4
+G1 X70 Y-5
+G1 X70 Y-9
+G1 X71 Y-10
+G1 X75 Y-10
+G1 X76 Y-9
+S0
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-10
+G0 X80 Y-9
+S1000
+G1 X83 Y-10
+G1 X86 Y-9
+G1 X86 Y-8
+G1 X80 Y-7
+G1 X80 Y-5
+G1 X83 Y-4
+G1 X86 Y-5
+S0
+G0 X90 Y-10
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X0 Y-25
+G0 X6 Y-20
+S1000
+G1 X3 Y-19
+G1 X0 Y-20
+G1 X0 Y-24
+G1 X3 Y-25
+G1 X6 Y-24
+S0
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+G0 X10 Y-25
+S1000
+G1 X10 Y-19
+S0
+G0 X10 Y-21
+S1000
+G1 X13 Y-19
+G1 X16 Y-21
+S0
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-25
+G0 X20 Y-20
+S1000
+G1 X22 Y-19
+G1 X26 Y-20
+G1 X26 Y-24
+G1 X24 Y-25
+G1 X22 Y-25
+G1 X20 Y-24
+G1 X20 Y-23
+G1 X26 Y-22
+S0
+G0 X26 Y-24
+S1000
+G1 X27 Y-25
+S0
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-25
+G0 X30 Y-24
+S1000
+G1 X33 Y-25
+G1 X36 Y-24
+G1 X36 Y-23
+G1 X30 Y-22
+G1 X30 Y-20
+G1 X33 Y-19
+G1 X36 Y-20
+S0
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+G0 X40 Y-25
+S1000
+G1 X40 Y-15
+S0
+G0 X40 Y-20
+S1000
+G1 X43 Y-19
+G1 X46 Y-20
+G1 X46 Y-25
+S0
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-25
+G0 X50 Y-22
+S1000
+G1 X56 Y-22
+G1 X55 Y-19
+G1 X51 Y-19
+G1 X50 Y-20
+G1 X50 Y-24
+G1 X51 Y-25
+G1 X55 Y-25
+G1 X56 Y-24
+S0
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X60 Y-25
+G0 X66 Y-24
+S1000
+G1 X63 Y-25
+G1 X60 Y-24
+G1 X60 Y-20
+G1 X63 Y-19
+G1 X66 Y-20
+S0
+G0 X66 Y-15
+S1000
+G1 X66 Y-25
+S0
+G0 X70 Y-25
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X0 Y-40
+G0 X3 Y-40
+S1000
+G1 X3 Y-34
+G1 X2 Y-34
+S0
+G0 X3 Y-30
+S1000
+G1 X3 Y-30
+S0
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+G0 X10 Y-40
+S1000
+G1 X10 Y-34
+S0
+G0 X10 Y-36
+S1000
+G1 X13 Y-34
+G1 X16 Y-36
+G1 X16 Y-40
+S0
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X20 Y-40
+G0 X26 Y-39
+S1000
+G1 X24 Y-40
+G1 X22 Y-39
+G1 X22 Y-30
+S0
+G0 X20 Y-34
+S1000
+G1 X24 Y-34
+S0
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X30 Y-40
+G0 X33 Y-40
+S1000
+G1 X30 Y-39
+G1 X30 Y-35
+G1 X33 Y-34
+G1 X36 Y-35
+G1 X36 Y-39
+G1 X33 Y-40
+S0
+G0 X40 Y-40
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X0 Y-55
+G0 X6 Y-54
+S1000
+G1 X4 Y-55
+G1 X2 Y-54
+G1 X2 Y-45
+S0
+G0 X0 Y-49
+S1000
+G1 X4 Y-49
+S0
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+G0 X10 Y-55
+S1000
+G1 X10 Y-45
+S0
+G0 X10 Y-50
+S1000
+G1 X13 Y-49
+G1 X16 Y-50
+G1 X16 Y-55
+S0
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-55
+G0 X20 Y-52
+S1000
+G1 X26 Y-52
+G1 X25 Y-49
+G1 X21 Y-49
+G1 X20 Y-50
+G1 X20 Y-54
+G1 X21 Y-55
+G1 X25 Y-55
+G1 X26 Y-54
+S0
+G0 X30 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-55
+G0 X40 Y-54
+S1000
+G1 X43 Y-55
+G1 X46 Y-54
+G1 X46 Y-53
+G1 X40 Y-52
+G1 X40 Y-50
+G1 X43 Y-49
+G1 X46 Y-50
+S0
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X50 Y-55
+G0 X53 Y-55
+S1000
+G1 X53 Y-49
+G1 X52 Y-49
+S0
+G0 X53 Y-45
+S1000
+G1 X53 Y-45
+S0
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X60 Y-55
+G0 X66 Y-54
+S1000
+G1 X63 Y-55
+G1 X60 Y-54
+G1 X60 Y-50
+G1 X63 Y-49
+G1 X66 Y-50
+S0
+G0 X66 Y-45
+S1000
+G1 X66 Y-55
+S0
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-55
+G0 X70 Y-52
+S1000
+G1 X76 Y-52
+G1 X75 Y-49
+G1 X71 Y-49
+G1 X70 Y-50
+G1 X70 Y-54
+G1 X71 Y-55
+G1 X75 Y-55
+G1 X76 Y-54
+S0
+G0 X80 Y-55
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X0 Y-70
+G0 X3 Y-70
+S1000
+G1 X0 Y-69
+G1 X0 Y-65
+G1 X3 Y-64
+G1 X6 Y-65
+G1 X6 Y-69
+G1 X3 Y-70
+S0
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X10 Y-70
+G0 X12 Y-70
+S1000
+G1 X12 Y-62
+G1 X14 Y-60
+G1 X16 Y-62
+S0
+G0 X10 Y-65
+S1000
+G1 X14 Y-65
+S0
+G0 X20 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X30 Y-70
+G0 X36 Y-69
+S1000
+G1 X34 Y-70
+G1 X32 Y-69
+G1 X32 Y-60
+S0
+G0 X30 Y-64
+S1000
+G1 X34 Y-64
+S0
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+G0 X40 Y-70
+S1000
+G1 X40 Y-60
+S0
+G0 X40 Y-65
+S1000
+G1 X43 Y-64
+G1 X46 Y-65
+G1 X46 Y-70
+S0
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-70
+G0 X50 Y-67
+S1000
+G1 X56 Y-67
+G1 X55 Y-64
+G1 X51 Y-64
+G1 X50 Y-65
+G1 X50 Y-69
+G1 X51 Y-70
+G1 X55 Y-70
+G1 X56 Y-69
+S0
+G0 X60 Y-70
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X0 Y-85
+G0 X6 Y-80
+S1000
+G1 X3 Y-79
+G1 X0 Y-80
+G1 X0 Y-84
+G1 X3 Y-85
+G1 X6 Y-84
+S0
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X10 Y-85
+G0 X11 Y-85
+S1000
+G1 X15 Y-85
+S0
+G0 X13 Y-85
+S1000
+G1 X13 Y-75
+G1 X11 Y-75
+S0
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X20 Y-85
+G0 X23 Y-85
+S1000
+G1 X23 Y-79
+G1 X22 Y-79
+S0
+G0 X23 Y-75
+S1000
+G1 X23 Y-75
+S0
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X30 Y-85
+G0 X32 Y-85
+S1000
+G1 X32 Y-77
+G1 X34 Y-75
+G1 X36 Y-77
+S0
+G0 X30 Y-80
+S1000
+G1 X34 Y-80
+S0
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X40 Y-85
+G0 X42 Y-85
+S1000
+G1 X42 Y-77
+G1 X44 Y-75
+G1 X46 Y-77
+S0
+G0 X40 Y-80
+S1000
+G1 X44 Y-80
+S0
+G0 X50 Y-85
+G0 X0 Y0
@@ -0,0 +1,678 @@
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X0 Y-4
+G0 X1 Y-4
+S1000
+G1 X1 Y0
+S0
+G0 X0 Y0
+S1000
+G1 X2 Y0
+S0
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+G0 X4 Y-4
+S1000
+G1 X4 Y0
+S0
+G0 X4 Y-2
+S1000
+G1 X5 Y-2
+G1 X6 Y-2
+G1 X6 Y-4
+S0
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-4
+G0 X8 Y-3
+S1000
+G1 X10 Y-3
+G1 X10 Y-2
+G1 X8 Y-2
+G1 X8 Y-2
+G1 X8 Y-4
+G1 X8 Y-4
+G1 X10 Y-4
+G1 X10 Y-4
+S0
+G0 X12 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-4
+G0 X16 Y-2
+S1000
+G1 X16 Y-4
+G1 X17 Y-3
+G1 X18 Y-4
+G1 X18 Y-2
+S0
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-4
+G0 X20 Y-2
+S1000
+G1 X21 Y-2
+G1 X22 Y-2
+G1 X22 Y-4
+G1 X21 Y-4
+G1 X20 Y-4
+G1 X20 Y-4
+G1 X20 Y-3
+G1 X22 Y-3
+S0
+G0 X22 Y-4
+S1000
+G1 X22 Y-4
+S0
+G0 X24 Y-4
+G0 X24 Y-4
+G0 X24 Y-4
+G0 X24 Y-4
+G0 X24 Y-4
+G0 X24 Y-2
+S1000
+G1 X25 Y-4
+G1 X26 Y-2
+S0
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-4
+G0 X28 Y-3
+S1000
+G1 X30 Y-3
+G1 X30 Y-2
+G1 X28 Y-2
+G1 X28 Y-2
+G1 X28 Y-4
+G1 X28 Y-4
+G1 X30 Y-4
+G1 X30 Y-4
+S0
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+G0 X32 Y-4
+S1000
+G1 X33 Y-4
+G1 X34 Y-4
+G1 X34 Y-3
+G1 X32 Y-3
+G1 X32 Y-2
+G1 X33 Y-2
+G1 X34 Y-2
+S0
+G0 X36 Y-4
+G0 X40 Y-4
+G0 X40 Y-4
+G0 X40 Y-4
+G0 X40 Y-4
+G0 X40 Y-4
+G0 X40 Y-4
+G0 X40 Y-4
+G0 X42 Y-2
+S1000
+G1 X41 Y-2
+G1 X40 Y-2
+G1 X40 Y-4
+G1 X41 Y-4
+G1 X42 Y-4
+S0
+G0 X44 Y-4
+G0 X44 Y-4
+G0 X44 Y-4
+G0 X44 Y-4
+G0 X44 Y-4
+G0 X44 Y-4
+G0 X44 Y-4
+G0 X44 Y-4
+S1000
+G1 X44 Y-2
+S0
+G0 X44 Y-3
+S1000
+G1 X45 Y-2
+G1 X46 Y-3
+S0
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-4
+G0 X48 Y-2
+S1000
+G1 X49 Y-2
+G1 X50 Y-2
+G1 X50 Y-4
+G1 X49 Y-4
+G1 X48 Y-4
+G1 X48 Y-4
+G1 X48 Y-3
+G1 X50 Y-3
+S0
+G0 X50 Y-4
+S1000
+G1 X50 Y-4
+S0
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+G0 X52 Y-4
+S1000
+G1 X53 Y-4
+G1 X54 Y-4
+G1 X54 Y-3
+G1 X52 Y-3
+G1 X52 Y-2
+G1 X53 Y-2
+G1 X54 Y-2
+S0
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+G0 X56 Y-4
+S1000
+G1 X56 Y0
+S0
+G0 X56 Y-2
+S1000
+G1 X57 Y-2
+G1 X58 Y-2
+G1 X58 Y-4
+S0
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-4
+G0 X60 Y-3
+S1000
+G1 X62 Y-3
+G1 X62 Y-2
+G1 X60 Y-2
+G1 X60 Y-2
+G1 X60 Y-4
+G1 X60 Y-4
+G1 X62 Y-4
+G1 X62 Y-4
+S0
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X64 Y-4
+G0 X66 Y-4
+S1000
+G1 X65 Y-4
+G1 X64 Y-4
+G1 X64 Y-2
+G1 X65 Y-2
+G1 X66 Y-2
+S0
+G0 X66 Y0
+S1000
+G1 X66 Y-4
+S0
+G0 X68 Y-4
+G0 X72 Y-4
+G0 X72 Y-4
+G0 X72 Y-4
+G0 X72 Y-4
+G0 X72 Y-4
+G0 X72 Y-4
+G0 X73 Y-4
+S1000
+G1 X73 Y-2
+G1 X72 Y-2
+S0
+G0 X73 Y0
+S1000
+G1 X73 Y0
+S0
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+G0 X76 Y-4
+S1000
+G1 X76 Y-2
+S0
+G0 X76 Y-3
+S1000
+G1 X77 Y-2
+G1 X78 Y-3
+G1 X78 Y-4
+S0
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X80 Y-4
+G0 X82 Y-4
+S1000
+G1 X81 Y-4
+G1 X80 Y-4
+G1 X80 Y0
+S0
+G0 X80 Y-2
+S1000
+G1 X81 Y-2
+S0
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X84 Y-4
+G0 X85 Y-4
+S1000
+G1 X84 Y-4
+G1 X84 Y-2
+G1 X85 Y-2
+G1 X86 Y-2
+G1 X86 Y-4
+G1 X85 Y-4
+S0
+G0 X88 Y-4
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X0 Y-13
+G0 X2 Y-13
+S1000
+G1 X1 Y-13
+G1 X0 Y-13
+G1 X0 Y-9
+S0
+G0 X0 Y-11
+S1000
+G1 X1 Y-11
+S0
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+G0 X4 Y-13
+S1000
+G1 X4 Y-9
+S0
+G0 X4 Y-11
+S1000
+G1 X5 Y-11
+G1 X6 Y-11
+G1 X6 Y-13
+S0
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-13
+G0 X8 Y-12
+S1000
+G1 X10 Y-12
+G1 X10 Y-11
+G1 X8 Y-11
+G1 X8 Y-11
+G1 X8 Y-13
+G1 X8 Y-13
+G1 X10 Y-13
+G1 X10 Y-13
+S0
+G0 X12 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+G0 X16 Y-13
+S1000
+G1 X17 Y-13
+G1 X18 Y-13
+G1 X18 Y-12
+G1 X16 Y-12
+G1 X16 Y-11
+G1 X17 Y-11
+G1 X18 Y-11
+S0
+G0 X20 Y-13
+G0 X20 Y-13
+G0 X20 Y-13
+G0 X20 Y-13
+G0 X20 Y-13
+G0 X20 Y-13
+G0 X20 Y-13
+G0 X21 Y-13
+S1000
+G1 X21 Y-11
+G1 X20 Y-11
+S0
+G0 X21 Y-9
+S1000
+G1 X21 Y-9
+S0
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X24 Y-13
+G0 X26 Y-13
+S1000
+G1 X25 Y-13
+G1 X24 Y-13
+G1 X24 Y-11
+G1 X25 Y-11
+G1 X26 Y-11
+S0
+G0 X26 Y-9
+S1000
+G1 X26 Y-13
+S0
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-13
+G0 X28 Y-12
+S1000
+G1 X30 Y-12
+G1 X30 Y-11
+G1 X28 Y-11
+G1 X28 Y-11
+G1 X28 Y-13
+G1 X28 Y-13
+G1 X30 Y-13
+G1 X30 Y-13
+S0
+G0 X32 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X36 Y-13
+G0 X37 Y-13
+S1000
+G1 X36 Y-13
+G1 X36 Y-11
+G1 X37 Y-11
+G1 X38 Y-11
+G1 X38 Y-13
+G1 X37 Y-13
+S0
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+G0 X40 Y-13
+S1000
+G1 X40 Y-10
+G1 X41 Y-9
+G1 X42 Y-10
+S0
+G0 X40 Y-11
+S1000
+G1 X41 Y-11
+S0
+G0 X44 Y-13
+G0 X48 Y-13
+G0 X48 Y-13
+G0 X48 Y-13
+G0 X48 Y-13
+G0 X48 Y-13
+G0 X48 Y-13
+G0 X48 Y-13
+G0 X50 Y-13
+S1000
+G1 X49 Y-13
+G1 X48 Y-13
+G1 X48 Y-9
+S0
+G0 X48 Y-11
+S1000
+G1 X49 Y-11
+S0
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+G0 X52 Y-13
+S1000
+G1 X52 Y-9
+S0
+G0 X52 Y-11
+S1000
+G1 X53 Y-11
+G1 X54 Y-11
+G1 X54 Y-13
+S0
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-13
+G0 X56 Y-12
+S1000
+G1 X58 Y-12
+G1 X58 Y-11
+G1 X56 Y-11
+G1 X56 Y-11
+G1 X56 Y-13
+G1 X56 Y-13
+G1 X58 Y-13
+G1 X58 Y-13
+S0
+G0 X60 Y-13
+G0 X64 Y-13
+G0 X64 Y-13
+G0 X64 Y-13
+G0 X64 Y-13
+G0 X64 Y-13
+G0 X64 Y-13
+G0 X64 Y-13
+G0 X66 Y-11
+S1000
+G1 X65 Y-11
+G1 X64 Y-11
+G1 X64 Y-13
+G1 X65 Y-13
+G1 X66 Y-13
+S0
+G0 X68 Y-13
+G0 X68 Y-13
+G0 X68 Y-13
+G0 X68 Y-13
+G0 X68 Y-13
+G0 X68 Y-13
+G0 X68 Y-13
+G0 X68 Y-13
+S1000
+G1 X70 Y-13
+S0
+G0 X69 Y-13
+S1000
+G1 X69 Y-9
+G1 X68 Y-9
+S0
+G0 X72 Y-13
+G0 X72 Y-13
+G0 X72 Y-13
+G0 X72 Y-13
+G0 X72 Y-13
+G0 X72 Y-13
+G0 X72 Y-13
+G0 X73 Y-13
+S1000
+G1 X73 Y-11
+G1 X72 Y-11
+S0
+G0 X73 Y-9
+S1000
+G1 X73 Y-9
+S0
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+G0 X76 Y-13
+S1000
+G1 X76 Y-10
+G1 X77 Y-9
+G1 X78 Y-10
+S0
+G0 X76 Y-11
+S1000
+G1 X77 Y-11
+S0
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+G0 X80 Y-13
+S1000
+G1 X80 Y-10
+G1 X81 Y-9
+G1 X82 Y-10
+S0
+G0 X80 Y-11
+S1000
+G1 X81 Y-11
+S0
+G0 X84 Y-13
+G0 X0 Y0
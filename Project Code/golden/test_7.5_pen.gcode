@@ -0,0 +1,674 @@
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X0 Y-7
+G0 X2 Y-7
+G1 X2 Y0 S1000
+S0
+G4 P0.1
+G0 X0 Y0
+G1 X5 Y0 S1000
+S0
+G4 P0.1
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G0 X7 Y-7
+G1 X7 Y0 S1000
+S0
+G4 P0.1
+G0 X7 Y-4
+G1 X9 Y-3 S1000
+G1 X12 Y-4
+G1 X12 Y-7
+S0
+G4 P0.1
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-7
+G0 X14 Y-5
+G1 X19 Y-5 S1000
+G1 X17 Y-2
+G1 X15 Y-2
+G1 X14 Y-4
+G1 X14 Y-7
+G1 X15 Y-7
+G1 X17 Y-7
+G1 X19 Y-7
+S0
+G4 P0.1
+G0 X21 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-7
+G0 X28 Y-3
+G1 X29 Y-7 S1000
+G1 X30 Y-4
+G1 X31 Y-7
+G1 X33 Y-3
+S0
+G4 P0.1
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-7
+G0 X35 Y-3
+G1 X37 Y-2 S1000
+G1 X39 Y-3
+G1 X39 Y-7
+G1 X38 Y-7
+G1 X36 Y-7
+G1 X35 Y-7
+G1 X35 Y-5
+G1 X39 Y-5
+S0
+G4 P0.1
+G0 X39 Y-7
+G1 X40 Y-7 S1000
+S0
+G4 P0.1
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-7
+G0 X42 Y-3
+G1 X44 Y-7 S1000
+G1 X47 Y-3
+S0
+G4 P0.1
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-7
+G0 X49 Y-5
+G1 X54 Y-5 S1000
+G1 X52 Y-2
+G1 X50 Y-2
+G1 X49 Y-4
+G1 X49 Y-7
+G1 X50 Y-7
+G1 X52 Y-7
+G1 X54 Y-7
+S0
+G4 P0.1
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G0 X56 Y-7
+G1 X58 Y-7 S1000
+G1 X61 Y-7
+G1 X61 Y-5
+G1 X56 Y-5
+G1 X56 Y-3
+G1 X58 Y-2
+G1 X61 Y-3
+S0
+G4 P0.1
+G0 X63 Y-7
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X0 Y-19
+G0 X4 Y-16
+G1 X2 Y-15 S1000
+G1 X0 Y-16
+G1 X0 Y-19
+G1 X2 Y-19
+G1 X4 Y-19
+S0
+G4 P0.1
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G0 X7 Y-19
+G1 X7 Y-15 S1000
+G1 X7 Y-16
+G1 X9 Y-15
+G1 X12 Y-16
+S0
+G4 P0.1
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-19
+G0 X14 Y-15
+G1 X16 Y-14 S1000
+G1 X18 Y-15
+G1 X18 Y-19
+G1 X17 Y-19
+G1 X15 Y-19
+G1 X14 Y-19
+G1 X14 Y-17
+G1 X18 Y-17
+S0
+G4 P0.1
+G0 X18 Y-19
+G1 X19 Y-19 S1000
+S0
+G4 P0.1
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G0 X21 Y-19
+G1 X23 Y-19 S1000
+G1 X26 Y-19
+G1 X26 Y-17
+G1 X21 Y-17
+G1 X21 Y-15
+G1 X23 Y-14
+G1 X26 Y-15
+S0
+G4 P0.1
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G0 X28 Y-19
+G1 X28 Y-12 S1000
+S0
+G4 P0.1
+G0 X28 Y-16
+G1 X30 Y-15 S1000
+G1 X33 Y-16
+G1 X33 Y-19
+S0
+G4 P0.1
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-19
+G0 X35 Y-17
+G1 X40 Y-17 S1000
+G1 X38 Y-14
+G1 X36 Y-14
+G1 X35 Y-16
+G1 X35 Y-19
+G1 X36 Y-19
+G1 X38 Y-19
+G1 X40 Y-19
+S0
+G4 P0.1
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X42 Y-19
+G0 X47 Y-19
+G1 X44 Y-19 S1000
+G1 X42 Y-19
+G1 X42 Y-16
+G1 X44 Y-15
+G1 X47 Y-16
+S0
+G4 P0.1
+G0 X47 Y-12
+G1 X47 Y-19 S1000
+S0
+G4 P0.1
+G0 X49 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X56 Y-19
+G0 X58 Y-19
+G1 X58 Y-15 S1000
+G1 X57 Y-15
+S0
+G4 P0.1
+G0 X58 Y-12
+G1 X58 Y-12 S1000
+S0
+G4 P0.1
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G0 X63 Y-19
+G1 X63 Y-15 S1000
+G1 X63 Y-16
+G1 X65 Y-15
+G1 X68 Y-16
+G1 X68 Y-19
+S0
+G4 P0.1
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X70 Y-19
+G0 X75 Y-19
+G1 X73 Y-19 S1000
+G1 X71 Y-19
+G1 X71 Y-12
+S0
+G4 P0.1
+G0 X70 Y-15
+G1 X73 Y-15 S1000
+S0
+G4 P0.1
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X77 Y-19
+G0 X79 Y-19
+G1 X77 Y-19 S1000
+G1 X77 Y-16
+G1 X79 Y-15
+G1 X82 Y-16
+G1 X82 Y-19
+G1 X79 Y-19
+S0
+G4 P0.1
+G0 X84 Y-19
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X0 Y-31
+G0 X5 Y-31
+G1 X3 Y-31 S1000
+G1 X1 Y-31
+G1 X1 Y-24
+S0
+G4 P0.1
+G0 X0 Y-27
+G1 X3 Y-27 S1000
+S0
+G4 P0.1
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G0 X7 Y-31
+G1 X7 Y-24 S1000
+S0
+G4 P0.1
+G0 X7 Y-28
+G1 X9 Y-27 S1000
+G1 X12 Y-28
+G1 X12 Y-31
+S0
+G4 P0.1
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-31
+G0 X14 Y-29
+G1 X19 Y-29 S1000
+G1 X17 Y-26
+G1 X15 Y-26
+G1 X14 Y-28
+G1 X14 Y-31
+G1 X15 Y-31
+G1 X17 Y-31
+G1 X19 Y-31
+S0
+G4 P0.1
+G0 X21 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G0 X28 Y-31
+G1 X30 Y-31 S1000
+G1 X33 Y-31
+G1 X33 Y-29
+G1 X28 Y-29
+G1 X28 Y-27
+G1 X30 Y-26
+G1 X33 Y-27
+S0
+G4 P0.1
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X35 Y-31
+G0 X37 Y-31
+G1 X37 Y-27 S1000
+G1 X36 Y-27
+S0
+G4 P0.1
+G0 X37 Y-24
+G1 X37 Y-24 S1000
+S0
+G4 P0.1
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X42 Y-31
+G0 X47 Y-31
+G1 X44 Y-31 S1000
+G1 X42 Y-31
+G1 X42 Y-28
+G1 X44 Y-27
+G1 X47 Y-28
+S0
+G4 P0.1
+G0 X47 Y-24
+G1 X47 Y-31 S1000
+S0
+G4 P0.1
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-31
+G0 X49 Y-29
+G1 X54 Y-29 S1000
+G1 X52 Y-26
+G1 X50 Y-26
+G1 X49 Y-28
+G1 X49 Y-31
+G1 X50 Y-31
+G1 X52 Y-31
+G1 X54 Y-31
+S0
+G4 P0.1
+G0 X56 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X63 Y-31
+G0 X65 Y-31
+G1 X63 Y-31 S1000
+G1 X63 Y-28
+G1 X65 Y-27
+G1 X68 Y-28
+G1 X68 Y-31
+G1 X65 Y-31
+S0
+G4 P0.1
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X70 Y-31
+G0 X71 Y-31
+G1 X71 Y-25 S1000
+G1 X73 Y-24
+G1 X75 Y-25
+S0
+G4 P0.1
+G0 X70 Y-28
+G1 X73 Y-28 S1000
+S0
+G4 P0.1
+G0 X77 Y-31
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X0 Y-43
+G0 X5 Y-43
+G1 X3 Y-43 S1000
+G1 X1 Y-43
+G1 X1 Y-36
+S0
+G4 P0.1
+G0 X0 Y-39
+G1 X3 Y-39 S1000
+S0
+G4 P0.1
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G0 X7 Y-43
+G1 X7 Y-36 S1000
+S0
+G4 P0.1
+G0 X7 Y-40
+G1 X9 Y-39 S1000
+G1 X12 Y-40
+G1 X12 Y-43
+S0
+G4 P0.1
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-43
+G0 X14 Y-41
+G1 X19 Y-41 S1000
+G1 X17 Y-38
+G1 X15 Y-38
+G1 X14 Y-40
+G1 X14 Y-43
+G1 X15 Y-43
+G1 X17 Y-43
+G1 X19 Y-43
+S0
+G4 P0.1
+G0 X21 Y-43
+G0 X28 Y-43
+G0 X28 Y-43
+G0 X28 Y-43
+G0 X28 Y-43
+G0 X28 Y-43
+G0 X28 Y-43
+G0 X28 Y-43
+G0 X32 Y-40
+G1 X30 Y-39 S1000
+G1 X28 Y-40
+G1 X28 Y-43
+G1 X30 Y-43
+G1 X32 Y-43
+S0
+G4 P0.1
+G0 X35 Y-43
+G0 X35 Y-43
+G0 X35 Y-43
+G0 X35 Y-43
+G0 X35 Y-43
+G0 X35 Y-43
+G0 X35 Y-43
+G0 X36 Y-43
+G1 X38 Y-43 S1000
+G1 X37 Y-43
+G1 X37 Y-36
+G1 X36 Y-36
+S0
+G4 P0.1
+G0 X42 Y-43
+G0 X42 Y-43
+G0 X42 Y-43
+G0 X42 Y-43
+G0 X42 Y-43
+G0 X42 Y-43
+G0 X42 Y-43
+G0 X44 Y-43
+G1 X44 Y-39 S1000
+G1 X43 Y-39
+S0
+G4 P0.1
+G0 X44 Y-36
+G1 X44 Y-36 S1000
+S0
+G4 P0.1
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X49 Y-43
+G0 X50 Y-43
+G1 X50 Y-37 S1000
+G1 X52 Y-36
+G1 X54 Y-37
+S0
+G4 P0.1
+G0 X49 Y-40
+G1 X52 Y-40 S1000
+S0
+G4 P0.1
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X56 Y-43
+G0 X57 Y-43
+G1 X57 Y-37 S1000
+G1 X59 Y-36
+G1 X61 Y-37
+S0
+G4 P0.1
+G0 X56 Y-40
+G1 X59 Y-40 S1000
+S0
+G4 P0.1
+G0 X63 Y-43
+G0 X0 Y0
@@ -0,0 +1,271 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "jobcache.h"
+#include "packed.h"
+#include "font.h"
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/file.h>
+#else
+#include <windows.h>
+#include <direct.h>
+#include <process.h>
+#include <sys/utime.h>
+#endif
+
+#define JOB_CACHE_STALE_SECONDS 3600   // Temporary files this old were left by a writer that died
+
+static char cacheDir[256] = JOB_CACHE_DIR;
+static int cacheEnabled = 1;
+
+// A cache file found while trimming the cache
+typedef struct {
+    char name[64];
+    long long size;
+    time_t used;
+} CacheFile;
+
+// Function to choose where compiled programs are kept, or to stop keeping them
+void setJobCacheDir(const char *dir) {
+    cacheEnabled = dir != NULL && strcmp(dir, "off") != 0;
+    if (cacheEnabled) {
+        snprintf(cacheDir, sizeof(cacheDir), "%s", dir);
+    }
+}
+
+// Function to carry on a 64-bit FNV-1a hash over more bytes
+static unsigned long long fnvHash(unsigned long long hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Function to carry on a second hash, built differently from FNV so the two do not collide together
+static unsigned long long checkHash(unsigned long long hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash + bytes[i] + 1) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+// Function to work out the key of the program a text would compile to
+void makeJobKey(const char *text, const LayoutOptions *options, JobKey *key) {
+    unsigned long long inputs[2] = {fontDataHash(), hashLayoutOptions(options)};
+    size_t length = strlen(text);
+
+    key->hash = fnvHash(fnvHash(14695981039346656037ULL, inputs, sizeof(inputs)), text, length);
+    key->check = checkHash(checkHash(length, inputs, sizeof(inputs)), text, length);
+}
+
+// Function to build the path of a file in the cache
+static void cachePath(char *path, size_t size, const char *name) {
+    snprintf(path, size, "%s/%s", cacheDir, name);
+}
+
+// Function to store a little-endian integer of the given size
+static void putLittleEndian(unsigned char *out, unsigned long long value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static unsigned long long getLittleEndian(const unsigned char *in, int bytes) {
+    unsigned long long value = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        value = value << 8 | in[i];
+    }
+    return value;
+}
+
+// Function to read a compiled program from the cache; a file that is not what it should be is removed
+int loadCachedJob(const JobKey *key, Arena *arena, GCodeBuffer *program) {
+    char name[64], path[512];
+    PackedHeader header;
+
+    if (!cacheEnabled) {
+        return 0;
+    }
+    snprintf(name, sizeof(name), "%016llx.rwj", key->hash);
+    cachePath(path, sizeof(path), name);
+    FILE *file = fopen(path, "rb");  // Not there is the usual case, so no message
+    if (!file) {
+        return 0;
+    }
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        size = ftell(file);
+        rewind(file);
+    }
+    unsigned char *data = size > JOB_CACHE_HEADER_SIZE ? arenaAlloc(arena, (size_t)size) : NULL;
+    int valid = data && fread(data, 1, (size_t)size, file) == (size_t)size;
+    fclose(file);
+
+    valid = valid && memcmp(data, JOB_CACHE_MAGIC, 4) == 0 && getLittleEndian(data + 4, 4) == JOB_CACHE_VERSION &&
+            getLittleEndian(data + 8, 8) == key->hash && getLittleEndian(data + 16, 8) == key->check;
+    if (valid) {
+        program->length = 0;
+        valid = unpackProgram(data + JOB_CACHE_HEADER_SIZE, (size_t)size - JOB_CACHE_HEADER_SIZE, &header, program) == 0;
+    }
+    if (!valid) {
+        printf("Ignoring damaged cache file %s\n", path);
+        remove(path);
+        program->length = 0;  // Drop anything unpacked before the damage was found
+        program->failed = 0;
+        if (program->data) {
+            program->data[0] = '\0';
+        }
+        return 0;
+    }
+
+    // Touching the file marks it as recently used
+#if defined(__linux__) || defined(__FreeBSD__)
+    utime(path, NULL);
+#else
+    _utime(path, NULL);
+#endif
+    return 1;
+}
+
+// Function to order cache files from the longest unused
+static int compareCacheFiles(const void *a, const void *b) {
+    time_t usedA = ((const CacheFile *)a)->used;
+    time_t usedB = ((const CacheFile *)b)->used;
+    return (usedA > usedB) - (usedA < usedB);
+}
+
+// Function to remove the programs used longest ago until the cache is back under its limit
+static void trimJobCache(void) {
+    char path[512];
+    CacheFile *files = NULL;
+    size_t numFiles = 0, capacity = 0;
+    long long total = 0;
+    time_t now = time(NULL);
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    // One process trims at a time; the others carry on, the cache only has to end up small enough
+    cachePath(path, sizeof(path), ".lock");
+    int lock = open(path, O_RDWR | O_CREAT, 0666);
+    if (lock < 0 || flock(lock, LOCK_EX | LOCK_NB) != 0) {
+        if (lock >= 0) {
+            close(lock);
+        }
+        return;
+    }
+#endif
+
+    DIR *dir = opendir(cacheDir);
+    struct dirent *entry;
+    while (dir && (entry = readdir(dir)) != NULL) {
+        struct stat info;
+        size_t length = strlen(entry->d_name);
+        int program = length > 4 && strcmp(entry->d_name + length - 4, ".rwj") == 0;
+        int temporary = strstr(entry->d_name, ".tmp") != NULL;
+        cachePath(path, sizeof(path), entry->d_name);
+        if ((!program && !temporary) || length >= sizeof(files[0].name) || stat(path, &info) != 0) {
+            continue;
+        }
+        if (temporary) {
+            if (difftime(now, info.st_mtime) > JOB_CACHE_STALE_SECONDS) {
+                remove(path);
+            }
+            continue;
+        }
+        if (numFiles == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            CacheFile *bigger = realloc(files, capacity * sizeof(CacheFile));
+            if (!bigger) {
+                break;
+            }
+            files = bigger;
+        }
+        memcpy(files[numFiles].name, entry->d_name, length + 1);
+        files[numFiles].size = (long long)info.st_size;
+        files[numFiles].used = info.st_mtime;
+        total += files[numFiles].size;
+        numFiles++;
+    }
+    if (dir) {
+        closedir(dir);
+    }
+
+    // Go a little under the limit so the next few programs do not each start a trim
+    if (total > JOB_CACHE_BYTES) {
+        qsort(files, numFiles, sizeof(CacheFile), compareCacheFiles);
+        for (size_t i = 0; i < numFiles && total > JOB_CACHE_BYTES / 10 * 9; i++) {
+            cachePath(path, sizeof(path), files[i].name);
+            if (remove(path) == 0) {
+                total -= files[i].size;
+            }
+        }
+    }
+    free(files);
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    flock(lock, LOCK_UN);
+    close(lock);
+#endif
+}
+
+// Function to keep a compiled program for the next time the same text is drawn
+void storeCachedJob(const JobKey *key, const GCodeBuffer *program, const LayoutOptions *options) {
+    char name[64], path[512], temporary[600];
+    unsigned char header[JOB_CACHE_HEADER_SIZE];
+    PackedHeader info;
+    PackedProgram packed;
+
+    if (!cacheEnabled || program->failed || program->length == 0) {
+        return;
+    }
+#if defined(__linux__) || defined(__FreeBSD__)
+    mkdir(cacheDir, 0777);  // Usually there already
+    long pid = (long)getpid();
+#else
+    _mkdir(cacheDir);
+    long pid = (long)_getpid();
+#endif
+
+    memset(&info, 0, sizeof(info));
+    info.height = options->height;
+    if (packProgram(program->data, program->length, &info, NULL, &packed) != 0) {
+        free(packed.data);
+        return;
+    }
+    memcpy(header, JOB_CACHE_MAGIC, 4);
+    putLittleEndian(header + 4, JOB_CACHE_VERSION, 4);
+    putLittleEndian(header + 8, key->hash, 8);
+    putLittleEndian(header + 16, key->check, 8);
+
+    // Written under a name of its own, then renamed, so other processes never see half a file
+    snprintf(name, sizeof(name), "%016llx.rwj", key->hash);
+    cachePath(path, sizeof(path), name);
+    snprintf(temporary, sizeof(temporary), "%s.tmp%ld", path, pid);
+    FILE *file = fopen(temporary, "wb");
+    int written = file && fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                  fwrite(packed.data, 1, packed.length, file) == packed.length;
+    if (file && fclose(file) != 0) {
+        written = 0;
+    }
+    free(packed.data);
+#if defined(__linux__) || defined(__FreeBSD__)
+    written = written && rename(temporary, path) == 0;
+#else
+    written = written && MoveFileExA(temporary, path, MOVEFILE_REPLACE_EXISTING);
+#endif
+    if (!written) {
+        remove(temporary);
+        return;  // A full disk or a read-only directory only means the next run compiles again
+    }
+    trimJobCache();
+}
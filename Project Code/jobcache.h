@@ -0,0 +1,48 @@
+#include <stdio.h>
+#include <stddef.h>
+#include "arena.h"
+#include "gcode.h"
+
+
+#ifndef JOBCACHE_H_INCLUDED
+#define JOBCACHE_H_INCLUDED
+
+
+#define JOB_CACHE_DIR "jobcache"                // Default cache directory, next to profiles.cfg; --cache <dir|off> changes it
+#define JOB_CACHE_BYTES (256 * 1024 * 1024)     // Oldest programs are removed once the cache holds more than this
+#define JOB_CACHE_MAGIC "RWJC"
+#define JOB_CACHE_VERSION 1
+#define JOB_CACHE_HEADER_SIZE 24
+
+/*
+ Compiled programs are kept on disk so a text drawn again with the same
+ height and profile goes straight to the robot. Each program is one file,
+ <key>.rwj, named by a hash of everything that decides the G-code: the text,
+ the font file and every layout option (height, page, pen, alignment,
+ breaking, hyphenation, kerning). A file is a 24 byte header,
+
+     0   "RWJC"      4   version (u32)
+     8   key (u64)   16  second, independent hash of the same inputs (u64)
+
+ followed by the program in the packed format (see packed.h), whose own
+ checksums are checked when it is read.
+
+ Several processes can share the cache. A program is written to a temporary
+ file and renamed into place, so a reader sees all of it or none of it, and a
+ damaged or half-written file is treated as missing and removed. Reading a
+ program touches its file, and when the cache grows past JOB_CACHE_BYTES the
+ files used longest ago are removed, by one process at a time.
+*/
+
+// What identifies a compiled program
+typedef struct {
+    unsigned long long hash;    // Names the cache file
+    unsigned long long check;   // Stored inside it, to rule out a collision
+} JobKey;
+
+void setJobCacheDir(const char *dir);   // NULL or "off" turns the cache off
+void makeJobKey(const char *text, const LayoutOptions *options, JobKey *key);   // The font must already be loaded
+int loadCachedJob(const JobKey *key, Arena *arena, GCodeBuffer *program);        // 1 if the program was in the cache, 0 if not
+void storeCachedJob(const JobKey *key, const GCodeBuffer *program, const LayoutOptions *options);  // Best effort; failures only cost the next run time
+
+#endif // JOBCACHE_H_INCLUDED
@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "jobqueue.h"
+
+static const char *priorityNames[JOB_PRIORITIES] = {"urgent", "normal", "low"};
+
+// Function to empty a queue, numbering every slot for the first push at its position
+void initJobQueue(JobQueue *queue) {
+    for (int p = 0; p < JOB_PRIORITIES; p++) {
+        JobRing *ring = &queue->rings[p];
+        for (size_t i = 0; i < JOB_QUEUE_SLOTS; i++) {
+            atomic_init(&ring->slots[i].sequence, i);
+            ring->slots[i].job = NULL;
+        }
+        atomic_init(&ring->tail, 0);
+        atomic_init(&ring->head, 0);
+    }
+}
+
+// Function to add a job to the back of a ring
+static int pushRing(JobRing *ring, void *job) {
+    size_t position = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    JobSlot *slot;
+
+    for (;;) {
+        slot = &ring->slots[position & (JOB_QUEUE_SLOTS - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        long long lag = (long long)(sequence - position);
+        if (lag == 0) {
+            // The slot is free; claim the position, or learn where the tail moved to
+            if (atomic_compare_exchange_weak_explicit(&ring->tail, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (lag < 0) {
+            return -1;  // Still holds the job pushed a lap ago, so the ring is full
+        } else {
+            position = atomic_load_explicit(&ring->tail, memory_order_relaxed);  // Another producer got here first
+        }
+    }
+    slot->job = job;
+    atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);  // Publishes the job to consumers
+    return 0;
+}
+
+// Function to take the job at the front of a ring; NULL if it is empty
+static void *popRing(JobRing *ring) {
+    size_t position = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    JobSlot *slot;
+
+    for (;;) {
+        slot = &ring->slots[position & (JOB_QUEUE_SLOTS - 1)];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        long long lag = (long long)(sequence - (position + 1));
+        if (lag == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ring->head, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (lag < 0) {
+            return NULL;  // Nothing pushed at this position yet
+        } else {
+            position = atomic_load_explicit(&ring->head, memory_order_relaxed);  // Another consumer got here first
+        }
+    }
+    void *job = slot->job;
+    atomic_store_explicit(&slot->sequence, position + JOB_QUEUE_SLOTS, memory_order_release);  // Free for the push a lap later
+    return job;
+}
+
+// Function to queue a job at the given priority
+int pushJob(JobQueue *queue, void *job, JobPriority priority) {
+    if ((int)priority < 0 || priority >= JOB_PRIORITIES) {
+        return -1;
+    }
+    return pushRing(&queue->rings[priority], job);
+}
+
+// Function to take the next job, the most urgent first
+void *popJob(JobQueue *queue, JobPriority *priority) {
+    for (int p = 0; p < JOB_PRIORITIES; p++) {
+        void *job = popRing(&queue->rings[p]);
+        if (job) {
+            if (priority) {
+                *priority = (JobPriority)p;
+            }
+            return job;
+        }
+    }
+    return NULL;
+}
+
+// Function to give the name a priority is written with in job files
+const char *priorityName(JobPriority priority) {
+    return (int)priority >= 0 && priority < JOB_PRIORITIES ? priorityNames[priority] : "unknown";
+}
+
+// Function to read a priority from its name
+int parsePriority(const char *name, JobPriority *priority) {
+    for (int p = 0; p < JOB_PRIORITIES; p++) {
+        if (strcmp(name, priorityNames[p]) == 0) {
+            *priority = (JobPriority)p;
+            return 0;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+
+#ifndef JOBQUEUE_H_INCLUDED
+#define JOBQUEUE_H_INCLUDED
+
+
+#define JOB_QUEUE_SLOTS 64          // Jobs each priority can hold; must be a power of two
+#define JOB_QUEUE_LINE 64           // Cache line size, kept between the two ends of a ring
+
+// How soon a job is drawn; lower values go first
+typedef enum {
+    PRIORITY_URGENT,
+    PRIORITY_NORMAL,
+    PRIORITY_LOW,
+    JOB_PRIORITIES
+} JobPriority;
+
+/*
+ Job handles pass from whatever compiles them (the spool directory watcher,
+ later a socket or the command line) to whatever draws them through a bounded
+ queue that any number of threads can push to and pop from at once, without a
+ lock. Each priority has a ring of JOB_QUEUE_SLOTS slots; every slot carries a
+ sequence number saying whether it is free for the next push or holds the job
+ for the next pop, so a producer and a consumer only meet on the one slot they
+ both want, and a thread that loses a race simply tries the next position.
+
+ A pop takes the oldest job of the most urgent priority that has any. Every
+ drawing thread pops from the same queue, so a robot that goes idle takes the
+ next job whichever producer queued it, and none is left waiting behind a busy
+ robot.
+*/
+
+// One place in a ring
+typedef struct {
+    atomic_size_t sequence;     // Position this slot is next pushed at, or that position + 1 once it holds a job
+    void *job;
+} JobSlot;
+
+// Ring of jobs of one priority
+typedef struct {
+    JobSlot slots[JOB_QUEUE_SLOTS];
+    atomic_size_t tail;         // Next position to push at
+    char padding[JOB_QUEUE_LINE - sizeof(atomic_size_t)];  // Producers and consumers do not share a cache line
+    atomic_size_t head;         // Next position to pop from
+} JobRing;
+
+typedef struct {
+    JobRing rings[JOB_PRIORITIES];
+} JobQueue;
+
+void initJobQueue(JobQueue *queue);                             // Empty queue; not safe while other threads use it
+int pushJob(JobQueue *queue, void *job, JobPriority priority);  // 0, or -1 if that priority is full
+void *popJob(JobQueue *queue, JobPriority *priority);           // Most urgent job, or NULL if there is none; priority may be NULL
+const char *priorityName(JobPriority priority);
+int parsePriority(const char *name, JobPriority *priority);     // 0 if the name is urgent, normal or low
+
+#endif // JOBQUEUE_H_INCLUDED
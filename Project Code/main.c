@@ -3,273 +3,391 @@
 #include <string.h>
 #include "rs232.h"
 #include "serial.h"
-
-#define bdrate 115200               /* 115200 baud */
-#define MAX_MOVEMENTS 1000          // Maximum number of movements a character can have
-#define MAX_CHARACTERS 256          // Maximum number of characters in the font
-#define MAX_TEXT_LENGTH 1024        // Maximum length of the input text
-
-// Structure to represent a movement (X, Y coordinates and pen state)
-typedef struct {
-    int x;    // X-coordinate of the movement
-    int y;    // Y-coordinate of the movement
-    int pen;  // Pen state: 0 = pen up, 1 = pen down
-} Movement;
-
-// Structure to represent a character, containing a number of movements
-typedef struct {
-    int num_movements;               // Number of movements for a character
-    Movement movements[MAX_MOVEMENTS];  // Array of movements for a character
-} Character;
-
-// Array to store font data for each character
-Character fontData[MAX_CHARACTERS];
+#include "font.h"
+#include "gcode.h"
+#include "estimate.h"
+#include "spool.h"
+#include "stats.h"
+#include "bench.h"
+#include "golden.h"
+#include "render.h"
+#include "status.h"
+#include "control.h"
+#include "profile.h"
+#include "arena.h"
+#include "packed.h"
+#include "gcodefile.h"
+#include "jobcache.h"
+#include "trace.h"
 
 // Functions used in the code
-void SendCommands(char *buffer);
-FILE *openFile(const char *filename, const char *mode);
-void loadFontData(const char *filename);
-void scaleFontData(float height);
-void processWord(const char *word, int *x_pos, int *y_pos, int *penState, int charWidth, int maxLineWidth, int *lowestY, int lineGap, int minY);
-void generateGCode(const char *text, float height);
-
-// Function to open a file and return its pointer
-FILE *openFile(const char *filename, const char *mode) {
-    FILE *file = fopen(filename, mode);
-    if (!file) {
-        printf("Error opening file: %s\n", filename);
-        exit(1);  // Exit the program if file cannot be opened
+int generateTextFile(const char *textFileName, float height, const Profile *profile, Arena *arena, GCodeBuffer *program);
+int calibrateFromRuns(const char *runsFile, const Profile *profile);
+int parseHeight(const char *text, const Profile *profile, float *height);
+int renderPreview(const char *textFileName, float height, const Profile *profile, const char *outputFile);
+int drawTextJob(const Profile *profile);
+int sendJob(const char *jobName, const GCodeBuffer *program, float feedRate, Arena *arena);
+int packTextFile(const char *textFileName, float height, const Profile *profile, const char *outputFile);
+int replayPackedFile(const char *packedFile);
+int streamGCodeFile(const char *gcodeFile, const Profile *profile);
+
+// Function to read a text file and generate its program in the job's arena; returns 0 on success, otherwise the program is left empty
+int generateTextFile(const char *textFileName, float height, const Profile *profile, Arena *arena, GCodeBuffer *program) {
+    LayoutOptions options;
+    char *text = readTextFile(textFileName);  // Buffer holding the text from the file
+
+    initGCodeBufferInArena(program, arena);
+    if (!text) {
+        return -1;
     }
-    return file;
+    profileLayoutOptions(profile, height, &options);
+
+    // The same text, font and layout always make the same program, so one compiled before is sent as it is
+    JobKey key;
+    makeJobKey(text, &options, &key);
+    if (loadCachedJob(&key, arena, program)) {
+        free(text);
+        printf("Using the program compiled earlier for %s\n", textFileName);
+        return 0;
+    }
+    int result = generateGCode(text, &options, program, 0);  // Generate G-code for the text
+    free(text);
+    if (result != 0) {
+        printf("Error: Unable to generate G-code for %s\n", textFileName);
+        freeGCodeBuffer(program);
+    } else {
+        storeCachedJob(&key, program, &options);
+    }
+    return result;
 }
 
-// Function to load font data from a file
-void loadFontData(const char *filename) {
-    FILE *file = openFile(filename, "r");
-    char line[256];  // Temporary buffer to read each line from the file
-    int currentChar = -1;  // Variable to track the current character being loaded
-    int numMovements = 0;  // Variable to count the movements for the current character
-
-    // Read each line from the file
-    while (fgets(line, sizeof(line), file)) {
-        int x, y, p;  
-
-        // Check if the line indicates a new character
-        if (strncmp(line, "999", 3) == 0) {
-            if (currentChar != -1) {
-                fontData[currentChar].num_movements = numMovements;  // Update movement count for the previous character
-            }
-            sscanf(line, "999 %d %d", &currentChar, &numMovements);  // Extract character ID and number of movements
-        } else {
-            sscanf(line, "%d %d %d", &x, &y, &p);  // Extract movement data (x, y, pen state)
-            fontData[currentChar].movements[numMovements++] = (Movement){x, y, p};  // Store the movement for the current character
+// Function to tune the job time model from a file of "<text file> <height> <seconds>" lines timed on a real robot
+int calibrateFromRuns(const char *runsFile, const Profile *profile) {
+    FILE *file = openFile(runsFile, "r");
+    JobEstimate runs[256];
+    double measured[256];
+    int numRuns = 0;
+    char line[512];
+    EstimatorModel model;
+
+    if (!file) {
+        return 1;
+    }
+    defaultEstimatorModel(&model);
+    loadEstimatorModel(ESTIMATOR_FILE, &model);  // Refine the current model if there is one
+
+    while (numRuns < 256 && fgets(line, sizeof(line), file)) {
+        char textFileName[256];
+        float height;
+        double seconds;
+        GCodeBuffer program;
+        if (line[0] == '#' || sscanf(line, "%255s %f %lf", textFileName, &height, &seconds) != 3) {
+            continue;
         }
+        Arena *arena = createArena();
+        if (!arena || generateTextFile(textFileName, height, profile, arena, &program) != 0) {
+            destroyArena(arena);
+            continue;  // Fit the runs we can still read
+        }
+        estimateProgram(program.data, program.length, &model, arena, &runs[numRuns]);
+        measured[numRuns] = seconds;
+        printf("%s at %.1fmm: predicted %.1fs, measured %.1fs\n", textFileName, height, runs[numRuns].totalTime, seconds);
+        numRuns++;
+        destroyArena(arena);
     }
+    fclose(file);
 
-    // Update movement count for the last character
-    if (currentChar != -1) {
-        fontData[currentChar].num_movements = numMovements;
+    if (calibrateEstimator(runs, measured, numRuns, &model) != 0) {
+        return 1;
     }
-
-    fclose(file);  
+    printf("Fitted motion scale %.3f, pen time %.3fs, line overhead %.4fs\n", model.motionScale, model.penDownTime, model.lineOverhead);
+    return saveEstimatorModel(ESTIMATOR_FILE, &model) == 0 ? 0 : 1;
 }
 
-// Function to scale the font data based on the desired height
-void scaleFontData(float height) {
-    float scaleFactor = height / 18.0f;  // Calculate the scale factor based on the desired height 
-    // Apply scaling factor to all characters and scale their movements
-    for (int i = 0; i < MAX_CHARACTERS; i++) {
-        if (fontData[i].num_movements > 0) {
-            for (int j = 0; j < fontData[i].num_movements; j++) {
-                fontData[i].movements[j].x = (int)((float)fontData[i].movements[j].x * scaleFactor);  // Scale the X coordinate
-                fontData[i].movements[j].y = (int)((float)fontData[i].movements[j].y * scaleFactor);  // Scale the Y coordinate
-            }
-        }
+// Function to read a text height given on the command line; returns -1 unless it is a number the profile's page allows
+int parseHeight(const char *text, const Profile *profile, float *height) {
+    char *end;
+    *height = strtof(text, &end);
+    if (end == text || *end != '\0' || !(*height >= profile->minHeight && *height <= profile->maxHeight)) {
+        printf("Error: Height must be between %g and %gmm.\n", profile->minHeight, profile->maxHeight);
+        return -1;
     }
+    return 0;
 }
 
-// Function to process a word and convert it into G-code for the robot to draw
-void processWord(const char *word, int *x_pos, int *y_pos, int *penState, int charWidth, int maxLineWidth, int *lowestY, int lineGap, int minY) {
-    char buffer[256];  // Temporary buffer to store G-code commands
-    
-    // Calculate the width of the word based on character width
-    int wordWidth = (int)((size_t)strlen(word) * (size_t)charWidth);
-
-    // If the word exceeds the maximum line width, move to the next line
-    if (*x_pos + wordWidth > maxLineWidth) {
-        *y_pos = *lowestY - lineGap;
-        if (*y_pos < minY) {
-            printf("Error: Text exceeds Y-axis limit.\n");
-            exit(1);  // Exit if the text goes beyond the Y-axis limit
-        }
-        *x_pos = 0;
-        *lowestY = *y_pos;
-        sprintf(buffer, "G0 X0 Y%d\n", *y_pos);  // Move to the next line
-        SendCommands(buffer);
-    }
-
-    // Process each character in the word
-    for (int i = 0; word[i] != '\0'; i++) {
-        unsigned char currentChar = (unsigned char)word[i];  // Get the current character
-        if (currentChar >= 32 && currentChar <= 126) {
-            Character charData = fontData[currentChar];  // Get the font data for the current character
-            for (int j = 0; j < charData.num_movements; j++) {
-                Movement m = charData.movements[j];  // Get the movement data for the current character
-                int newX = m.x + *x_pos;  // Calculate the new X coordinate
-                int newY = m.y + *y_pos;  // Calculate the new Y coordinate
-
-                // Update the lowest Y position if necessary
-                if (newY < *lowestY) {
-                    *lowestY = newY;
-                }
-
-                // If the pen state has changed, update the pen
-                if (m.pen != *penState) {
-                    *penState = m.pen;
-                    sprintf(buffer, *penState == 1 ? "S1000\n" : "S0\n");
-                    SendCommands(buffer);
-                }
-
-                // Send the movement command (G1 for pen down, G0 for pen up)
-                sprintf(buffer, *penState == 1 ? "G1 X%d Y%d\n" : "G0 X%d Y%d\n", newX, newY);
-                SendCommands(buffer);
-            }
-            *x_pos += charWidth;  // Move the X position by the character width
-        }
+// Function to draw a text file to an SVG or PNG preview instead of the robot, so jobs can be checked first
+int renderPreview(const char *textFileName, float height, const Profile *profile, const char *outputFile) {
+    GCodeBuffer program;
+    Arena *arena = createArena();
+    if (!arena || generateTextFile(textFileName, height, profile, arena, &program) != 0) {
+        destroyArena(arena);
+        return 1;
     }
-    *x_pos += charWidth;  // Add extra space after the word
+
+    long long start = getMonotonicMicros();
+    int result = renderProgram(program.data, program.length, outputFile);
+    printf("Rendered in %.1fms\n", (double)(getMonotonicMicros() - start) / 1000.0);
+    destroyArena(arena);
+    return result == 0 ? 0 : 1;
 }
 
-// Function to generate G-code from text input
-void generateGCode(const char *text, float height) {
-    scaleFontData(height);  // Scale the font data to match the desired height
-
-    // Initialize variables for G-code generation
-    int x_pos = 0;
-    int y_pos = -(int)height;
-    int penState = 0;  // Pen state: 0 = pen up, 1 = pen down
-    int charWidth = (int)(height * 1.0f);  // Character width based on height
-    int lineGap = (int)(height + 5.0f);  // Line gap between text lines
-    int maxLineWidth = 100;  // Maximum width of a line in the drawing
-    int lowestY = y_pos;  // Variable to track the lowest Y position reached
-    int minY = -90 - (int)height;  // Minimum allowed Y position
-
-    char buffer[256];
-    char word[128];  // Temporary buffer to store a word
-    int wordIndex = 0;
-
-    // Iterate through each character in the input text
-    for (const char *ptr = text; *ptr != '\0'; ptr++) {
-        char c = *ptr;
-
-        // If the current character is a space, newline, or end of the string, process the word
-        if (c == ' ' || c == '\n' || *(ptr + 1) == '\0') {
-            if (*(ptr + 1) == '\0' && c != ' ' && c != '\n') {
-                word[wordIndex++] = c;  // Add last character to the word
-            }
+// Function to ask the operator for a height and text file and draw it on the awake robot; returns 0 if the whole job was drawn
+int drawTextJob(const Profile *profile) {
+    printf("Enter the desired text height (between %g and %gmm): ", profile->minHeight, profile->maxHeight);
+    float height = 0.0f;
+    if (scanf("%f", &height) != 1 || height < profile->minHeight || height > profile->maxHeight) {
+        printf("Error: Height must be between %g and %gmm.\n", profile->minHeight, profile->maxHeight);
+        return 1;  // Exit if height is out of range
+    }
 
-            word[wordIndex] = '\0';  // Null-terminate the word
-            processWord(word, &x_pos, &y_pos, &penState, charWidth, maxLineWidth, &lowestY, lineGap, minY);  // Process the word
-
-            // If a newline is encountered, move to the next line
-            if (c == '\n') {
-                y_pos = lowestY - lineGap;
-                if (y_pos < minY) {
-                    printf("Error: Text exceeds Y-axis limit.\n");
-                    exit(1);  // Exit if the text goes beyond the Y-axis limit
-                }
-                x_pos = 0;
-                lowestY = y_pos;
-                sprintf(buffer, "G0 X0 Y%d\n", y_pos);  // Move to the next line
-                SendCommands(buffer);
-            }
+    // Ask for the text file containing the content to be drawn
+    char textFileName[256];
+    printf("Enter the name of the text file: ");
+    if (scanf("%255s", textFileName) != 1) {
+        return 1;
+    }
 
-            wordIndex = 0;  // Reset word index for the next word
-        } else {
-            word[wordIndex++] = c;  // Add character to the current word
-        }
+    // Everything built for the job lives in its arena and goes in one go at the end
+    GCodeBuffer program;
+    Arena *arena = createArena();
+    if (!arena || generateTextFile(textFileName, height, profile, arena, &program) != 0) {
+        destroyArena(arena);
+        return 1;  // Nothing has been drawn, the pen is still up
     }
 
-    // If the pen is still down, lift it
-    if (penState != 0) {
-        sprintf(buffer, "S0\n");
-        SendCommands(buffer);
+    int result = sendJob(textFileName, &program, profile->feedRate, arena);
+    destroyArena(arena);
+    return result;
+}
+
+// Function to estimate, checkpoint and send a generated program to the awake robot, reporting how the transfer went; returns 0 if all of it was drawn
+int sendJob(const char *jobName, const GCodeBuffer *program, float feedRate, Arena *arena) {
+    EstimatorModel model;
+    JobEstimate estimate;
+    defaultEstimatorModel(&model);
+    loadEstimatorModel(ESTIMATOR_FILE, &model);
+    model.feedRate = feedRate;
+    estimateProgram(program->data, program->length, &model, arena, &estimate);
+    printEstimate(&estimate);
+
+    // Keep a checkpoint next to the job's file so a failed run can carry on
+    char checkpointPath[300];
+    Checkpoint checkpoint;
+    snprintf(checkpointPath, sizeof(checkpointPath), "%s.ckpt", jobName);
+    long savedLine = openCheckpoint(&checkpoint, checkpointPath, program->data, program->length);
+    if (savedLine > 0) {
+        char answer = 'n';
+        printf("A previous run of this job stopped at line %ld. Resume from there? (y/n): ", savedLine);
+        scanf(" %c", &answer);
+        if (answer == 'y' || answer == 'Y') {
+            checkpoint.resumeLine = savedLine;
+        }
     }
 
-    // Return the pen to the origin (0, 0)
-    sprintf(buffer, "G0 X0 Y0\n");
-    SendCommands(buffer);
+    TransportStats stats;
+    startTransportStats(&stats, jobName, stdout);
+    int result = SetFeedRate(feedRate);
+    if (result == 0) {
+        result = SendProgram(program->data, program->length, &checkpoint);  // Draw the text
+    }
+    if (result != 0) {
+        SafeStop();
+        printf("Job stopped after line %ld; run it again to resume from there.\n", checkpoint.ackedLines);
+    }
+    closeCheckpoint(&checkpoint, result == 0);  // Keep the checkpoint unless the job finished
+    stats.jobMemory = (long long)arenaPeakBytes(arena);
+    printTransportSummary(&stats);
+    reportTransportStats(&stats, 1);
+    stopTransportStats(&stats);
+    return result == 0 ? 0 : 1;
 }
 
-// Main function
-int main() {
-    char buffer[256];
+// Function to generate a text file's program and store it packed, so it can be drawn later without the font or layout
+int packTextFile(const char *textFileName, float height, const Profile *profile, const char *outputFile) {
+    GCodeBuffer program;
+    PackedProgram packed;
+    PackedHeader info;
+    Arena *arena = createArena();
+    if (!arena || generateTextFile(textFileName, height, profile, arena, &program) != 0) {
+        destroyArena(arena);
+        return 1;
+    }
 
-    // Check if the COM port can be opened
-    if (CanRS232PortBeOpened() == -1) {
-        printf("\nUnable to open the COM port (specified in serial.h) ");
-        exit(0);  // Exit if COM port cannot be opened
+    memset(&info, 0, sizeof(info));
+    info.height = height;
+    info.feedRate = profile->feedRate;
+    snprintf(info.profile, sizeof(info.profile), "%s", profile->name);
+    int result = packProgram(program.data, program.length, &info, arena, &packed);
+    if (result == 0) {
+        result = writePackedFile(outputFile, &packed);
+    }
+    if (result == 0) {
+        printf("Packed %zu bytes of G-code into %zu bytes (%.1f%%)\n", program.length, packed.length,
+               program.length ? 100.0 * (double)packed.length / (double)program.length : 0.0);
     }
+    destroyArena(arena);
+    return result == 0 ? 0 : 1;
+}
 
-    printf("\nAbout to wake up the robot\n");
+// Function to draw a packed program on the awake robot at the feed rate it was made for
+int replayPackedFile(const char *packedFile) {
+    GCodeBuffer program;
+    PackedHeader header;
+    size_t size = 0;
+    Arena *arena = createArena();
+    unsigned char *data = arena ? readPackedFile(packedFile, arena, &size) : NULL;
 
-    sprintf(buffer, "\n");  // Send wake-up signal
-    PrintBuffer(&buffer[0]);
-    Sleep(100);  
-    WaitForDollar();  // Wait for robot to be ready
+    if (arena) {
+        initGCodeBufferInArena(&program, arena);
+    }
+    if (!data || unpackProgram(data, size, &header, &program) != 0) {
+        destroyArena(arena);
+        return 1;
+    }
+    printf("Replaying %s: %llu lines, %gmm text, profile %s\n", packedFile, header.lines, header.height,
+           header.profile[0] ? header.profile : "(none)");
+    int result = sendJob(packedFile, &program, header.feedRate, arena);
+    destroyArena(arena);
+    return result;
+}
 
-    printf("\nThe robot is now ready to draw\n");
+// Function to draw a G-code file made by another program, sent the same way as a text job
+int streamGCodeFile(const char *gcodeFile, const Profile *profile) {
+    GCodeBuffer program;
+    GCodeFileInfo info;
+    Arena *arena = createArena();
+    if (!arena || loadGCodeFile(gcodeFile, arena, &program, &info) != 0) {
+        destroyArena(arena);
+        return 1;  // Nothing has been sent
+    }
+    int result = sendJob(gcodeFile, &program, profile->feedRate, arena);
+    destroyArena(arena);
+    return result;
+}
 
-    // Initialise the robot for drawing
-    sprintf(buffer, "G1 X0 Y0 F1000\n");
-    SendCommands(buffer);
-    sprintf(buffer, "M3\n");
-    SendCommands(buffer);
-    sprintf(buffer, "S0\n");
-    SendCommands(buffer);
+// Main function
+int main(int argc, char *argv[]) {
+    // --poll <ms> can go before any mode to set how often the robot is asked for its status (0 = never),
+    // --control <path> to take hold/resume/reset commands on a local socket, --profile <name> to pick the page setup,
+    // --port <device|auto> and --baud <rate> to use another serial port than the one in serial.h,
+    // --cache <dir|off> to keep compiled programs somewhere other than jobcache/, or not at all,
+    // --trace <file> to record every line to and from the robot for --trace-report,
+    // and --font <file> to draw with a font file instead of the font built into the program
+    int pollMs = STATUS_POLL_MS;
+    const char *controlPath = NULL;
+    const char *profileName = NULL;
+    const char *portDevice = NULL;
+    const char *traceFile = NULL;
+    const char *fontFile = NULL;
+    int baudrate = 0;
+    while (argc >= 3 && (strcmp(argv[1], "--poll") == 0 || strcmp(argv[1], "--control") == 0 || strcmp(argv[1], "--profile") == 0 ||
+                         strcmp(argv[1], "--port") == 0 || strcmp(argv[1], "--baud") == 0 || strcmp(argv[1], "--cache") == 0 ||
+                         strcmp(argv[1], "--trace") == 0 || strcmp(argv[1], "--font") == 0)) {
+        if (strcmp(argv[1], "--poll") == 0) {
+            pollMs = atoi(argv[2]);
+        } else if (strcmp(argv[1], "--control") == 0) {
+            controlPath = argv[2];
+        } else if (strcmp(argv[1], "--port") == 0) {
+            portDevice = argv[2];
+        } else if (strcmp(argv[1], "--baud") == 0) {
+            baudrate = atoi(argv[2]);
+        } else if (strcmp(argv[1], "--cache") == 0) {
+            setJobCacheDir(argv[2]);
+        } else if (strcmp(argv[1], "--trace") == 0) {
+            traceFile = argv[2];
+        } else if (strcmp(argv[1], "--font") == 0) {
+            fontFile = argv[2];
+        } else {
+            profileName = argv[2];
+        }
+        argv[2] = argv[0];
+        argv += 2;
+        argc -= 2;
+    }
 
-    loadFontData("SingleStrokeFont.txt");  // Load font data from file
+    // Tools that work on files alone, so a broken profiles file or font cannot stop them
+    if (argc == 4 && strcmp(argv[1], "--embed-font") == 0) {
+        return writeFontTable(argv[2], argv[3]) == 0 ? 0 : 1;  // --embed-font <font file> <builtinfont.c>
+    }
+    if ((argc == 3 || argc == 4) && strcmp(argv[1], "--trace-report") == 0) {
+        return analyseTrace(argv[2], argc == 4 ? argv[3] : NULL) == 0 ? 0 : 1;  // --trace-report <trace> [lines.csv]
+    }
 
-    printf("Enter the desired text height (between 4 and 10mm): ");
-    float height;
-    scanf("%f", &height);
-    if (height < 4.0f || height > 10.0f) {
-        printf("Error: Height must be between 4 and 10mm.\n");
-        CloseRS232Port();
-        return 1;  // Exit if height is out of range
+    // Page profiles are read once, before anything is drawn
+    if (loadProfiles(PROFILE_FILE) != 0) {
+        return 1;
+    }
+    const Profile *profile = findProfile(profileName);
+    if (!profile) {
+        return 1;
     }
 
-    // Ask for the text file containing the content to be drawn
-    char textFileName[256];
-    printf("Enter the name of the text file: ");
-    scanf("%s", textFileName);
-
-    // Open the text file
-    FILE *textFile = openFile(textFileName, "r");
-    char text[MAX_TEXT_LENGTH] = {0};  // Buffer to store the text from the file
-    size_t index = 0;
-
-    // Read the text from the file
-    while (fgets(&text[index], (size_t)(sizeof(text) - index), textFile)) {
-        index += strlen(&text[index]);
-        if (index >= sizeof(text) - 1) {
-            break;  // Stop reading if the buffer is full
+    // The built-in font is ready without reading anything; a font file given with --font takes its place.
+    // Programs that are already G-code draw without a font, so a bad --font file does not stop them
+    int drawsGCode = argc == 3 && (strcmp(argv[1], "--gcode") == 0 || strcmp(argv[1], "--replay") == 0);
+    if (!drawsGCode && loadFontData(fontFile) != 0) {
+        return 1;
+    }
+
+    if (argc == 3 && strcmp(argv[1], "--calibrate") == 0) {
+        return calibrateFromRuns(argv[2], profile);
+    }
+    if (argc >= 2 && strcmp(argv[1], "--bench") == 0) {
+        // --bench [baseline.jsonl] [--large]
+        const char *baselineFile = NULL;
+        int large = 0;
+        for (int i = 2; i < argc; i++) {
+            if (strcmp(argv[i], "--large") == 0) {
+                large = 1;
+            } else {
+                baselineFile = argv[i];
+            }
         }
+        return runBenchmarks(baselineFile, large);
+    }
+    if (argc == 3 && strcmp(argv[1], "--golden") == 0) {
+        return runGoldenTests(argv[2]) == 0 ? 0 : 1;  // Check generated programs against the golden ones
+    }
+    if (argc == 3 && strcmp(argv[1], "--golden-record") == 0) {
+        return recordGoldenPrograms(argv[2]) == 0 ? 0 : 1;
+    }
+    if (argc == 5 && strcmp(argv[1], "--render") == 0) {
+        float height;  // --render <text file> <height> <preview.svg|preview.png>
+        return parseHeight(argv[3], profile, &height) == 0 ? renderPreview(argv[2], height, profile, argv[4]) : 1;
+    }
+    if (argc == 5 && strcmp(argv[1], "--pack") == 0) {
+        float height;  // --pack <text file> <height> <job.rwm>
+        return parseHeight(argv[3], profile, &height) == 0 ? packTextFile(argv[2], height, profile, argv[4]) : 1;
     }
 
-    fclose(textFile);  // Close the text file
-    generateGCode(text, height);  // Generate G-code for the text
+    if (traceFile && startTrace(traceFile) != 0) {
+        return 1;
+    }
+    if (SetSerialPort(portDevice, baudrate) != 0 || WakeRobot() != 0) {
+        stopTrace();
+        return 1;  // Exit if COM port cannot be opened
+    }
+
+    // From here on every path goes through the end of main() so the port is always closed
+    int result = 0;
+    startStatusPoller(pollMs);
+    if (startControl(controlPath) != 0) {
+        result = 1;
+    } else if (argc == 3 && strcmp(argv[1], "--gcode") == 0) {
+        result = streamGCodeFile(argv[2], profile);  // Draw an existing G-code file; no font needed
+    } else if (argc == 3 && strcmp(argv[1], "--replay") == 0) {
+        result = replayPackedFile(argv[2]);  // Draw a program packed earlier with --pack
+    } else if (argc == 3 && strcmp(argv[1], "--spool") == 0) {
+        result = runSpoolDaemon(argv[2], profile) == 0 ? 0 : 1;  // Keep drawing jobs from the spool directory
+    } else {
+        result = drawTextJob(profile);
+    }
 
+    stopControl();
+    stopStatusPoller();
     CloseRS232Port();  // Close the COM port
     printf("COM port now closed\n");
+    stopTrace();
 
-    return 0;
-}
-
-// Function to send commands to the robot and wait for a reply
-void SendCommands(char *buffer) {
-    PrintBuffer(buffer);  // Print the buffer to the robot
-    WaitForReply();  
-    Sleep(100);  
+    return result;
 }
-
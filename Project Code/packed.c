@@ -0,0 +1,451 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "packed.h"
+#include "checkpoint.h"
+#include "font.h"
+
+#define PACKED_SMALL 0x08           // Op flag: the move's deltas fit in one byte
+
+// Function to make sure the packed buffer has room for extra bytes; returns -1 and marks it failed if it cannot
+static int reservePacked(PackedProgram *packed, size_t extra) {
+    if (packed->failed) {
+        return -1;
+    }
+    if (packed->length + extra <= packed->capacity) {
+        return 0;
+    }
+    size_t capacity = packed->capacity ? packed->capacity : 4096;
+    while (capacity < packed->length + extra) {
+        capacity *= 2;
+    }
+    unsigned char *data = packed->arena ? arenaResize(packed->arena, packed->data, packed->capacity, capacity)
+                                        : realloc(packed->data, capacity);
+    if (!data) {
+        printf("Error: Out of memory while packing the program.\n");
+        packed->failed = 1;
+        return -1;
+    }
+    packed->data = data;
+    packed->capacity = capacity;
+    return 0;
+}
+
+// Function to append one byte
+static void putByte(PackedProgram *packed, unsigned char byte) {
+    if (reservePacked(packed, 1) == 0) {
+        packed->data[packed->length++] = byte;
+    }
+}
+
+// Function to append an unsigned LEB128 varint
+static void putVarint(PackedProgram *packed, unsigned long long value) {
+    while (value >= 0x80) {
+        putByte(packed, (unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    putByte(packed, (unsigned char)value);
+}
+
+// Function to map a signed value onto an unsigned one so small magnitudes stay small
+static unsigned long long zigzag(long long value) {
+    return ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63);
+}
+
+static long long unzigzag(unsigned long long value) {
+    return (long long)(value >> 1) ^ -(long long)(value & 1);
+}
+
+// Function to store a little-endian integer of the given size
+static void putLittleEndian(unsigned char *out, unsigned long long value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static unsigned long long getLittleEndian(const unsigned char *in, int bytes) {
+    unsigned long long value = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        value = value << 8 | in[i];
+    }
+    return value;
+}
+
+// Function to write the header into the first PACKED_HEADER_SIZE bytes
+static void putHeader(unsigned char *out, const PackedHeader *header) {
+    unsigned int bits;
+    memset(out, 0, PACKED_HEADER_SIZE);
+    memcpy(out, PACKED_MAGIC, 4);
+    putLittleEndian(out + 4, PACKED_VERSION, 2);
+    putLittleEndian(out + 6, PACKED_HEADER_SIZE, 2);
+    memcpy(&bits, &header->height, 4);
+    putLittleEndian(out + 8, bits, 4);
+    memcpy(&bits, &header->feedRate, 4);
+    putLittleEndian(out + 12, bits, 4);
+    putLittleEndian(out + 16, header->payloadLength, 8);
+    memcpy(out + 32, header->profile, strnlen(header->profile, sizeof(header->profile)));
+    putLittleEndian(out + 64, header->lines, 8);
+    putLittleEndian(out + 72, header->payloadHash, 8);
+    putLittleEndian(out + 80, header->programHash, 8);
+}
+
+// Function to print an op back as the G-code line it stands for
+static int formatPackedMove(const PackedMove *move, char *line, size_t size) {
+    switch (move->op) {
+    case PACKED_RAPID:
+    case PACKED_DRAW:
+        return snprintf(line, size, "G%d X%lld Y%lld", move->op == PACKED_DRAW, move->x, move->y);
+    case PACKED_PEN:
+        return snprintf(line, size, "S%llu", move->value);
+    case PACKED_DWELL:
+        return snprintf(line, size, "G4 P%g", (double)move->value / 1000.0);
+    case PACKED_PAUSE:
+        return snprintf(line, size, "M0");
+    case PACKED_FEED:
+        return snprintf(line, size, "F%llu", move->value);
+    case PACKED_TEXT:
+        break;
+    }
+    return snprintf(line, size, "%.*s", (int)move->length, move->text);
+}
+
+// Function to print a move line without going through printf, which is most of the time spent unpacking
+static size_t formatMoveLine(const PackedMove *move, char *line) {
+    long long values[2] = {move->x, move->y};
+    size_t length = 0;
+
+    line[length++] = 'G';
+    line[length++] = move->op == PACKED_DRAW ? '1' : '0';
+    for (int axis = 0; axis < 2; axis++) {
+        char digits[24];
+        int numDigits = 0;
+        unsigned long long magnitude = values[axis] < 0 ? 0ULL - (unsigned long long)values[axis] : (unsigned long long)values[axis];
+        line[length++] = ' ';
+        line[length++] = axis == 0 ? 'X' : 'Y';
+        if (values[axis] < 0) {
+            line[length++] = '-';
+        }
+        do {
+            digits[numDigits++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude > 0);
+        while (numDigits > 0) {
+            line[length++] = digits[--numDigits];
+        }
+    }
+    line[length++] = '\n';
+    return length;
+}
+
+// Function to read an integer written the way %d writes it (no plus, no leading zeros, no "-0"); returns the characters used, 0 if it is not one
+static size_t matchInteger(const char *text, size_t length, long long *value) {
+    size_t i = text[0] == '-' && length > 1 ? 1 : 0;
+    size_t start = i;
+    long long magnitude = 0;
+    while (i < length && i - start < 18 && text[i] >= '0' && text[i] <= '9') {
+        magnitude = magnitude * 10 + (text[i++] - '0');
+    }
+    if (i == start || (text[start] == '0' && (i - start > 1 || start == 1))) {
+        return 0;
+    }
+    *value = start ? -magnitude : magnitude;
+    return i;
+}
+
+// Function to recognise "G0 X<x> Y<y>" and "G1 ..." exactly as they are printed, which is most of any program
+static int matchMoveLine(const char *line, size_t length, PackedMove *move) {
+    size_t used, x, y;
+    long long value[2];
+
+    if (length < 9 || line[0] != 'G' || (line[1] != '0' && line[1] != '1') || memcmp(line + 2, " X", 2) != 0) {
+        return 0;
+    }
+    used = 4;
+    x = matchInteger(line + used, length - used, &value[0]);
+    used += x;
+    if (x == 0 || length - used < 3 || memcmp(line + used, " Y", 2) != 0) {
+        return 0;
+    }
+    used += 2;
+    y = matchInteger(line + used, length - used, &value[1]);
+    if (y == 0 || used + y != length) {
+        return 0;
+    }
+    move->op = line[1] == '1' ? PACKED_DRAW : PACKED_RAPID;
+    move->x = value[0];
+    move->y = value[1];
+    return 1;
+}
+
+// Function to pick the op for one line of G-code; a line that would not print back the same is kept as text
+static void classifyLine(const char *line, size_t length, PackedMove *move) {
+    GCodeWords words;
+    char check[64];
+
+    if (matchMoveLine(line, length, move)) {
+        return;
+    }
+    parseGCodeLine(line, length, &words);
+    move->op = PACKED_TEXT;
+    if ((words.g == 0 || words.g == 1) && words.m == -1 && words.hasX && words.hasY && !words.hasF && !words.hasS && !words.hasP) {
+        move->op = words.g == 1 ? PACKED_DRAW : PACKED_RAPID;
+        move->x = (long long)words.x;
+        move->y = (long long)words.y;
+    } else if (words.g == -1 && words.m == -1 && words.hasS && !words.hasX && !words.hasY && !words.hasF && words.s >= 0.0) {
+        move->op = PACKED_PEN;
+        move->value = (unsigned long long)words.s;
+    } else if (words.g == 4 && words.m == -1 && words.hasP && !words.hasX && !words.hasY && words.p >= 0.0) {
+        move->op = PACKED_DWELL;
+        move->value = (unsigned long long)(words.p * 1000.0 + 0.5);
+    } else if (words.g == -1 && words.m == 0 && !words.hasX && !words.hasY && !words.hasS) {
+        move->op = PACKED_PAUSE;
+    } else if (words.g == -1 && words.m == -1 && words.hasF && !words.hasX && !words.hasY && !words.hasS && words.f >= 0.0) {
+        move->op = PACKED_FEED;
+        move->value = (unsigned long long)words.f;
+    }
+
+    int printed = move->op == PACKED_TEXT ? -1 : formatPackedMove(move, check, sizeof(check));
+    if (printed != (int)length || memcmp(check, line, length) != 0) {
+        move->op = PACKED_TEXT;
+        move->text = line;
+        move->length = length;
+    }
+}
+
+// Function to pack a G-code program; the header's counts and hashes are filled in here
+int packProgram(const char *program, size_t length, const PackedHeader *info, Arena *arena, PackedProgram *out) {
+    PackedHeader header = *info;
+    long long x = 0, y = 0;
+
+    memset(out, 0, sizeof(*out));
+    out->arena = arena;
+    header.lines = 0;
+    if (reservePacked(out, PACKED_HEADER_SIZE + length / 4) != 0) {
+        return -1;
+    }
+    out->length = PACKED_HEADER_SIZE;  // The header goes in once the payload is known
+
+    for (size_t start = 0; start < length; ) {
+        const char *end = memchr(program + start, '\n', length - start);
+        if (!end) {
+            printf("Error: The program does not end with a newline.\n");
+            return -1;
+        }
+        size_t lineLength = (size_t)(end - (program + start));
+        PackedMove move;
+        classifyLine(program + start, lineLength, &move);
+
+        if (move.op == PACKED_RAPID || move.op == PACKED_DRAW) {
+            long long dx = move.x - x, dy = move.y - y;
+            if (dx >= -8 && dx <= 7 && dy >= -8 && dy <= 7) {
+                putByte(out, (unsigned char)(move.op | PACKED_SMALL));
+                putByte(out, (unsigned char)((dx & 0x0F) | (dy & 0x0F) << 4));
+            } else {
+                putByte(out, (unsigned char)move.op);
+                putVarint(out, zigzag(dx));
+                putVarint(out, zigzag(dy));
+            }
+            x = move.x;
+            y = move.y;
+        } else if (move.op == PACKED_TEXT) {
+            putByte(out, PACKED_TEXT);
+            putVarint(out, move.length);
+            if (reservePacked(out, move.length) == 0) {
+                memcpy(out->data + out->length, move.text, move.length);
+                out->length += move.length;
+            }
+        } else {
+            putByte(out, (unsigned char)move.op);
+            if (move.op != PACKED_PAUSE) {
+                putVarint(out, move.value);
+            }
+        }
+        header.lines++;
+        start += lineLength + 1;
+    }
+    if (out->failed) {
+        return -1;
+    }
+
+    header.payloadLength = out->length - PACKED_HEADER_SIZE;
+    header.payloadHash = hashProgram((const char *)out->data + PACKED_HEADER_SIZE, header.payloadLength);
+    header.programHash = hashProgram(program, length);
+    putHeader(out->data, &header);
+    return 0;
+}
+
+// Function to read and check the header of a packed program
+int readPackedHeader(const unsigned char *data, size_t size, PackedHeader *header) {
+    unsigned int bits;
+
+    if (size < PACKED_HEADER_SIZE || memcmp(data, PACKED_MAGIC, 4) != 0) {
+        printf("Error: Not a packed program.\n");
+        return -1;
+    }
+    if (getLittleEndian(data + 4, 2) != PACKED_VERSION || getLittleEndian(data + 6, 2) != PACKED_HEADER_SIZE) {
+        printf("Error: Packed program version %d is not supported.\n", (int)getLittleEndian(data + 4, 2));
+        return -1;
+    }
+    memset(header, 0, sizeof(*header));
+    bits = (unsigned int)getLittleEndian(data + 8, 4);
+    memcpy(&header->height, &bits, 4);
+    bits = (unsigned int)getLittleEndian(data + 12, 4);
+    memcpy(&header->feedRate, &bits, 4);
+    header->payloadLength = getLittleEndian(data + 16, 8);
+    memcpy(header->profile, data + 32, sizeof(header->profile) - 1);
+    header->lines = getLittleEndian(data + 64, 8);
+    header->payloadHash = getLittleEndian(data + 72, 8);
+    header->programHash = getLittleEndian(data + 80, 8);
+
+    if (header->payloadLength != size - PACKED_HEADER_SIZE ||
+        hashProgram((const char *)data + PACKED_HEADER_SIZE, header->payloadLength) != header->payloadHash) {
+        printf("Error: The packed program is damaged (checksum mismatch).\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to start reading the ops after the header
+void startPackedReader(PackedReader *reader, const unsigned char *data, const PackedHeader *header) {
+    reader->data = data + PACKED_HEADER_SIZE;
+    reader->size = (size_t)header->payloadLength;
+    reader->offset = 0;
+    reader->x = 0;
+    reader->y = 0;
+}
+
+// Function to read a varint; returns -1 if it runs off the end
+static int getVarint(PackedReader *reader, unsigned long long *value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (reader->offset >= reader->size) {
+            return -1;
+        }
+        unsigned char byte = reader->data[reader->offset++];
+        *value |= (unsigned long long)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Function to decode the next op in place
+int nextPackedMove(PackedReader *reader, PackedMove *move) {
+    if (reader->offset >= reader->size) {
+        return 0;
+    }
+    unsigned char op = reader->data[reader->offset++];
+    unsigned long long dx, dy, length;
+
+    move->op = (PackedOp)(op & 0x07);
+    switch (move->op) {
+    case PACKED_RAPID:
+    case PACKED_DRAW:
+        if (op & PACKED_SMALL) {
+            if (reader->offset >= reader->size) {
+                return -1;
+            }
+            unsigned char deltas = reader->data[reader->offset++];
+            reader->x += (long long)((deltas & 0x0F) ^ 0x08) - 8;   // Sign-extend each nibble
+            reader->y += (long long)((deltas >> 4) ^ 0x08) - 8;
+        } else {
+            if (getVarint(reader, &dx) != 0 || getVarint(reader, &dy) != 0) {
+                return -1;
+            }
+            reader->x += unzigzag(dx);
+            reader->y += unzigzag(dy);
+        }
+        move->x = reader->x;
+        move->y = reader->y;
+        return 1;
+    case PACKED_PEN:
+    case PACKED_DWELL:
+    case PACKED_FEED:
+        return getVarint(reader, &move->value) == 0 ? 1 : -1;
+    case PACKED_PAUSE:
+        return 1;
+    case PACKED_TEXT:
+        if (getVarint(reader, &length) != 0 || length > reader->size - reader->offset) {
+            return -1;
+        }
+        move->text = (const char *)reader->data + reader->offset;
+        move->length = (size_t)length;
+        reader->offset += (size_t)length;
+        return 1;
+    }
+    return -1;  // Op 7 is not used
+}
+
+// Function to turn a packed program back into G-code, straight from the packed bytes
+int unpackProgram(const unsigned char *data, size_t size, PackedHeader *header, GCodeBuffer *program) {
+    PackedReader reader;
+    PackedMove move;
+    char line[64];
+    int status;
+
+    if (readPackedHeader(data, size, header) != 0) {
+        return -1;
+    }
+    startPackedReader(&reader, data, header);
+    while ((status = nextPackedMove(&reader, &move)) == 1) {
+        if (move.op == PACKED_RAPID || move.op == PACKED_DRAW) {
+            appendGCodeText(program, line, formatMoveLine(&move, line));
+        } else if (move.op == PACKED_TEXT) {
+            appendGCodeText(program, move.text, move.length);
+            appendGCodeText(program, "\n", 1);
+        } else {
+            int length = formatPackedMove(&move, line, sizeof(line) - 1);
+            line[length++] = '\n';
+            appendGCodeText(program, line, (size_t)length);
+        }
+    }
+    if (status != 0 || program->failed) {
+        printf("Error: The packed program is damaged.\n");
+        return -1;
+    }
+    if (hashProgram(program->data, program->length) != header->programHash) {
+        printf("Error: The unpacked program does not match the one that was packed.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to write a packed program to a file
+int writePackedFile(const char *filename, const PackedProgram *packed) {
+    FILE *file = openFile(filename, "wb");
+    if (!file) {
+        return -1;
+    }
+    size_t written = fwrite(packed->data, 1, packed->length, file);
+    if (fclose(file) != 0 || written != packed->length) {
+        printf("Error: Unable to write %s\n", filename);
+        return -1;
+    }
+    return 0;
+}
+
+// Function to read a whole packed program file into the arena
+unsigned char *readPackedFile(const char *filename, Arena *arena, size_t *size) {
+    FILE *file = openFile(filename, "rb");
+    if (!file) {
+        return NULL;
+    }
+    unsigned char *data = NULL;
+    long fileSize = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        fileSize = ftell(file);
+        rewind(file);
+    }
+    if (fileSize >= 0) {
+        data = arenaAlloc(arena, (size_t)fileSize + 1);
+    }
+    if (!data || fread(data, 1, (size_t)fileSize, file) != (size_t)fileSize) {
+        printf("Error: Unable to read %s\n", filename);
+        data = NULL;
+    }
+    fclose(file);
+    *size = (size_t)fileSize;
+    return data;
+}
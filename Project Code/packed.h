@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stddef.h>
+#include "arena.h"
+#include "gcode.h"
+
+
+#ifndef PACKED_H_INCLUDED
+#define PACKED_H_INCLUDED
+
+
+#define PACKED_MAGIC "RWMP"
+#define PACKED_VERSION 1
+#define PACKED_HEADER_SIZE 88
+
+/*
+ A packed program (.rwm) stores a generated G-code program in about a fifth
+ of the space and turns back into exactly the same text. It is an 88 byte
+ little-endian header:
+
+     0   "RWMP"                  32  profile name, NUL padded (32 bytes)
+     4   version (u16)           64  number of lines (u64)
+     6   header size (u16)       72  FNV-1a of the payload (u64)
+     8   text height, mm (f32)   80  FNV-1a of the G-code text (u64), the
+     12  feed rate, mm/min (f32)     same hash checkpoints use
+     16  payload length (u64)
+     24  reserved (u64)
+
+ followed by one op per G-code line. The low three bits of the op byte say
+ what it is:
+
+     0, 1   G0 / G1 X Y. Coordinates are deltas from the previous move. With
+            bit 3 set they are two signed nibbles in the next byte (x low,
+            y high), otherwise two zigzag varints
+     2      S<varint>, the pen
+     3      G4 P<varint milliseconds>
+     4      M0
+     5      F<varint>
+     6      any other line: <varint length> then the text, without its newline
+
+ A line is only packed as an op if the op prints back to the same text, so
+ packing never changes a program.
+*/
+
+// What a packed program was made from
+typedef struct {
+    float height;               // Text height in mm
+    float feedRate;             // Drawing feed rate in mm/min
+    char profile[32];           // Profile the program was laid out with
+    unsigned long long lines;
+    unsigned long long payloadLength;
+    unsigned long long payloadHash;
+    unsigned long long programHash;
+} PackedHeader;
+
+// Growable byte buffer holding a packed program (header first)
+typedef struct {
+    unsigned char *data;
+    size_t length;
+    size_t capacity;
+    int failed;                 // Set if memory ran out
+    Arena *arena;               // Job arena the bytes live in, NULL for the heap
+} PackedProgram;
+
+// Kinds of packed op
+typedef enum {
+    PACKED_RAPID,
+    PACKED_DRAW,
+    PACKED_PEN,
+    PACKED_DWELL,
+    PACKED_PAUSE,
+    PACKED_FEED,
+    PACKED_TEXT
+} PackedOp;
+
+// One decoded op; text points into the packed bytes, nothing is copied
+typedef struct {
+    PackedOp op;
+    long long x, y;             // Absolute position (moves)
+    unsigned long long value;   // S, F or dwell milliseconds
+    const char *text;           // Line text (PACKED_TEXT), not NUL-terminated
+    size_t length;
+} PackedMove;
+
+// Cursor over the payload of a packed program
+typedef struct {
+    const unsigned char *data;
+    size_t size;
+    size_t offset;
+    long long x, y;
+} PackedReader;
+
+int packProgram(const char *program, size_t length, const PackedHeader *info, Arena *arena, PackedProgram *out);  // info supplies height, feed and profile; returns 0 on success
+int readPackedHeader(const unsigned char *data, size_t size, PackedHeader *header);     // Checks the header and payload hash; 0 if valid
+void startPackedReader(PackedReader *reader, const unsigned char *data, const PackedHeader *header);
+int nextPackedMove(PackedReader *reader, PackedMove *move);     // 1 for a move, 0 at the end, -1 if the payload is corrupt
+int unpackProgram(const unsigned char *data, size_t size, PackedHeader *header, GCodeBuffer *program);  // Decode straight into G-code; 0 if it matches the hash
+int writePackedFile(const char *filename, const PackedProgram *packed);
+unsigned char *readPackedFile(const char *filename, Arena *arena, size_t *size);        // NULL on error
+
+#endif // PACKED_H_INCLUDED
@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gcode.h"
+#include "profile.h"
+
+// Profiles read from the file; the built-in default is always first
+static Profile profiles[MAX_PROFILES];
+static int numProfiles = 0;
+
+// Page size and margins as written in the file, turned into layout options once the section is complete
+typedef struct {
+    float pageWidth, pageHeight;
+    float left, right, top, bottom;
+} PageSize;
+
+// Function to fill in the built-in default profile, which matches the original hardcoded layout
+static void defaultProfile(Profile *profile, PageSize *page) {
+    memset(profile, 0, sizeof(*profile));
+    snprintf(profile->name, sizeof(profile->name), "%s", DEFAULT_PROFILE);
+    defaultLayoutOptions(&profile->layout, 0.0f);
+    profile->layout.liftDwell = -1.0f;  // Same as dwell unless lift_dwell is given
+    profile->feedRate = 1000.0f;
+    profile->minHeight = 4.0f;
+    profile->maxHeight = 10.0f;
+    *page = (PageSize){100.0f, 90.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+}
+
+// Function to check a finished section and work out its layout; returns 0 if it is usable
+static int finishProfile(Profile *profile, const PageSize *page) {
+    float width = page->pageWidth - page->left - page->right;
+    float depth = page->pageHeight - page->top - page->bottom;
+
+    if (page->left < 0.0f || page->right < 0.0f || page->top < 0.0f || page->bottom < 0.0f) {
+        printf("Error: Profile %s has a negative margin.\n", profile->name);
+        return -1;
+    }
+    if (width < 1.0f || depth < 0.0f) {
+        printf("Error: Profile %s leaves no room on the page.\n", profile->name);
+        return -1;
+    }
+    if (profile->minHeight <= 0.0f || profile->minHeight > profile->maxHeight || profile->maxHeight > width) {
+        printf("Error: Profile %s has an invalid text height range.\n", profile->name);
+        return -1;
+    }
+    if (profile->layout.liftDwell < 0.0f) {
+        profile->layout.liftDwell = profile->layout.penDwell;
+    }
+    if (profile->feedRate <= 0.0f || profile->layout.penDown <= 0 || profile->layout.charScale <= 0.0f ||
+        profile->layout.lineSpacing < 0) {
+        printf("Error: Profile %s has an invalid feed, pen or spacing value.\n", profile->name);
+        return -1;
+    }
+
+    profile->layout.maxLineWidth = (int)width;
+    profile->layout.pageDepth = (int)depth;
+    profile->layout.leftMargin = (int)page->left;
+    profile->layout.topMargin = (int)page->top;
+    return 0;
+}
+
+// Function to check one of the pen timing values against its range; returns -1 with the range if it is outside
+static int checkPenValue(const char *key, float value, float max, const char *unit) {
+    if (value >= 0.0f && value <= max) {
+        return 0;
+    }
+    printf("Error: %s must be between 0 and %g %s, not %g\n", key, max, unit, value);
+    return -1;
+}
+
+// Function to set one key of a profile; returns 1 if the key is unknown, -1 if the value is out of range
+static int setProfileValue(Profile *profile, PageSize *page, const char *key, float value) {
+    if (strcmp(key, "dwell") == 0 || strcmp(key, "lift_dwell") == 0 || strcmp(key, "pen_drag") == 0) {
+        int drag = strcmp(key, "pen_drag") == 0;
+        if (checkPenValue(key, value, drag ? MAX_PEN_DRAG : MAX_PEN_DWELL, drag ? "mm" : "seconds") != 0) {
+            return -1;
+        }
+    }
+
+    if (strcmp(key, "page_width") == 0) page->pageWidth = value;
+    else if (strcmp(key, "page_height") == 0) page->pageHeight = value;
+    else if (strcmp(key, "left") == 0) page->left = value;
+    else if (strcmp(key, "right") == 0) page->right = value;
+    else if (strcmp(key, "top") == 0) page->top = value;
+    else if (strcmp(key, "bottom") == 0) page->bottom = value;
+    else if (strcmp(key, "spacing") == 0) profile->layout.lineSpacing = (int)value;
+    else if (strcmp(key, "char_width") == 0) profile->layout.charScale = value;
+    else if (strcmp(key, "feed") == 0) profile->feedRate = value;
+    else if (strcmp(key, "pen_down") == 0) profile->layout.penDown = (int)value;
+    else if (strcmp(key, "dwell") == 0) profile->layout.penDwell = value;
+    else if (strcmp(key, "lift_dwell") == 0) profile->layout.liftDwell = value;
+    else if (strcmp(key, "pen_drag") == 0) profile->layout.penDrag = value;
+    else if (strcmp(key, "fold_pen") == 0) profile->layout.foldPen = value != 0.0f;
+    else if (strcmp(key, "min_height") == 0) profile->minHeight = value;
+    else if (strcmp(key, "max_height") == 0) profile->maxHeight = value;
+    else if (strcmp(key, "kerning") == 0) profile->layout.kerning = value != 0.0f;
+    else return 1;
+    return 0;
+}
+
+// Function to set one of the text options given by name (align, breaking, hyphenate); returns 1 if the key is not one of them, -1 if the value is wrong
+int setTextOption(LayoutOptions *options, const char *key, const char *value) {
+    static const char *alignNames[] = {"left", "centre", "right", "justify"};
+    static const char *breakingNames[] = {"greedy", "optimal"};
+
+    if (strcmp(key, "align") == 0) {
+        for (int i = 0; i < (int)(sizeof(alignNames) / sizeof(alignNames[0])); i++) {
+            if (strcmp(value, alignNames[i]) == 0) {
+                options->align = (TextAlign)i;
+                return 0;
+            }
+        }
+        printf("Error: align must be left, centre, right or justify, not %s\n", value);
+        return -1;
+    }
+    if (strcmp(key, "breaking") == 0) {
+        for (int i = 0; i < (int)(sizeof(breakingNames) / sizeof(breakingNames[0])); i++) {
+            if (strcmp(value, breakingNames[i]) == 0) {
+                options->breaking = (LineBreaking)i;
+                return 0;
+            }
+        }
+        printf("Error: breaking must be greedy or optimal, not %s\n", value);
+        return -1;
+    }
+    if (strcmp(key, "hyphenate") == 0) {
+        if (strcmp(value, "0") != 0 && strcmp(value, "1") != 0) {
+            printf("Error: hyphenate must be 0 or 1, not %s\n", value);
+            return -1;
+        }
+        options->hyphenate = value[0] == '1';
+        return 0;
+    }
+    return 1;
+}
+
+// Function to read the profiles file; a missing file just leaves the built-in default
+int loadProfiles(const char *filename) {
+    PageSize page;
+    Profile loaded[MAX_PROFILES];
+    int numLoaded = 1;
+    int defaultSeen = 0;   // The built-in default sits in slot 0 until the file gives one
+    int lineNumber = 0;
+    char line[256];
+
+    defaultProfile(&loaded[0], &page);
+    finishProfile(&loaded[0], &page);
+    memcpy(profiles, loaded, sizeof(Profile));
+    numProfiles = 1;
+
+    FILE *file = filename ? fopen(filename, "r") : NULL;
+    if (!file) {
+        return 0;
+    }
+
+    // Sections are checked as they close, and only a fully valid file replaces the profiles
+    Profile *current = NULL;
+    int result = 0;
+    while (result == 0 && fgets(line, sizeof(line), file)) {
+        char name[64];
+        char key[64];
+        float value;
+        lineNumber++;
+        if (line[0] == '#' || strspn(line, " \t\r\n") == strlen(line)) {
+            continue;
+        }
+
+        if (sscanf(line, " [%63[^]]]", name) == 1) {
+            if (current && finishProfile(current, &page) != 0) {
+                result = -1;
+                break;
+            }
+            if (strlen(name) >= sizeof(loaded[0].name)) {
+                printf("Error: Profile name too long on line %d of %s\n", lineNumber, filename);
+                result = -1;
+                break;
+            }
+            // A [default] section replaces the built-in one, anything else is added
+            int slot = strcmp(name, DEFAULT_PROFILE) == 0 ? 0 : numLoaded;
+            for (int i = defaultSeen ? 0 : 1; i < numLoaded; i++) {
+                if (strcmp(loaded[i].name, name) == 0) {
+                    printf("Error: Profile %s is defined twice in %s\n", name, filename);
+                    result = -1;
+                }
+            }
+            if (slot == MAX_PROFILES) {
+                printf("Error: Too many profiles in %s (at most %d)\n", filename, MAX_PROFILES);
+                result = -1;
+            }
+            if (result != 0) {
+                break;
+            }
+            defaultSeen |= slot == 0;
+            current = &loaded[slot];
+            defaultProfile(current, &page);
+            snprintf(current->name, sizeof(current->name), "%s", name);
+            if (slot == numLoaded) {
+                numLoaded++;
+            }
+            continue;
+        }
+
+        // Alignment and line breaking take words, everything else a number
+        char word[64];
+        int textOption = current && sscanf(line, "%63s %63s", key, word) == 2 ? setTextOption(&current->layout, key, word) : 1;
+        if (textOption != 1) {
+            result = textOption;
+            continue;
+        }
+        int set = current && sscanf(line, "%63s %f", key, &value) == 2 ? setProfileValue(current, &page, key, value) : 1;
+        if (set == 1) {
+            printf("Error: Unable to read line %d of %s: %s", lineNumber, filename, line);
+        }
+        if (set != 0) {
+            result = -1;
+        }
+    }
+    if (result == 0 && current && finishProfile(current, &page) != 0) {
+        result = -1;
+    }
+    fclose(file);
+
+    if (result != 0) {
+        return -1;
+    }
+    memcpy(profiles, loaded, (size_t)numLoaded * sizeof(Profile));
+    numProfiles = numLoaded;
+    return 0;
+}
+
+// Function to look up a profile by name
+const Profile *findProfile(const char *name) {
+    if (numProfiles == 0) {
+        loadProfiles(NULL);  // Nobody loaded the file; the built-in default still works
+    }
+    if (!name) {
+        return &profiles[0];
+    }
+    for (int i = 0; i < numProfiles; i++) {
+        if (strcmp(profiles[i].name, name) == 0) {
+            return &profiles[i];
+        }
+    }
+    printf("Error: There is no profile called %s\n", name);
+    return NULL;
+}
+
+// Function to fill in the layout options for a job drawn at the given height
+void profileLayoutOptions(const Profile *profile, float height, LayoutOptions *options) {
+    *options = profile->layout;
+    options->height = height;
+}
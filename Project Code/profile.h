@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include "gcode.h"
+
+
+#ifndef PROFILE_H_INCLUDED
+#define PROFILE_H_INCLUDED
+
+
+#define PROFILE_FILE "profiles.cfg"     // Optional, read at start-up from the working directory
+#define DEFAULT_PROFILE "default"       // Used when no profile is chosen
+#define MAX_PROFILES 16
+#define MAX_PEN_DWELL 10.0f             // Longest dwell or lift_dwell, in seconds
+#define MAX_PEN_DRAG 10.0f              // Longest pen_drag, in mm
+
+// A named page, pen and speed setup that jobs can pick
+typedef struct {
+    char name[32];
+    LayoutOptions layout;    // Page geometry and pen; the height is filled in per job
+    float feedRate;          // Drawing feed rate in mm/min
+    float minHeight;         // Text heights allowed on this page, in mm
+    float maxHeight;
+} Profile;
+
+/*
+ profiles.cfg holds one [name] section per profile followed by "key value"
+ lines; anything not given keeps the built-in default shown here:
+
+     [default]
+     page_width 100      usable width and height of the page, in mm
+     page_height 90
+     left 0              margins, in mm; lines start left of the page edge and
+     right 0             the first line starts top below it. A new line is only
+     top 0               started while its top is above the bottom margin, so
+     bottom 0            leave room for one line of text below it
+     spacing 5           extra gap between lines, in mm
+     char_width 1.0      character advance as a fraction of the text height
+     feed 1000           drawing feed rate, in mm/min
+     pen_down 1000       spindle value (S) that lowers the pen; S0 lifts it
+     dwell 0             seconds to wait for the pen servo to land after lowering
+     lift_dwell 0        seconds to wait for it to clear the paper after lifting;
+                         the same as dwell if not given. It is left out before
+                         a hop no longer than pen_drag, which a late lift can
+                         only smudge by as much as a drag would
+     pen_drag 0          hops inside a letter up to this many mm are drawn with
+                         the pen down instead of lifting it, 0 to always lift
+                         The dwells may be up to 10 seconds and pen_drag up to
+                         10mm; a negative value is an error
+     fold_pen 0          1 to send each pen change on the move after it, e.g.
+                         "G1 X3 Y5 S1000", one line instead of two; GRBL sets
+                         S before starting the move. Not done when a dwell has
+                         to come between them
+     min_height 4        text heights allowed, in mm
+     max_height 10
+     align left          left, centre, right or justify
+     breaking greedy     greedy fills each line in turn, optimal evens out the
+                         right edge of the whole paragraph
+     hyphenate 0         1 to split words at syllables to fill lines better
+     kerning 0           1 to space letters by their ink and the font's kerning
+                         pairs rather than in fixed cells
+
+ The file is checked as a whole when it is read; any bad line stops the
+ program rather than drawing on the wrong page.
+*/
+
+int loadProfiles(const char *filename);         // 0 if read or missing, -1 if invalid
+const Profile *findProfile(const char *name);   // NULL name gives the default; NULL if there is no such profile
+int setTextOption(LayoutOptions *options, const char *key, const char *value);  // 0 if set, 1 if not a text option, -1 if invalid
+void profileLayoutOptions(const Profile *profile, float height, LayoutOptions *options);
+
+#endif // PROFILE_H_INCLUDED
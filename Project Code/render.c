@@ -0,0 +1,443 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "gcode.h"
+#include "render.h"
+
+#define PAGE_MARGIN 2.0             // Space kept round the drawing inside each page outline in mm
+
+// Palette entries used by the PNG preview
+enum { PIXEL_PAPER, PIXEL_OUTLINE, PIXEL_TRAVEL, PIXEL_INK, PALETTE_SIZE };
+
+// One straight move of the pen, up or down
+typedef struct {
+    float x0, y0, x1, y1;
+    int page;
+    int penDown;
+} RenderSegment;
+
+// Every move of a program plus the area it covers
+typedef struct {
+    RenderSegment *segments;
+    size_t count;
+    size_t capacity;
+    int pages;
+    double minX, maxX, minY, maxY;   // Extent of a single page in program coordinates
+    double pageWidth, pageHeight;    // Size of one page outline in mm
+    int columns, rows;
+    double width, height;            // Size of the whole preview in mm
+} Preview;
+
+// Bits waiting to be written to a deflate stream, least significant first
+typedef struct {
+    unsigned char *data;
+    size_t length;
+    unsigned int bits;
+    int numBits;
+} BitWriter;
+
+// Function to pull every move out of a program; an M0 pause starts a new page
+static int collectSegments(const char *program, size_t length, Preview *preview) {
+    double x = 0.0, y = 0.0;
+    int penDown = 0, page = 0;
+
+    memset(preview, 0, sizeof(*preview));
+    for (size_t offset = 0; offset < length; ) {
+        GCodeWords words;
+        offset += parseGCodeLine(program + offset, length - offset, &words) + 1;
+        if (words.hasS) {
+            penDown = words.s > 0.0;
+        }
+        if (words.m == 0) {
+            page++;
+        }
+
+        double newX = words.hasX ? words.x : x, newY = words.hasY ? words.y : y;
+        if ((words.g == 0 || words.g == 1) && (newX != x || newY != y)) {
+            if (preview->count == preview->capacity) {
+                size_t capacity = preview->capacity ? preview->capacity * 2 : 4096;
+                RenderSegment *bigger = realloc(preview->segments, capacity * sizeof(RenderSegment));
+                if (!bigger) {
+                    printf("Error: Out of memory while rendering.\n");
+                    return -1;
+                }
+                preview->segments = bigger;
+                preview->capacity = capacity;
+            }
+            preview->segments[preview->count++] = (RenderSegment){(float)x, (float)y, (float)newX, (float)newY, page, penDown};
+            preview->minX = fmin(preview->minX, newX);
+            preview->maxX = fmax(preview->maxX, newX);
+            preview->minY = fmin(preview->minY, newY);
+            preview->maxY = fmax(preview->maxY, newY);
+        }
+        x = newX;
+        y = newY;
+    }
+
+    // A trailing pause has nothing after it, so it does not start a page
+    preview->pages = page + 1;
+    if (preview->count > 0 && preview->segments[preview->count - 1].page < page) {
+        preview->pages = page;
+    }
+    preview->pageWidth = preview->maxX - preview->minX + 2.0 * PAGE_MARGIN;
+    preview->pageHeight = preview->maxY - preview->minY + 2.0 * PAGE_MARGIN;
+    preview->columns = preview->pages < RENDER_PAGE_COLUMNS ? preview->pages : RENDER_PAGE_COLUMNS;
+    preview->rows = (preview->pages + preview->columns - 1) / preview->columns;
+    preview->width = preview->columns * preview->pageWidth + (preview->columns - 1) * RENDER_PAGE_GAP;
+    preview->height = preview->rows * preview->pageHeight + (preview->rows - 1) * RENDER_PAGE_GAP;
+    return 0;
+}
+
+// Function to find the top-left corner of a page on the preview, in mm
+static void pageOrigin(const Preview *preview, int page, double *left, double *top) {
+    *left = (page % preview->columns) * (preview->pageWidth + RENDER_PAGE_GAP);
+    *top = (page / preview->columns) * (preview->pageHeight + RENDER_PAGE_GAP);
+}
+
+// Function to map a program position on a page to the preview; G-code Y grows up the page, the preview's grows down it
+static void mapPoint(const Preview *preview, int page, double x, double y, double *px, double *py) {
+    double left, top;
+    pageOrigin(preview, page, &left, &top);
+    *px = left + PAGE_MARGIN + (x - preview->minX);
+    *py = top + PAGE_MARGIN + (preview->maxY - y);
+}
+
+// Function to write the pen-down or pen-up moves as one SVG path, joining moves that follow on from each other
+static void writeSvgPath(FILE *file, const Preview *preview, int penDown, const char *style) {
+    int joined = 0;
+    double lastX = 0.0, lastY = 0.0;
+
+    fprintf(file, "<path %s d=\"", style);
+    for (size_t i = 0; i < preview->count; i++) {
+        const RenderSegment *segment = &preview->segments[i];
+        if (segment->penDown != penDown) {
+            joined = 0;
+            continue;
+        }
+        double x0, y0, x1, y1;
+        mapPoint(preview, segment->page, segment->x0, segment->y0, &x0, &y0);
+        mapPoint(preview, segment->page, segment->x1, segment->y1, &x1, &y1);
+        if (joined && x0 == lastX && y0 == lastY) {
+            fprintf(file, " %.2f %.2f", x1, y1);
+        } else {
+            fprintf(file, "\nM%.2f %.2f L%.2f %.2f", x0, y0, x1, y1);
+        }
+        joined = 1;
+        lastX = x1;
+        lastY = y1;
+    }
+    fprintf(file, "\"/>\n");
+}
+
+// Function to write the preview as an SVG drawing in mm
+static int writeSvg(const Preview *preview, const char *filename) {
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        printf("Error opening file: %s\n", filename);
+        return -1;
+    }
+    setvbuf(file, NULL, _IOFBF, 1 << 16);
+
+    fprintf(file, "<svg xmlns=\"http://www.w3.org/2000/svg\" viewBox=\"%g %g %.2f %.2f\" width=\"%.2fmm\" height=\"%.2fmm\">\n",
+            -RENDER_PAGE_GAP / 2.0, -RENDER_PAGE_GAP / 2.0, preview->width + RENDER_PAGE_GAP, preview->height + RENDER_PAGE_GAP,
+            preview->width + RENDER_PAGE_GAP, preview->height + RENDER_PAGE_GAP);
+    fprintf(file, "<g fill=\"#ffffff\" stroke=\"#c8c8c8\" stroke-width=\"0.3\">\n");
+    for (int page = 0; page < preview->pages; page++) {
+        double left, top;
+        pageOrigin(preview, page, &left, &top);
+        fprintf(file, "<rect x=\"%.2f\" y=\"%.2f\" width=\"%.2f\" height=\"%.2f\"/>\n", left, top, preview->pageWidth, preview->pageHeight);
+    }
+    fprintf(file, "</g>\n");
+    writeSvgPath(file, preview, 0, "fill=\"none\" stroke=\"#f5b26b\" stroke-width=\"0.15\"");
+    writeSvgPath(file, preview, 1, "fill=\"none\" stroke=\"#1a2a6c\" stroke-width=\"0.35\" stroke-linecap=\"round\" stroke-linejoin=\"round\"");
+    fprintf(file, "</svg>\n");
+
+    int failed = ferror(file);
+    fclose(file);
+    return failed ? -1 : 0;
+}
+
+// Function to draw a line of one colour into an indexed image with Bresenham's algorithm
+static void drawLine(unsigned char *pixels, int width, int height, int x0, int y0, int x1, int y1, unsigned char colour) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+
+    for (;;) {
+        if (x0 >= 0 && x0 < width && y0 >= 0 && y0 < height) {
+            pixels[(size_t)y0 * (size_t)width + (size_t)x0] = colour;
+        }
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int twice = 2 * error;
+        if (twice >= dy) {
+            error += dy;
+            x0 += sx;
+        }
+        if (twice <= dx) {
+            error += dx;
+            y0 += sy;
+        }
+    }
+}
+
+// Function to add bits to a deflate stream
+static void putBits(BitWriter *writer, unsigned int value, int count) {
+    writer->bits |= value << writer->numBits;
+    writer->numBits += count;
+    while (writer->numBits >= 8) {
+        writer->data[writer->length++] = (unsigned char)(writer->bits & 0xFF);
+        writer->bits >>= 8;
+        writer->numBits -= 8;
+    }
+}
+
+// Function to add a Huffman code, which deflate stores most significant bit first
+static void putCode(BitWriter *writer, unsigned int code, int length) {
+    unsigned int reversed = 0;
+    for (int i = 0; i < length; i++) {
+        reversed = (reversed << 1) | ((code >> i) & 1u);
+    }
+    putBits(writer, reversed, length);
+}
+
+// Function to add a literal/length symbol using the fixed Huffman table
+static void putSymbol(BitWriter *writer, int symbol) {
+    if (symbol < 144) {
+        putCode(writer, 0x30u + (unsigned int)symbol, 8);
+    } else if (symbol < 256) {
+        putCode(writer, 0x190u + (unsigned int)(symbol - 144), 9);
+    } else if (symbol < 280) {
+        putCode(writer, (unsigned int)(symbol - 256), 7);
+    } else {
+        putCode(writer, 0xC0u + (unsigned int)(symbol - 280), 8);
+    }
+}
+
+// Function to add a copy of the previous byte, repeated 3 to 258 times
+static void putRepeat(BitWriter *writer, size_t length) {
+    static const int base[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const int extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    int code = 28;
+    while (base[code] > (int)length) {
+        code--;
+    }
+    putSymbol(writer, 257 + code);
+    putBits(writer, (unsigned int)((int)length - base[code]), extra[code]);
+    putCode(writer, 0, 5);  // Distance 1
+}
+
+// Function to compress image rows into a zlib stream; runs of one colour, which are most of a page, become back references
+static unsigned char *deflateRows(const unsigned char *raw, size_t length, size_t *compressedLength) {
+    BitWriter writer = {malloc(length + length / 8 + 64), 0, 0u, 0};
+    if (!writer.data) {
+        return NULL;
+    }
+    writer.data[writer.length++] = 0x78;  // zlib header: deflate, 32K window, no dictionary
+    writer.data[writer.length++] = 0x01;
+    putBits(&writer, 1, 1);  // Final block
+    putBits(&writer, 1, 2);  // Fixed Huffman codes
+
+    for (size_t i = 0; i < length; ) {
+        putSymbol(&writer, raw[i++]);
+        for (;;) {
+            size_t run = 0;
+            while (i + run < length && run < 258 && raw[i + run] == raw[i - 1]) {
+                run++;
+            }
+            if (run < 3) {
+                break;
+            }
+            putRepeat(&writer, run);
+            i += run;
+        }
+    }
+    putSymbol(&writer, 256);  // End of block
+    putBits(&writer, 0, 7);   // Flush the last partial byte
+
+    unsigned long a = 1, b = 0;
+    for (size_t i = 0; i < length; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    unsigned long adler = (b << 16) | a;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        writer.data[writer.length++] = (unsigned char)((adler >> shift) & 0xFF);
+    }
+    *compressedLength = writer.length;
+    return writer.data;
+}
+
+// Function to update a PNG chunk CRC
+static unsigned long updateCrc(unsigned long crc, const unsigned char *data, size_t length) {
+    static unsigned long table[256];
+    static int tableReady = 0;
+    if (!tableReady) {
+        for (unsigned long n = 0; n < 256; n++) {
+            unsigned long c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320UL ^ (c >> 1) : c >> 1;
+            }
+            table[n] = c;
+        }
+        tableReady = 1;
+    }
+    for (size_t i = 0; i < length; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+// Function to write a 32-bit big-endian number
+static void putBigEndian(unsigned char *out, unsigned long value) {
+    out[0] = (unsigned char)((value >> 24) & 0xFF);
+    out[1] = (unsigned char)((value >> 16) & 0xFF);
+    out[2] = (unsigned char)((value >> 8) & 0xFF);
+    out[3] = (unsigned char)(value & 0xFF);
+}
+
+// Function to write one PNG chunk
+static void writeChunk(FILE *file, const char *type, const unsigned char *data, size_t length) {
+    unsigned char header[8];
+    putBigEndian(header, (unsigned long)length);
+    memcpy(header + 4, type, 4);
+    unsigned long crc = updateCrc(0xFFFFFFFFUL, header + 4, 4);
+    crc = updateCrc(crc, data, length) ^ 0xFFFFFFFFUL;
+
+    unsigned char trailer[4];
+    putBigEndian(trailer, crc);
+    fwrite(header, 1, 8, file);
+    fwrite(data, 1, length, file);
+    fwrite(trailer, 1, 4, file);
+}
+
+// Function to rasterize the preview and write it as an indexed-colour PNG
+static int writePng(const Preview *preview, const char *filename) {
+    double scale = RENDER_PIXELS_PER_MM;
+    double longest = fmax(preview->width, preview->height) + RENDER_PAGE_GAP;
+    if (longest * scale > RENDER_MAX_PIXELS) {
+        scale = RENDER_MAX_PIXELS / longest;
+    }
+    int width = (int)ceil((preview->width + RENDER_PAGE_GAP) * scale);
+    int height = (int)ceil((preview->height + RENDER_PAGE_GAP) * scale);
+    size_t rowBytes = (size_t)width + 1;  // Each row starts with its filter type
+    unsigned char *raw = calloc((size_t)height, rowBytes);
+    unsigned char *pixels = calloc((size_t)height * (size_t)width, 1);
+    if (!raw || !pixels) {
+        printf("Error: Out of memory while rendering a %dx%d preview.\n", width, height);
+        free(raw);
+        free(pixels);
+        return -1;
+    }
+
+    double offset = RENDER_PAGE_GAP / 2.0;
+    for (int page = 0; page < preview->pages; page++) {
+        double left, top;
+        pageOrigin(preview, page, &left, &top);
+        int x0 = (int)lround((left + offset) * scale), y0 = (int)lround((top + offset) * scale);
+        int x1 = (int)lround((left + offset + preview->pageWidth) * scale), y1 = (int)lround((top + offset + preview->pageHeight) * scale);
+        drawLine(pixels, width, height, x0, y0, x1, y0, PIXEL_OUTLINE);
+        drawLine(pixels, width, height, x1, y0, x1, y1, PIXEL_OUTLINE);
+        drawLine(pixels, width, height, x1, y1, x0, y1, PIXEL_OUTLINE);
+        drawLine(pixels, width, height, x0, y1, x0, y0, PIXEL_OUTLINE);
+    }
+    for (int penDown = 0; penDown <= 1; penDown++) {  // Ink goes on top of travel
+        for (size_t i = 0; i < preview->count; i++) {
+            const RenderSegment *segment = &preview->segments[i];
+            if (segment->penDown != penDown) {
+                continue;
+            }
+            double x0, y0, x1, y1;
+            mapPoint(preview, segment->page, segment->x0, segment->y0, &x0, &y0);
+            mapPoint(preview, segment->page, segment->x1, segment->y1, &x1, &y1);
+            drawLine(pixels, width, height, (int)lround((x0 + offset) * scale), (int)lround((y0 + offset) * scale),
+                     (int)lround((x1 + offset) * scale), (int)lround((y1 + offset) * scale), penDown ? PIXEL_INK : PIXEL_TRAVEL);
+        }
+    }
+    for (int row = 0; row < height; row++) {
+        memcpy(raw + (size_t)row * rowBytes + 1, pixels + (size_t)row * (size_t)width, (size_t)width);
+    }
+    free(pixels);
+
+    size_t compressedLength = 0;
+    unsigned char *compressed = deflateRows(raw, (size_t)height * rowBytes, &compressedLength);
+    free(raw);
+    FILE *file = fopen(filename, "wb");
+    if (!compressed || !file) {
+        printf("Error opening file: %s\n", filename);
+        free(compressed);
+        if (file) {
+            fclose(file);
+        }
+        return -1;
+    }
+
+    static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    static const unsigned char palette[PALETTE_SIZE * 3] = {
+        0xFF, 0xFF, 0xFF,   // Paper
+        0xC8, 0xC8, 0xC8,   // Page outline
+        0xF5, 0xB2, 0x6B,   // Pen-up travel
+        0x1A, 0x2A, 0x6C,   // Ink
+    };
+    unsigned char header[13];
+    putBigEndian(header, (unsigned long)width);
+    putBigEndian(header + 4, (unsigned long)height);
+    header[8] = 8;   // Bits per pixel
+    header[9] = 3;   // Indexed colour
+    header[10] = 0;  // Deflate
+    header[11] = 0;  // Adaptive filtering (every row uses "none")
+    header[12] = 0;  // Not interlaced
+
+    fwrite(signature, 1, sizeof(signature), file);
+    writeChunk(file, "IHDR", header, sizeof(header));
+    writeChunk(file, "PLTE", palette, sizeof(palette));
+    writeChunk(file, "IDAT", compressed, compressedLength);
+    writeChunk(file, "IEND", NULL, 0);
+    free(compressed);
+
+    int failed = ferror(file);
+    fclose(file);
+    return failed ? -1 : 0;
+}
+
+// Function to check whether a file name ends with an extension, ignoring case
+static int hasExtension(const char *filename, const char *extension) {
+    size_t length = strlen(filename), extensionLength = strlen(extension);
+    if (length < extensionLength) {
+        return 0;
+    }
+    for (size_t i = 0; i < extensionLength; i++) {
+        char c = filename[length - extensionLength + i];
+        if (c >= 'A' && c <= 'Z') {
+            c = (char)(c - 'A' + 'a');
+        }
+        if (c != extension[i]) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Function to render a program to an SVG or PNG preview, chosen by the file name
+int renderProgram(const char *program, size_t length, const char *filename) {
+    Preview preview;
+    if (collectSegments(program, length, &preview) != 0) {
+        free(preview.segments);
+        return -1;
+    }
+
+    size_t strokes = 0;
+    for (size_t i = 0; i < preview.count; i++) {
+        strokes += preview.segments[i].penDown != 0;
+    }
+    int result = hasExtension(filename, ".png") ? writePng(&preview, filename) : writeSvg(&preview, filename);
+    if (result == 0) {
+        printf("Preview written to %s: %d page%s, %zu strokes, %zu travel moves\n", filename, preview.pages,
+               preview.pages == 1 ? "" : "s", strokes, preview.count - strokes);
+    }
+    free(preview.segments);
+    return result;
+}
@@ -0,0 +1,23 @@
+#include <stdio.h>
+#include <stddef.h>
+
+
+#ifndef RENDER_H_INCLUDED
+#define RENDER_H_INCLUDED
+
+
+#define RENDER_PAGE_COLUMNS 10      // Pages side by side on the preview before starting a new row
+#define RENDER_PAGE_GAP 10.0        // Space between pages on the preview in mm
+#define RENDER_PIXELS_PER_MM 4.0    // PNG resolution, reduced if the image would be too big
+#define RENDER_MAX_PIXELS 8192      // Longest side of a PNG preview
+
+/*
+ Previews show every page of a program laid out in rows, as the robot would
+ draw them: pen-down strokes in dark blue, pen-up travel in light orange and
+ each sheet outlined in grey. A file name ending in .png gives a bitmap from
+ the built-in rasterizer, anything else gives an SVG.
+*/
+
+int renderProgram(const char *program, size_t length, const char *filename);   // Returns 0 on success
+
+#endif // RENDER_H_INCLUDED
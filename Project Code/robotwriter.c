@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "robotwriter.h"
+#include "arena.h"
+#include "font.h"
+#include "gcode.h"
+#include "profile.h"
+#include "serial.h"
+#include "status.h"
+
+struct RWContext {
+    Font *font;                 // As loaded
+    Font *scaled;               // At the height of the last compile, height 0 if none yet
+    LayoutOptions options;      // The height is filled in per compile
+    float feedRate;
+    float minHeight;            // Text heights the page allows, in mm
+    float maxHeight;
+};
+
+struct RWProgram {
+    Arena *arena;               // Holds the G-code
+    GCodeBuffer gcode;
+    float feedRate;
+};
+
+struct RWRobot {
+    pthread_mutex_t lock;       // Held for the whole of a program
+};
+
+// Profiles are shared by every context, and findProfile() reads the file the first time it is used
+static pthread_mutex_t profileLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Only one robot can be open, as there is only one serial port
+static pthread_mutex_t robotLock = PTHREAD_MUTEX_INITIALIZER;
+static int robotOpen = 0;
+
+// Function to read the profiles the contexts can pick from
+int rwLoadProfiles(const char *filename) {
+    pthread_mutex_lock(&profileLock);
+    int result = loadProfiles(filename);
+    pthread_mutex_unlock(&profileLock);
+    return result;
+}
+
+// Function to make a context with the built-in font and the built-in default profile
+RWContext *rwCreateContext(void) {
+    RWContext *context = calloc(1, sizeof(RWContext));
+    if (context) {
+        context->font = calloc(1, sizeof(Font));
+        context->scaled = calloc(1, sizeof(Font));
+    }
+    if (!context || !context->font || !context->scaled) {
+        printf("Error: Out of memory creating a context\n");
+        rwDestroyContext(context);
+        return NULL;
+    }
+    loadFont(NULL, context->font);  // Unpacked from the program, no file needed
+    defaultLayoutOptions(&context->options, 0.0f);  // The same as the default profile, without reading profiles.cfg
+    context->feedRate = 1000.0f;
+    context->minHeight = 4.0f;
+    context->maxHeight = 10.0f;
+    return context;
+}
+
+void rwDestroyContext(RWContext *context) {
+    if (context) {
+        free(context->font);
+        free(context->scaled);
+        free(context);
+    }
+}
+
+// Function to load a font file for the context to compile with in place of the built-in one
+int rwLoadFont(RWContext *context, const char *filename) {
+    if (loadFont(filename, context->font) != 0) {
+        return -1;
+    }
+    context->scaled->height = 0.0f;  // Scaled again at the next compile
+    return 0;
+}
+
+// Function to take the page, pen, feed and text options of a profile
+int rwUseProfile(RWContext *context, const char *name) {
+    pthread_mutex_lock(&profileLock);
+    const Profile *profile = findProfile(name);
+    if (profile) {
+        profileLayoutOptions(profile, 0.0f, &context->options);
+        context->feedRate = profile->feedRate;
+        context->minHeight = profile->minHeight;
+        context->maxHeight = profile->maxHeight;
+    }
+    pthread_mutex_unlock(&profileLock);
+    return profile ? 0 : -1;
+}
+
+// Function to change one option of the context
+int rwSetOption(RWContext *context, const char *key, const char *value) {
+    int result = setTextOption(&context->options, key, value);
+    if (result != 1) {
+        return result;
+    }
+    if (strcmp(key, "kerning") == 0 && (strcmp(value, "0") == 0 || strcmp(value, "1") == 0)) {
+        context->options.kerning = value[0] == '1';
+        return 0;
+    }
+    if (strcmp(key, "feed") == 0 && atof(value) > 0.0) {
+        context->feedRate = (float)atof(value);
+        return 0;
+    }
+    printf("Error: %s %s is not an option that can be set\n", key, value);
+    return -1;
+}
+
+// Function to compile text into G-code with the context's font and options
+RWProgram *rwCompile(RWContext *context, const char *text, float height) {
+    if (height < context->minHeight || height > context->maxHeight) {
+        printf("Error: Text height must be between %g and %gmm\n", context->minHeight, context->maxHeight);
+        return NULL;
+    }
+
+    RWProgram *program = calloc(1, sizeof(RWProgram));
+    Arena *arena = program ? createArena() : NULL;
+    if (!arena) {
+        printf("Error: Out of memory compiling text\n");
+        free(program);
+        return NULL;
+    }
+    program->arena = arena;
+    program->feedRate = context->feedRate;
+    initGCodeBufferInArena(&program->gcode, arena);
+
+    // Successive jobs at one height, the usual case, scale the font only once
+    if (context->scaled->height != height) {
+        scaleFont(context->font, height, context->scaled);
+    }
+    LayoutOptions options = context->options;
+    options.height = height;
+    if (generateGCodeInFont(text, &options, context->scaled, &program->gcode, 1) != 0) {
+        printf("Error: Out of memory compiling text\n");
+        rwFreeProgram(program);
+        return NULL;
+    }
+    return program;
+}
+
+// Function to give the G-code of a compiled program
+const char *rwProgramText(const RWProgram *program, size_t *length) {
+    if (length) {
+        *length = program->gcode.length;
+    }
+    return program->gcode.data;
+}
+
+void rwFreeProgram(RWProgram *program) {
+    if (program) {
+        destroyArena(program->arena);
+        free(program);
+    }
+}
+
+// Function to open the serial port and wake the robot, once per process
+RWRobot *rwOpenRobot(const char *device, int baudrate) {
+    pthread_mutex_lock(&robotLock);
+    if (robotOpen) {
+        pthread_mutex_unlock(&robotLock);
+        printf("Error: The robot is already open\n");
+        return NULL;
+    }
+    RWRobot *robot = malloc(sizeof(RWRobot));
+    if (!robot) {
+        pthread_mutex_unlock(&robotLock);
+        printf("Error: Out of memory opening the robot\n");
+        return NULL;
+    }
+    if (SetSerialPort(device, baudrate) != 0 || WakeRobot() != 0) {
+        pthread_mutex_unlock(&robotLock);
+        free(robot);
+        return NULL;
+    }
+    pthread_mutex_init(&robot->lock, NULL);
+    startStatusPoller(STATUS_POLL_MS);
+    robotOpen = 1;
+    pthread_mutex_unlock(&robotLock);
+    return robot;
+}
+
+// Function to draw a compiled program, waiting for any other thread's program to finish first
+int rwStream(RWRobot *robot, const RWProgram *program) {
+    pthread_mutex_lock(&robot->lock);
+    int result = SetFeedRate(program->feedRate);
+    if (result == 0) {
+        result = SendProgram(program->gcode.data, program->gcode.length, NULL);
+    }
+    if (result != 0) {
+        SafeStop();  // Leave the pen up for the next program
+    }
+    pthread_mutex_unlock(&robot->lock);
+    return result == 0 ? 0 : -1;
+}
+
+// Function to close the serial port; no thread may still be streaming to the robot
+void rwCloseRobot(RWRobot *robot) {
+    if (!robot) {
+        return;
+    }
+    pthread_mutex_lock(&robotLock);
+    stopStatusPoller();
+    CloseRS232Port();
+    pthread_mutex_destroy(&robot->lock);
+    free(robot);
+    robotOpen = 0;
+    pthread_mutex_unlock(&robotLock);
+}
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stddef.h>
+
+
+#ifndef ROBOTWRITER_H_INCLUDED
+#define ROBOTWRITER_H_INCLUDED
+
+
+typedef struct RWContext RWContext;     // A font, a page setup and the options text is compiled with
+typedef struct RWProgram RWProgram;     // G-code compiled from one text
+typedef struct RWRobot RWRobot;         // An awake robot, kept open for any number of programs
+
+/*
+ The robot writer as a library, for programs that draw many jobs without
+ starting this one for each: build every .c file except main.c into the
+ program and include this header. A service keeps a context and a robot
+ awake, and each job is one compile and one stream:
+
+     RWContext *context = rwCreateContext();
+     RWRobot *robot = rwOpenRobot("auto", 0);
+
+     RWProgram *program = rwCompile(context, "Dear Sam,\nThank you.", 7.5f);
+     if (program) {
+         rwStream(robot, program);
+         rwFreeProgram(program);
+     }
+
+     rwCloseRobot(robot);
+     rwDestroyContext(context);
+
+ A context owns everything a compile works on, so threads compiling in
+ contexts of their own never wait for each other; one context must not be
+ used by two threads at once. A program belongs to nobody once compiled and
+ may be streamed from any thread. A context starts with the font built into
+ the program, which rwLoadFont() can replace with a font file, and with the
+ built-in default profile; rwUseProfile() takes the page, pen and feed of a
+ profile from profiles.cfg, and rwSetOption() changes single options on top.
+
+ There is one serial port, so a process opens one robot. Threads streaming
+ to it take turns a whole program at a time, and rwStream() waits for the
+ robot to finish the program before it returns. Messages go to stdout as
+ they do from the command line; functions return 0 or a handle on success,
+ and -1 or NULL with an "Error:" line printed on failure.
+*/
+
+int rwLoadProfiles(const char *filename);                       // Read a profiles file in place of profiles.cfg; 0 if read or missing
+RWContext *rwCreateContext(void);                               // With the built-in font; NULL if memory ran out
+void rwDestroyContext(RWContext *context);                      // NULL is ignored
+int rwLoadFont(RWContext *context, const char *filename);       // A bad file leaves the context's font as it was
+int rwUseProfile(RWContext *context, const char *name);         // Page, pen, feed and text options of a profile
+int rwSetOption(RWContext *context, const char *key, const char *value);  // align, breaking, hyphenate, kerning or feed
+RWProgram *rwCompile(RWContext *context, const char *text, float height); // NULL if the text cannot be compiled
+const char *rwProgramText(const RWProgram *program, size_t *length);      // The G-code; length may be NULL
+void rwFreeProgram(RWProgram *program);                         // NULL is ignored
+RWRobot *rwOpenRobot(const char *device, int baudrate);         // Device path or "auto", baud rate or 0 for the default; wakes the robot
+int rwStream(RWRobot *robot, const RWProgram *program);         // Draw a program at the feed it was compiled with; -1 if it stopped early
+void rwCloseRobot(RWRobot *robot);                              // NULL is ignored
+
+#endif // ROBOTWRITER_H_INCLUDED
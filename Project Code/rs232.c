@@ -39,11 +39,9 @@
 #define RS232_PORTNR  38
 
 
-int Cport[RS232_PORTNR],
-    error;
+int Cport[RS232_PORTNR];
 
-struct termios new_port_settings,
-           old_port_settings[RS232_PORTNR];
+struct termios old_port_settings[RS232_PORTNR];
 
 char *comports[RS232_PORTNR]= {"/dev/ttyS0","/dev/ttyS1","/dev/ttyS2","/dev/ttyS3","/dev/ttyS4","/dev/ttyS5",
                                "/dev/ttyS6","/dev/ttyS7","/dev/ttyS8","/dev/ttyS9","/dev/ttyS10","/dev/ttyS11",
@@ -55,16 +53,69 @@ char *comports[RS232_PORTNR]= {"/dev/ttyS0","/dev/ttyS1","/dev/ttyS2","/dev/ttyS
                                "/dev/cuaU0","/dev/cuaU1","/dev/cuaU2","/dev/cuaU3"
                               };
 
-int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
+#if defined(__linux__) && defined(TCGETS2)
+
+/* the kernel's termios2, which glibc does not declare; it takes any baud rate */
+struct termios2
 {
-    int baudr,
-        status;
+    tcflag_t c_iflag;
+    tcflag_t c_oflag;
+    tcflag_t c_cflag;
+    tcflag_t c_lflag;
+    cc_t c_line;
+    cc_t c_cc[19];
+    speed_t c_ispeed;
+    speed_t c_ospeed;
+};
+
+#ifndef BOTHER
+#define BOTHER 0010000
+#endif
 
-    if((comport_number>=RS232_PORTNR)||(comport_number<0))
-    {
-        printf("illegal comport number\n");
-        return(1);
-    }
+/* set a baud rate that has no B constant */
+static int RS232_SetCustomBaud(int fd, int baudrate)
+{
+    struct termios2 tio;
+
+    if(ioctl(fd, TCGETS2, &tio) == -1)
+        return(-1);
+
+    tio.c_cflag &= ~CBAUD;
+    tio.c_cflag |= BOTHER;
+    tio.c_ispeed = baudrate;
+    tio.c_ospeed = baudrate;
+
+    return(ioctl(fd, TCSETS2, &tio));
+}
+
+#else
+
+static int RS232_SetCustomBaud(int fd, int baudrate)
+{
+#if defined(__FreeBSD__)
+    /* FreeBSD speeds are plain numbers */
+    struct termios tio;
+
+    if(tcgetattr(fd, &tio) == -1)
+        return(-1);
+
+    cfsetispeed(&tio, baudrate);
+    cfsetospeed(&tio, baudrate);
+
+    return(tcsetattr(fd, TCSANOW, &tio));
+#else
+    (void)fd;
+    (void)baudrate;
+    return(-1);
+#endif
+}
+
+#endif
+
+/* return the termios constant for a baud rate, or 0 if it has none */
+static int RS232_BaudConstant(int baudrate)
+{
+    int baudr;
 
     switch(baudrate)
     {
@@ -159,11 +210,50 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
         baudr = B4000000;
         break;
     default      :
+        baudr = 0;
+        break;
+    }
+
+    return(baudr);
+}
+
+
+int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
+{
+    if((comport_number>=RS232_PORTNR)||(comport_number<0))
+    {
+        printf("illegal comport number\n");
+        return(1);
+    }
+
+    return(RS232_OpenDevice(comport_number, comports[comport_number], baudrate, mode));
+}
+
+
+/* open any device path, keeping it under the given comport number */
+int RS232_OpenDevice(int comport_number, const char *devname, int baudrate, const char *mode)
+{
+    int baudr,
+        status,
+        error;
+
+    struct termios new_port_settings;
+
+    if((comport_number>=RS232_PORTNR)||(comport_number<0))
+    {
+        printf("illegal comport number\n");
+        return(1);
+    }
+
+    if(baudrate <= 0)
+    {
         printf("invalid baudrate\n");
         return(1);
-        break;
     }
 
+    /* rates without a constant are set once the port is open */
+    baudr = RS232_BaudConstant(baudrate);
+
     int cbits=CS8,
         cpar=0,
         ipar=IGNPAR,
@@ -238,7 +328,7 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
     http://man7.org/linux/man-pages/man3/termios.3.html
     */
 
-    Cport[comport_number] = open(comports[comport_number], O_RDWR | O_NOCTTY | O_NDELAY);
+    Cport[comport_number] = open(devname, O_RDWR | O_NOCTTY | O_NDELAY);
     if(Cport[comport_number]==-1)
     {
         perror("unable to open comport ");
@@ -270,10 +360,14 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
     new_port_settings.c_cc[VMIN] = 0;      /* block untill n bytes are received */
     new_port_settings.c_cc[VTIME] = 0;     /* block untill a timer expires (n * 100 mSec.) */
 
-    cfsetispeed(&new_port_settings, baudr);
-    cfsetospeed(&new_port_settings, baudr);
+    cfsetispeed(&new_port_settings, baudr ? baudr : B38400);
+    cfsetospeed(&new_port_settings, baudr ? baudr : B38400);
 
     error = tcsetattr(Cport[comport_number], TCSANOW, &new_port_settings);
+    if((error != -1) && (baudr == 0))
+    {
+        error = RS232_SetCustomBaud(Cport[comport_number], baudrate);
+    }
     if(error==-1)
     {
         tcsetattr(Cport[comport_number], TCSANOW, old_port_settings + comport_number);
@@ -308,6 +402,40 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
 }
 
 
+/* change the baud rate of a port that is already open, leaving DTR alone */
+int RS232_SetBaudrate(int comport_number, int baudrate)
+{
+    struct termios port_settings;
+
+    int baudr = RS232_BaudConstant(baudrate);
+
+    if(baudrate <= 0)
+    {
+        return(1);
+    }
+
+    if(baudr == 0)
+    {
+        return(RS232_SetCustomBaud(Cport[comport_number], baudrate) == -1 ? 1 : 0);
+    }
+
+    if(tcgetattr(Cport[comport_number], &port_settings) == -1)
+    {
+        return(1);
+    }
+
+    cfsetispeed(&port_settings, baudr);
+    cfsetospeed(&port_settings, baudr);
+
+    if(tcsetattr(Cport[comport_number], TCSANOW, &port_settings) == -1)
+    {
+        return(1);
+    }
+
+    return(0);
+}
+
+
 int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 {
     int n;
@@ -326,19 +454,17 @@ int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 
 int RS232_SendByte(int comport_number, unsigned char byte)
 {
-    int n = write(Cport[comport_number], &byte, 1);
-    if(n < 0)
+    int n;
+
+    /* the port is non-blocking: wait for room rather than dropping the byte */
+    while((n = write(Cport[comport_number], &byte, 1)) < 0 && errno == EAGAIN)
     {
-        if(errno == EAGAIN)
-        {
-            return 0;
-        }
-        else
-        {
-            return 1;
-        }
+        usleep(1000);
     }
 
+    if(n < 1)
+        return(1);
+
     return(0);
 }
 
@@ -544,68 +670,46 @@ char *comports[RS232_PORTNR]= {"\\\\.\\COM1",  "\\\\.\\COM2",  "\\\\.\\COM3",  "
                                "\\\\.\\COM13", "\\\\.\\COM14", "\\\\.\\COM15", "\\\\.\\COM16"
                               };
 
-char mode_str[128];
+int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
+{
+    if((comport_number>=RS232_PORTNR)||(comport_number<0))
+    {
+        printf("illegal comport number\n");
+        return(1);
+    }
 
+    return(RS232_OpenDevice(comport_number, comports[comport_number], baudrate, mode));
+}
 
-int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
+
+/* open any device name ("COM21" or "\\.\COM21"), keeping it under the given comport number */
+int RS232_OpenDevice(int comport_number, const char *devname, int baudrate, const char *mode)
 {
+    char devpath[64],
+         mode_str[128];
+
     if((comport_number>=RS232_PORTNR)||(comport_number<0))
     {
         printf("illegal comport number\n");
         return(1);
     }
 
-    switch(baudrate)
+    /* any rate the driver supports, not just the standard ones */
+    if(baudrate <= 0)
     {
-    case     110 :
-        strcpy(mode_str, "baud=110");
-        break;
-    case     300 :
-        strcpy(mode_str, "baud=300");
-        break;
-    case     600 :
-        strcpy(mode_str, "baud=600");
-        break;
-    case    1200 :
-        strcpy(mode_str, "baud=1200");
-        break;
-    case    2400 :
-        strcpy(mode_str, "baud=2400");
-        break;
-    case    4800 :
-        strcpy(mode_str, "baud=4800");
-        break;
-    case    9600 :
-        strcpy(mode_str, "baud=9600");
-        break;
-    case   19200 :
-        strcpy(mode_str, "baud=19200");
-        break;
-    case   38400 :
-        strcpy(mode_str, "baud=38400");
-        break;
-    case   57600 :
-        strcpy(mode_str, "baud=57600");
-        break;
-    case  115200 :
-        strcpy(mode_str, "baud=115200");
-        break;
-    case  128000 :
-        strcpy(mode_str, "baud=128000");
-        break;
-    case  256000 :
-        strcpy(mode_str, "baud=256000");
-        break;
-    case  500000 :
-        strcpy(mode_str, "baud=500000");
-        break;
-    case 1000000 :
-        strcpy(mode_str, "baud=1000000");
-        break;
-    default      :
         printf("invalid baudrate\n");
         return(1);
-        break;
+    }
+    sprintf(mode_str, "baud=%d", baudrate);
+
+    /* COM10 and up only open with the \\.\ prefix */
+    if(strncmp(devname, "\\\\.\\", 4) == 0)
+    {
+        snprintf(devpath, sizeof(devpath), "%s", devname);
+    }
+    else
+    {
+        snprintf(devpath, sizeof(devpath), "\\\\.\\%s", devname);
     }
 
     if(strlen(mode) != 3)
@@ -676,7 +780,7 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
     http://technet.microsoft.com/en-us/library/cc732236.aspx
     */
 
-    Cport[comport_number] = CreateFileA(comports[comport_number],
+    Cport[comport_number] = CreateFileA(devpath,
                                         GENERIC_READ|GENERIC_WRITE,
                                         0,                          /* no share  */
                                         NULL,                       /* no security */
@@ -727,6 +831,29 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
 }
 
 
+/* change the baud rate of a port that is already open */
+int RS232_SetBaudrate(int comport_number, int baudrate)
+{
+    DCB port_settings;
+    memset(&port_settings, 0, sizeof(port_settings));
+    port_settings.DCBlength = sizeof(port_settings);
+
+    if((baudrate <= 0) || !GetCommState(Cport[comport_number], &port_settings))
+    {
+        return(1);
+    }
+
+    port_settings.BaudRate = baudrate;
+
+    if(!SetCommState(Cport[comport_number], &port_settings))
+    {
+        return(1);
+    }
+
+    return(0);
+}
+
+
 int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 {
     int n;
@@ -744,9 +871,10 @@ int RS232_SendByte(int comport_number, unsigned char byte)
 {
     int n;
 
-    WriteFile(Cport[comport_number], &byte, 1, (LPDWORD)((void *)&n), NULL);
+    if(!WriteFile(Cport[comport_number], &byte, 1, (LPDWORD)((void *)&n), NULL))
+        return(1);
 
-    if(n<0)
+    if(n<1)
         return(1);
 
     return(0);
@@ -863,10 +991,15 @@ void RS232_flushRXTX(int comport_number)
 #endif
 
 
-void RS232_cputs(int comport_number, const char *text)  /* sends a string to serial port */
+int RS232_cputs(int comport_number, const char *text)  /* sends a string to serial port, returns -1 if a byte could not be sent */
 {
     while(*text != 0)
-        RS232_SendByte(comport_number, *(text++));
+    {
+        if(RS232_SendByte(comport_number, *(text++)))
+            return(-1);
+    }
+
+    return(0);
 }
 
 
@@ -61,11 +61,13 @@ extern "C" {
 #endif
 
 int RS232_OpenComport(int, int, const char *);
+int RS232_OpenDevice(int, const char *, int, const char *);
+int RS232_SetBaudrate(int, int);
 int RS232_PollComport(int, unsigned char *, int);
 int RS232_SendByte(int, unsigned char);
 int RS232_SendBuf(int, unsigned char *, int);
 void RS232_CloseComport(int);
-void RS232_cputs(int, const char *);
+int RS232_cputs(int, const char *);
 int RS232_IsDCDEnabled(int);
 int RS232_IsCTSEnabled(int);
 int RS232_IsDSREnabled(int);
@@ -1,19 +1,67 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #include "serial.h"
 #include "rs232.h"
+#include "stats.h"
+#include "status.h"
+#include "control.h"
+#include "discover.h"
+#include "trace.h"
 
 
 //#define Serial_Mode
 
 #ifdef Serial_Mode
 
+// The port in use: the table entry from serial.h unless SetSerialPort() chose another
+static int portNumber = cport_nr;
+static int portBaudrate = bdrate;
+static char portDevice[64] = "";         // Device path, empty for the table entry
+static int portAlreadyOpen = 0;         // Left open by the search for the robot
+
+// Choose the serial device and baud rate before WakeRobot(); "auto" searches every likely device
+int SetSerialPort (const char *device, int baudrate)
+{
+    if (baudrate < 0)
+    {
+        printf("Error: Invalid baud rate %d\n", baudrate);
+        return (-1);
+    }
+
+    if ( (device != NULL) && (strcmp(device, "auto") == 0) )
+    {
+        if (discoverRobot(baudrate, &portNumber, portDevice, sizeof(portDevice), &portBaudrate) != 0)
+            return (-1);
+        portAlreadyOpen = 1;
+        return (0);
+    }
+
+    if (baudrate > 0)
+        portBaudrate = baudrate;
+
+    if (device != NULL)
+    {
+        if (strlen(device) >= sizeof(portDevice))
+        {
+            printf("Error: Serial device name is too long: %s\n", device);
+            return (-1);
+        }
+        strcpy(portDevice, device);
+    }
+    return (0);
+}
+
 // Open port with checking
 int CanRS232PortBeOpened ( void )
 {
     char mode[]= {'8','N','1',0};
-    if(RS232_OpenComport(cport_nr, bdrate, mode))
+
+    if (portAlreadyOpen)
+        return (0);
+
+    if( (portDevice[0] != 0) ? RS232_OpenDevice(portNumber, portDevice, portBaudrate, mode) : RS232_OpenComport(portNumber, portBaudrate, mode) )
     {
         printf("Can not open comport\n");
 
@@ -25,20 +73,43 @@ int CanRS232PortBeOpened ( void )
 // Function to close the COM port
 void CloseRS232Port (void)
 {
-    RS232_CloseComport(cport_nr);
+    RS232_CloseComport(portNumber);
+    portAlreadyOpen = 0;
 }
 
 // Write text out via the serial port
 int PrintBuffer (char *buffer)
 {
-    RS232_cputs(cport_nr, buffer);
-    printf("sent: %s\n", buffer);
+    traceEvent(TRACE_TX, buffer, strlen(buffer));
+    if (RS232_cputs(portNumber, buffer) != 0)
+    {
+        printf("Error: Unable to write to the COM port\n");
+        return (-1);
+    }
+    if (!tracing())
+        printf("sent: %s\n", buffer);   /* the trace has it, without holding up the line */
 
     return (0);
 
 }
 
 
+// Record each line of a chunk read straight from the port in the trace
+static void TraceChunk (const unsigned char *buf, int n)
+{
+    int start = 0, i;
+
+    for(i=0; i <= n; i++)
+    {
+        if ( (i == n) || (buf[i] == '\n') || (buf[i] == '\r') )
+        {
+            if (i > start)
+                traceEvent(TRACE_RX, (const char *)buf + start, (size_t)(i - start));
+            start = i + 1;
+        }
+    }
+}
+
 int WaitForDollar (void)
 {
 
@@ -50,12 +121,13 @@ int WaitForDollar (void)
     while(1)
     {
         printf (".");
-        n = RS232_PollComport(cport_nr, buf, 4095);
+        n = RS232_PollComport(portNumber, buf, 4095);
 
         if(n > 0)
         {
             printf ("RCVD: N = %d ", n);
             buf[n] = 0;   /* always put a "null" at the end of a string! */
+            TraceChunk(buf, n);
 
             for(i=0; i < n; i++)
             {
@@ -84,40 +156,190 @@ int WaitForDollar (void)
 }
 
 
+#define RESET_BANNER_MS 2000    // How long a reset may take to announce itself
+#define ALARM_BANNER_MS 500     // How long after an alarm to wait for the banner of the reset that caused it
+
+// Buffer collecting what the robot sends until a whole line has arrived
+static char replyBuffer[4096];
+static int replyLength = 0;
+
+// Set when the robot announces itself again, i.e. it has been reset and dropped everything queued
+static int controllerReset = 0;
+
+// Take the next complete line the robot has sent, without its line ending; returns 0 if there is none yet
+static int TakeReplyLine (char *line, int size)
+{
+    int i;
+
+    for(i=0; i < replyLength; i++)
+    {
+        if(replyBuffer[i] == '\n')
+        {
+            int n = i < size - 1 ? i : size - 1;
+            memcpy(line, replyBuffer, n);
+            line[n] = 0;
+            if ( (n > 0) && (line[n - 1] == '\r') )
+                line[n - 1] = 0;
+
+            memmove(replyBuffer, replyBuffer + i + 1, replyLength - i - 1);
+            replyLength -= i + 1;
+            return 1;
+        }
+    }
+
+    if (replyLength == (int)sizeof(replyBuffer) - 1)
+        replyLength = 0;   /* no line ending in a full buffer: drop the noise */
+
+    return 0;
+}
+
+// Whoever waits for a reply reads the port; the rest of the time the status poller does, so reports never pile up
+static pthread_mutex_t replyLock = PTHREAD_MUTEX_INITIALIZER;
+static int replyWanted = 0;
+static volatile int idleReset = 0;      // The banner arrived while nothing was being sent
+
+// Take the incoming lines for a command's reply, or hand them back to the poller
+static void ClaimReplies (int claim)
+{
+    pthread_mutex_lock(&replyLock);
+    replyWanted = claim;
+    pthread_mutex_unlock(&replyLock);
+}
+
+// Read what the robot sent while no command is waiting for a reply, keeping the machine state live
+int DrainReplies (void)
+{
+    char line[256];
+    int n;
+
+    pthread_mutex_lock(&replyLock);
+    while (!replyWanted)
+    {
+        while (TakeReplyLine(line, sizeof(line)))
+        {
+            traceEvent(TRACE_RX, line, strlen(line));
+            if (line[0] == '<')
+                updateMachineStatus(line);
+            else if (strncmp(line, "Grbl", 4) == 0)
+            {
+                printf("\nThe robot was reset while idle\n");
+                forgetMachineState();
+                idleReset = 1;
+            }
+        }
+        n = RS232_PollComport(portNumber, (unsigned char *)replyBuffer + replyLength, (int)sizeof(replyBuffer) - 1 - replyLength);
+        if (n <= 0)
+            break;
+        replyLength += n;
+    }
+    pthread_mutex_unlock(&replyLock);
+    return (0);
+}
+
+
+// Read what the robot sends until its start-up banner arrives or the time runs out; returns 1 if it came
+static int ReadUntilBanner (int timeoutMs)
+{
+    char line[256];
+    int waited, n;
+
+    for (waited = 0; !controllerReset && waited < timeoutMs; waited += 20)
+    {
+        while (TakeReplyLine(line, sizeof(line)))
+        {
+            traceEvent(TRACE_RX, line, strlen(line));
+            if (strncmp(line, "Grbl", 4) == 0)
+            {
+                controllerReset = 1;
+                forgetMachineState();   /* the alarm reported before the reset lasts only until $X */
+            }
+            else if (line[0] == '<')
+                updateMachineStatus(line);
+        }
+        n = RS232_PollComport(portNumber, (unsigned char *)replyBuffer + replyLength, (int)sizeof(replyBuffer) - 1 - replyLength);
+        if (n > 0)
+            replyLength += n;
+        else
+            Sleep(20);
+    }
+    return controllerReset;
+}
+
+
 int WaitForReply (void)
 {
 
 
-    int i, n;
+    int n, warned = 0;
 
-    unsigned char buf[4096];
+    char line[256];
+
+    MachineStatus status;
+    getMachineStatus(&status);
+    long sentReports = status.reports;
 
     while(1)
     {
-        printf (".");
-        n = RS232_PollComport(cport_nr, buf, 4095);
-
-        if(n > 0)
+        // Status reports from the poller arrive mixed in with the replies
+        while (TakeReplyLine(line, sizeof(line)))
         {
-            printf ("RCVD: N = %d ", n);
-            buf[n] = 0;   /* always put a "null" at the end of a string! */
+            traceEvent(TRACE_RX, line, strlen(line));
+            if (line[0] == '<')
+            {
+                updateMachineStatus(line);
+                continue;
+            }
 
-            for(i=0; i < n; i++)
+            if (!tracing())
+                printf("received: %s\n", line);
+
+            if ( (line[0] == 'o') && (line[1] == 'k') )
+                return 0;
+
+            // The start-up banner: whatever we were waiting for was lost in a reset
+            if (strncmp(line, "Grbl", 4) == 0)
             {
-                if(buf[i] < 32)  /* replace unreadable control-codes by dots */
-                {
-                    buf[i] = '.';
-                }
+                controllerReset = 1;
+                forgetMachineState();
+                return -1;
             }
 
-            printf("received %i bytes: %s\n", n, (char *)buf);
+            // GRBL rejected the line
+            if (strncmp(line, "error", 5) == 0)
+                return -1;
 
+            // A reset mid-move sends ALARM:3 just before the banner; any other alarm locks GRBL until someone clears it
+            if (strncmp(line, "ALARM", 5) == 0)
+            {
+                if (!ReadUntilBanner(ALARM_BANNER_MS))
+                    printf("\nThe robot raised %s and needs the operator to clear it\n", line);
+                return -1;
+            }
+        }
 
-            if ( (buf[0] == 'o') && (buf[1] == 'k') )
-                return 0;
+        n = RS232_PollComport(portNumber, (unsigned char *)replyBuffer + replyLength, (int)sizeof(replyBuffer) - 1 - replyLength);
+
+        if(n > 0)
+        {
+            replyLength += n;
+            continue;
         }
 
+        // Only a report asked for after the line went out counts: the first one may have been answered
+        // before GRBL read the line, which is always so for the $X that clears the alarm
+        getMachineStatus(&status);
+        if ( (status.state == MACHINE_ALARM) && (status.reports >= sentReports + 2) )
+        {
+            printf("\nThe robot reports an alarm\n");
+            return -1;
+        }
+        if (!warned && machineStalled(&status, getMonotonicMicros()))
+        {
+            printf("\nWarning: The robot is running but has not moved for %d seconds\n", STATUS_STALL_MS / 1000);
+            warned = 1;
+        }
 
+        printf (".");
         Sleep(100);
 
     }
@@ -126,11 +348,38 @@ int WaitForReply (void)
 
 }
 
+// Send one of GRBL's real-time command bytes, which skip the receive buffer
+int SendRealtimeByte (char command)
+{
+    traceEvent(TRACE_REALTIME, &command, 1);
+    return RS232_SendByte(portNumber, (unsigned char)command) ? -1 : 0;
+}
+
+// Wait for the start-up banner after a reset, unless WaitForReply() has already seen it; gives up after two seconds
+static int WaitForResetBanner (void)
+{
+    if (!ReadUntilBanner(RESET_BANNER_MS))
+    {
+        printf("Error: The robot did not come back after the reset\n");
+        return (-1);
+    }
+    controllerReset = 0;
+    return (0);
+}
+
 // Error was here - this should be 'ELSE' not 'ELSEIF'
 
 #else
 
 
+// Without a robot there is no port to choose
+int SetSerialPort (const char *device, int baudrate)
+{
+    (void)device;
+    (void)baudrate;
+    return (0);
+}
+
 // Open port with checking
 int CanRS232PortBeOpened ( void )
 {
@@ -146,6 +395,7 @@ void CloseRS232Port (void)
 // JIB: you MUST specify variable types in function definitions
 int PrintBuffer (char *buffer)
 {
+    traceEvent(TRACE_TX, buffer, strlen(buffer));
     printf("%s \n",buffer);
     return (0);
 }
@@ -155,6 +405,7 @@ int WaitForReply (void)
 {
     char c;
     c = getchar();
+    traceEvent(TRACE_RX, "ok", 2);   /* Enter stands in for the robot's ok */
     return (0);
 }
 
@@ -162,6 +413,34 @@ int WaitForDollar (void)
 {
     char c;
     c = getchar();
+    traceEvent(TRACE_RX, "ok", 2);
+    return (0);
+}
+
+// There is no robot to send real-time commands to
+int SendRealtimeByte (char command)
+{
+    (void)command;
+    return (0);
+}
+
+// Nothing to wait for without a robot
+static int controllerReset = 0;
+static volatile int idleReset = 0;
+
+static void ClaimReplies (int claim)
+{
+    (void)claim;
+}
+
+int DrainReplies (void)
+{
+    return (0);
+}
+
+static int WaitForResetBanner (void)
+{
+    controllerReset = 0;
     return (0);
 }
 
@@ -169,5 +448,246 @@ int WaitForDollar (void)
 #endif // SM
 
 
+// Feed rate the robot was last given, so jobs only send one when it changes
+static float robotFeed = 1000.0f;
+
+// Function to check the port, wake the robot up and put it into drawing mode
+int WakeRobot (void)
+{
+    char buffer[256];
+
+    // Check if the COM port can be opened
+    if (CanRS232PortBeOpened() == -1)
+    {
+        printf("\nUnable to open the COM port (specified in serial.h or with --port) ");
+        return (-1);
+    }
+
+    printf("\nAbout to wake up the robot\n");
+
+    sprintf(buffer, "\n");  // Send wake-up signal
+    if (PrintBuffer(&buffer[0]) != 0)
+    {
+        CloseRS232Port();
+        return (-1);
+    }
+    Sleep(100);
+    WaitForDollar();  // Wait for robot to be ready
 
+    printf("\nThe robot is now ready to draw\n");
 
+    // Initialise the robot for drawing
+    sprintf(buffer, "G1 X0 Y0 F1000\n");
+    int result = SendCommands(buffer);
+    sprintf(buffer, "M3\n");
+    result = result != 0 ? result : SendCommands(buffer);
+    sprintf(buffer, "S0\n");
+    result = result != 0 ? result : SendCommands(buffer);
+
+    if (result != 0)
+    {
+        printf("Error: The robot did not accept its start-up commands\n");
+        CloseRS232Port();
+        return (-1);
+    }
+    robotFeed = 1000.0f;
+    return (0);
+}
+
+// Function to set the drawing feed rate for the next job, skipping the command if the robot already has it
+int SetFeedRate (float feed)
+{
+    char buffer[64];
+
+    if (feed == robotFeed)
+    {
+        return (0);
+    }
+    sprintf(buffer, "F%g\n", feed);
+    if (SendCommands(buffer) != 0)
+    {
+        return (-1);
+    }
+    robotFeed = feed;
+    return (0);
+}
+
+// Function to send commands to the robot and wait for a reply; returns -1 if the line could not be sent or was rejected
+int SendCommands (char *buffer)
+{
+    TransportStats *stats = activeTransportStats();
+    long long sendStart = stats ? getMonotonicMicros() : 0;
+
+    ClaimReplies(1);  // The reply is ours, not the poller's
+    if (PrintBuffer(buffer) != 0)  // Print the buffer to the robot
+    {
+        ClaimReplies(0);
+        return (-1);
+    }
+    long long sendEnd = stats ? getMonotonicMicros() : 0;
+    int replied = WaitForReply();
+    ClaimReplies(0);
+    if (replied != 0)
+    {
+        printf(controllerReset ? "Error: The robot was reset before accepting: %s" : "Error: The robot rejected: %s", buffer);
+        return (-1);
+    }
+    long long acked = stats ? getMonotonicMicros() : 0;
+    Sleep(100);
+
+    if (stats)
+    {
+        long long now = getMonotonicMicros();
+        recordLatency(&stats->latency, acked - sendStart);
+        stats->sendMicros += sendEnd - sendStart;
+        stats->blockedMicros += acked - sendEnd;
+        stats->idleMicros += now - acked;
+        stats->bytes += (long long)strlen(buffer);
+        stats->lines++;
+        if (now - stats->lastReportMicros >= STATS_INTERVAL_MS * 1000LL)
+        {
+            reportTransportStats(stats, 0);
+        }
+    }
+    return (0);
+}
+
+// Function to bring the robot back into drawing mode after a soft reset: clear the alarm lock and restore the pen and feed rate
+int RecoverFromReset (void)
+{
+    char buffer[64];
+
+    ClaimReplies(1);
+    int banner = WaitForResetBanner();
+    ClaimReplies(0);
+    if (banner != 0)
+    {
+        return (-1);
+    }
+    printf("Recovering from the reset\n");
+    sprintf(buffer, "$X\n");  // A reset during a move leaves GRBL locked
+    int result = SendCommands(buffer);
+    sprintf(buffer, "M3\n");
+    result = result != 0 ? result : SendCommands(buffer);
+    sprintf(buffer, "S0\n");
+    result = result != 0 ? result : SendCommands(buffer);
+    sprintf(buffer, "F%g\n", robotFeed);  // The reset cleared the job's feed rate
+    result = result != 0 ? result : SendCommands(buffer);
+    return (result);
+}
+
+// Function to wind the job back after it was cut short; if the robot was reset, the lines it acknowledged but had not drawn are taken back off the checkpoint
+static int StopProgram (const char *program, size_t length, Checkpoint *checkpoint, TransportStats *stats, int resetSent, int queuedMoves)
+{
+    if (stats)
+    {
+        stats->queueDepth = 0;  // Nothing more will be sent
+    }
+    if (!resetSent)
+    {
+        resetSent = takeResetRequest(&queuedMoves);  // The reset may have gone out while we waited for the reply
+    }
+    if (resetSent || controllerReset)
+    {
+        printf("The robot was reset with up to %d moves still queued\n", queuedMoves);
+        if (checkpoint)
+        {
+            rewindCheckpoint(checkpoint, program, length, queuedMoves);
+        }
+        RecoverFromReset();
+    }
+    return (-1);
+}
+
+// Function to send a generated program to the robot one line at a time, resuming and recording progress in the checkpoint; returns -1 if it stopped early
+int SendProgram (const char *program, size_t length, Checkpoint *checkpoint)
+{
+    char buffer[256];
+    size_t start = 0;
+    TransportStats *stats = activeTransportStats();
+
+    // A reset while the robot sat idle cleared its pen mode and feed rate; put them back first
+    if (idleReset)
+    {
+        idleReset = 0;
+        controllerReset = 1;  // The poller has already seen the banner
+        if (RecoverFromReset() != 0)
+        {
+            return (-1);
+        }
+    }
+
+    if (checkpoint && checkpoint->resumeLine > 0)
+    {
+        char preamble[256];
+        printf("Resuming from line %ld\n", checkpoint->resumeLine);
+        buildResumePreamble(program, length, checkpoint->resumeLine, preamble, sizeof(preamble));
+        if (SendProgram(preamble, strlen(preamble), NULL) != 0)  // Put the pen back where it was
+        {
+            return (-1);
+        }
+        start = findProgramLine(program, length, checkpoint->resumeLine);
+        checkpoint->ackedLines = checkpoint->resumeLine;
+        checkpoint->writtenLines = checkpoint->resumeLine;
+    }
+
+    if (stats)
+    {
+        // Everything still to send is queued behind the line in flight
+        for (const char *ptr = program + start; (ptr = memchr(ptr, '\n', length - (size_t)(ptr - program))) != NULL; ptr++)
+        {
+            stats->queueDepth++;
+        }
+        if (stats->queueDepth > stats->maxQueueDepth)
+        {
+            stats->maxQueueDepth = stats->queueDepth;
+        }
+    }
+
+    while (start < length)
+    {
+        const char *line = program + start;
+        const char *end = memchr(line, '\n', length - start);
+        size_t lineLength = end ? (size_t)(end - line) + 1 : length - start;
+        size_t copyLength = lineLength < sizeof(buffer) - 1 ? lineLength : sizeof(buffer) - 1;
+        memcpy(buffer, line, copyLength);
+        buffer[copyLength] = '\0';
+        int queuedMoves = PLANNER_BLOCKS;  // An unrequested reset could have dropped a full planner
+        int resetSent = takeResetRequest(&queuedMoves);
+        if (resetSent || SendCommands(buffer) != 0)
+        {
+            return StopProgram(program, length, checkpoint, stats, resetSent, queuedMoves);
+        }
+        start += lineLength;
+
+        if (stats && stats->queueDepth > 0)
+        {
+            stats->queueDepth--;
+        }
+        if (checkpoint)
+        {
+            recordAck(checkpoint);
+        }
+    }
+    return (0);
+}
+
+// Function to leave the robot safe after a failure: pen up, then park at the origin. Each step is tried even if an earlier one fails
+int SafeStop (void)
+{
+    char buffer[64];
+    int result = 0;
+
+    printf("Stopping safely: lifting the pen and parking\n");
+    sprintf(buffer, "S0\n");
+    if (SendCommands(buffer) != 0)
+    {
+        result = -1;
+    }
+    sprintf(buffer, "G0 X0 Y0\n");
+    if (SendCommands(buffer) != 0)
+    {
+        result = -1;
+    }
+    return (result);
+}
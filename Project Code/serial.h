@@ -5,14 +5,32 @@
 #ifndef SERIAL_H_INCLUDED
 #define SERIAL_H_INCLUDED
 
+#include "checkpoint.h"
 
-#define cport_nr    5                  /* COM number minus 1 */
-#define bdrate      115200              /* 115200  */
+
+#define cport_nr    5                  /* COM number minus 1, unless --port gives a device */
+#define bdrate      115200              /* 115200, unless --baud gives another */
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <unistd.h>
+#ifndef Sleep
+#define Sleep(ms)   usleep((ms) * 1000)        /* Windows Sleep() in milliseconds */
+#endif
+#endif
 
 int PrintBuffer (char *buffer);                 //JIB: Needed to match the function
 int WaitForReply (void);                        // Wit for OK function
 int WaitForDollar (void);                       // Wait for '$' function (for startup)
+int SendRealtimeByte (char command);            // Send a GRBL real-time command such as '?'
+int DrainReplies (void);                        // Read status reports while no command waits for a reply
+int SetSerialPort (const char *device, int baudrate);   // Device path or "auto", baud rate or 0 for the default; before WakeRobot
 int CanRS232PortBeOpened ( void );              // Port open check
 void CloseRS232Port (void);
+int WakeRobot (void);                           // Open, wake and initialise the robot
+int SendCommands (char *buffer);                // Send one line and wait for the ok, -1 if it failed
+int SetFeedRate (float feed);                   // Send F only if it differs from the robot's current feed
+int SendProgram (const char *program, size_t length, Checkpoint *checkpoint);    // Send a program line by line, checkpoint may be NULL; -1 if it stopped early
+int SafeStop (void);                            // Pen up and park after a failure
+int RecoverFromReset (void);                    // Unlock and re-initialise the robot after a soft reset
 
 #endif // SERIAL_H_INCLUDED
@@ -0,0 +1,418 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <pthread.h>
+
+#include "serial.h"
+#include "font.h"
+#include "gcode.h"
+#include "estimate.h"
+#include "spool.h"
+#include "stats.h"
+#include "control.h"
+#include "profile.h"
+#include "arena.h"
+#include "jobcache.h"
+#include "jobqueue.h"
+
+// A job that has been claimed from the spool directory and compiled, waiting for the robot
+typedef struct {
+    char name[256];          // Job file name without the extension
+    const Profile *profile;  // Page, pen and feed setup the job is drawn with
+    LayoutOptions options;   // Height and layout options from the job file
+    Arena *arena;            // Holds the compiled program and everything built for it
+    GCodeBuffer program;     // Compiled program
+    JobEstimate estimate;    // Predicted drawing time, used to order the queue
+    JobPriority priority;    // Urgent jobs go before normal ones, whatever their length
+    time_t queuedAt;         // When the job was claimed
+} SpoolJob;
+
+// What the claiming thread needs to compile jobs
+typedef struct {
+    const char *spoolDir;
+    const EstimatorModel *model;
+    const Profile *defaultProfile;
+} ClaimContext;
+
+static JobQueue compiledJobs;    // Jobs on their way from the claiming thread to the robot
+static atomic_int heldJobs;      // Jobs claimed and not yet finished, kept to MAX_PENDING_JOBS
+static volatile int claiming = 0;  // Cleared to stop the claiming thread
+static RenderCache renderCache;  // Paragraphs of earlier jobs, so a resubmitted edit only lays out what changed
+
+// Function to build the path of a job file in the spool directory
+static void spoolPath(char *path, size_t size, const char *spoolDir, const char *name, const char *extension) {
+    snprintf(path, size, "%s/%s%s", spoolDir, name, extension);
+}
+
+// Function to check whether a file name ends with the given extension, and return the length of its stem
+static size_t stemLength(const char *fileName, const char *extension) {
+    size_t length = strlen(fileName);
+    size_t extLength = strlen(extension);
+    if (length <= extLength || strcmp(fileName + length - extLength, extension) != 0) {
+        return 0;
+    }
+    return length - extLength;
+}
+
+// Function to move a job from one state to another by renaming its file
+static int moveJob(const char *spoolDir, const char *name, const char *from, const char *to) {
+    char oldPath[512], newPath[512];
+    spoolPath(oldPath, sizeof(oldPath), spoolDir, name, from);
+    spoolPath(newPath, sizeof(newPath), spoolDir, name, to);
+    remove(newPath);  // rename() will not replace an existing file on Windows
+    return rename(oldPath, newPath);
+}
+
+// Function to append a job's outcome to the results file
+static void writeResult(const char *spoolDir, const char *name, const char *status, const JobEstimate *estimate, const TransportStats *stats) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", spoolDir, SPOOL_RESULTS_FILE);
+    FILE *file = fopen(path, "a");
+    if (!file) {
+        printf("Error opening file: %s\n", path);
+        return;
+    }
+    double seconds = stats ? (double)(getMonotonicMicros() - stats->startMicros) / 1e6 : 0.0;
+    double p99 = stats ? (double)latencyPercentile(&stats->latency, 99.0) / 1000.0 : 0.0;
+    fprintf(file, "%ld %s %s lines=%ld estimated=%.1f actual=%.1f p99_ack_ms=%.1f\n", (long)time(NULL), name, status,
+            estimate ? estimate->lines : 0L, estimate ? estimate->totalTime : 0.0, seconds, p99);
+    fclose(file);
+}
+
+// Function to put back any jobs a previous run had claimed but not finished
+static void recoverJobs(const char *spoolDir) {
+    static const char *claimed[] = {".queued", ".active"};
+    DIR *dir = opendir(spoolDir);
+    struct dirent *entry;
+    if (!dir) {
+        return;
+    }
+    while ((entry = readdir(dir)) != NULL) {
+        for (int i = 0; i < 2; i++) {
+            size_t stem = stemLength(entry->d_name, claimed[i]);
+            if (stem > 0 && stem < 256) {
+                char name[256];
+                memcpy(name, entry->d_name, stem);
+                name[stem] = '\0';
+                printf("Requeueing unfinished job %s\n", name);
+                moveJob(spoolDir, name, claimed[i], ".job");
+            }
+        }
+    }
+    closedir(dir);
+}
+
+// Function to split a job file into its options and its text; returns 0 if the job is valid
+static int parseJob(char *contents, const Profile *defaultProfile, SpoolJob *job, const char **text) {
+    LayoutOptions *options = &job->options;
+    float height = 0.0f, width = -1.0f, spacing = -1.0f, kerning = -1.0f;  // Overrides of the profile, -1 if not given
+    char textOptions[8][2][32];  // align, breaking and hyphenate lines, as key and value
+    int numTextOptions = 0;
+
+    job->profile = defaultProfile;
+    job->priority = PRIORITY_NORMAL;
+    char *line = contents;
+    while (*line != '\0' && *line != '\n' && strncmp(line, "\r\n", 2) != 0) {
+        char *end = strchr(line, '\n');
+        if (end) {
+            *end = '\0';
+        }
+
+        char key[32];
+        char name[32];
+        float value;
+        if (line[0] != '#' && sscanf(line, "profile %31s", name) == 1) {
+            job->profile = findProfile(name);
+            if (!job->profile) {
+                return -1;
+            }
+        } else if (line[0] != '#' && sscanf(line, "priority %31s", name) == 1) {
+            if (parsePriority(name, &job->priority) != 0) {
+                printf("Error: Priority must be urgent, normal or low.\n");
+                return -1;
+            }
+        } else if (line[0] != '#' && numTextOptions < 8 && sscanf(line, "%31s %31s", textOptions[numTextOptions][0], textOptions[numTextOptions][1]) == 2 &&
+                   (strcmp(textOptions[numTextOptions][0], "align") == 0 || strcmp(textOptions[numTextOptions][0], "breaking") == 0 ||
+                    strcmp(textOptions[numTextOptions][0], "hyphenate") == 0)) {
+            numTextOptions++;  // Applied once the profile is known
+        } else if (line[0] != '#' && sscanf(line, "%31s %f", key, &value) == 2) {
+            if (strcmp(key, "height") == 0) height = value;
+            else if (strcmp(key, "width") == 0) width = value;
+            else if (strcmp(key, "spacing") == 0) spacing = value;
+            else if (strcmp(key, "kerning") == 0) kerning = value;
+            else printf("Ignoring unknown job option: %s\n", key);
+        }
+
+        if (!end) {
+            line = end;
+            break;
+        }
+        line = end + 1;
+    }
+
+    if (!line || *line == '\0') {
+        printf("Error: Job has no text.\n");
+        return -1;
+    }
+    // The profile sets the page; the job's own options override it
+    profileLayoutOptions(job->profile, height, options);
+    if (width >= 0.0f) {
+        options->maxLineWidth = (int)width;
+    }
+    if (spacing >= 0.0f) {
+        options->lineSpacing = (int)spacing;
+    }
+    if (kerning >= 0.0f) {
+        options->kerning = kerning != 0.0f;
+    }
+    for (int i = 0; i < numTextOptions; i++) {
+        if (setTextOption(options, textOptions[i][0], textOptions[i][1]) != 0) {
+            return -1;
+        }
+    }
+    if (height < job->profile->minHeight || height > job->profile->maxHeight) {
+        printf("Error: Height must be between %g and %gmm.\n", job->profile->minHeight, job->profile->maxHeight);
+        return -1;
+    }
+    if (options->maxLineWidth <= 0 || options->lineSpacing < 0) {
+        printf("Error: Invalid line width or spacing.\n");
+        return -1;
+    }
+    *text = strchr(line, '\n') + 1;  // Skip the blank line separating options from text
+    return 0;
+}
+
+// Function to claim new job files from the spool directory, compile them and queue them for the robot
+static void claimNewJobs(const char *spoolDir, const EstimatorModel *model, const Profile *defaultProfile) {
+    DIR *dir = opendir(spoolDir);
+    struct dirent *entry;
+    if (!dir) {
+        printf("Error opening spool directory: %s\n", spoolDir);
+        return;
+    }
+
+    while (atomic_load(&heldJobs) < MAX_PENDING_JOBS && (entry = readdir(dir)) != NULL) {
+        size_t stem = stemLength(entry->d_name, ".job");
+        SpoolJob *job = stem > 0 ? malloc(sizeof(SpoolJob)) : NULL;
+        if (!job || stem >= sizeof(job->name)) {
+            free(job);
+            continue;
+        }
+
+        memcpy(job->name, entry->d_name, stem);
+        job->name[stem] = '\0';
+        if (moveJob(spoolDir, job->name, ".job", ".queued") != 0) {
+            free(job);
+            continue;  // Someone else took it, or it is still being written
+        }
+
+        char path[512];
+        spoolPath(path, sizeof(path), spoolDir, job->name, ".queued");
+        char *contents = readTextFile(path);
+        const char *text = NULL;
+        job->arena = createArena();
+        initGCodeBufferInArena(&job->program, job->arena);
+        JobKey key;
+        int cached = 0;
+        int compiled = contents && job->arena && parseJob(contents, defaultProfile, job, &text) == 0;
+        if (compiled) {
+            makeJobKey(text, &job->options, &key);
+            cached = loadCachedJob(&key, job->arena, &job->program);
+            if (!cached) {
+                compiled = generateGCodeCached(text, &job->options, &renderCache, &job->program) == 0;
+                if (compiled) {
+                    storeCachedJob(&key, &job->program, &job->options);
+                }
+            }
+        }
+        if (!compiled) {
+            free(contents);
+            destroyArena(job->arena);
+            moveJob(spoolDir, job->name, ".queued", ".failed");
+            writeResult(spoolDir, job->name, "rejected", NULL, NULL);
+            free(job);
+            continue;  // A bad job only fails itself
+        }
+        free(contents);
+
+        EstimatorModel jobModel = *model;
+        jobModel.feedRate = job->profile->feedRate;
+        estimateProgram(job->program.data, job->program.length, &jobModel, job->arena, &job->estimate);
+        job->queuedAt = time(NULL);
+        atomic_fetch_add(&heldJobs, 1);
+        if (pushJob(&compiledJobs, job, job->priority) != 0) {
+            // Only more jobs than MAX_PENDING_JOBS get here; leave it for the next run
+            atomic_fetch_sub(&heldJobs, 1);
+            moveJob(spoolDir, job->name, ".queued", ".job");
+            destroyArena(job->arena);
+            free(job);
+            break;
+        }
+        if (job->priority != PRIORITY_NORMAL) {
+            printf("Queued %s job %s (%.0fs estimated)\n", priorityName(job->priority), job->name, job->estimate.totalTime);
+        } else {
+            printf("Queued job %s (%.0fs estimated)\n", job->name, job->estimate.totalTime);
+        }
+        if (cached) {
+            printf("  compiled before, taken from the job cache\n");
+        } else if (renderCache.reused + renderCache.moved > 0) {
+            printf("  reused %ld of %ld paragraphs from earlier jobs\n", renderCache.reused + renderCache.moved,
+                   renderCache.reused + renderCache.moved + renderCache.laidOut);
+        }
+    }
+
+    closedir(dir);
+}
+
+// Thread claiming and compiling new jobs while the robot draws earlier ones
+static void *claimLoop(void *arg) {
+    ClaimContext *context = arg;
+    while (claiming) {
+        claimNewJobs(context->spoolDir, context->model, context->defaultProfile);
+        for (int waited = 0; claiming && waited < SPOOL_POLL_MS; waited += SPOOL_IDLE_MS) {
+            Sleep(SPOOL_IDLE_MS);
+        }
+    }
+    return NULL;
+}
+
+// Function to pick the next job: most urgent, then shortest first, with waiting time counted against the estimate so long jobs still get a turn
+static int pickNextJob(SpoolJob **pending, int numPending) {
+    time_t now = time(NULL);
+    int best = -1;
+    double bestKey = 0.0;
+    for (int i = 0; i < numPending; i++) {
+        double key = pending[i]->estimate.totalTime - difftime(now, pending[i]->queuedAt);
+        if (best == -1 || pending[i]->priority < pending[best]->priority ||
+            (pending[i]->priority == pending[best]->priority && key < bestKey)) {
+            best = i;
+            bestKey = key;
+        }
+    }
+    return best;
+}
+
+// Function to check for, and consume, the stop request file
+static int stopRequested(const char *spoolDir) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", spoolDir, SPOOL_STOP_FILE);
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return 0;
+    }
+    fclose(file);
+    remove(path);
+    return 1;
+}
+
+// Function to draw spooled jobs back to back on an already awake robot
+int runSpoolDaemon(const char *spoolDir, const Profile *defaultProfile) {
+    EstimatorModel model;
+    defaultEstimatorModel(&model);
+    loadEstimatorModel(ESTIMATOR_FILE, &model);
+
+    // Periodic and end-of-job stats go to a JSON-lines file next to the results
+    char statsPath[512];
+    snprintf(statsPath, sizeof(statsPath), "%s/%s", spoolDir, SPOOL_STATS_FILE);
+    FILE *statsFile = fopen(statsPath, "a");
+    int result = 0;
+    SpoolJob *pending[MAX_PENDING_JOBS];  // Jobs taken off the queue, for the robot to choose from
+    int numPending = 0;
+
+    initRenderCache(&renderCache);
+    initJobQueue(&compiledJobs);
+    atomic_store(&heldJobs, 0);
+    recoverJobs(spoolDir);
+    printf("Watching %s for jobs\n", spoolDir);
+
+    // New jobs are compiled while the robot draws; without the thread they are claimed between jobs instead
+    ClaimContext context = {spoolDir, &model, defaultProfile};
+    pthread_t claimThread;
+    claiming = 1;
+    if (pthread_create(&claimThread, NULL, claimLoop, &context) != 0) {
+        claiming = 0;
+        printf("Warning: Unable to start the job claiming thread.\n");
+    }
+
+    // A stop file or an operator reset ends the daemon between jobs
+    while (!stopRequested(spoolDir) && !takeResetRequest(NULL)) {
+        if (!claiming) {
+            claimNewJobs(spoolDir, &model, defaultProfile);
+        }
+        SpoolJob *compiled;
+        while (numPending < MAX_PENDING_JOBS && (compiled = popJob(&compiledJobs, NULL)) != NULL) {
+            pending[numPending++] = compiled;
+        }
+
+        int next = pickNextJob(pending, numPending);
+        if (next == -1) {
+            Sleep(claiming ? SPOOL_IDLE_MS : SPOOL_POLL_MS);  // Nothing to do yet
+            continue;
+        }
+
+        SpoolJob job = *pending[next];
+        free(pending[next]);
+        pending[next] = pending[--numPending];
+
+        printf("Drawing job %s\n", job.name);
+        moveJob(spoolDir, job.name, ".queued", ".active");
+        // Jobs requeued after a failure carry on from their checkpoint
+        char checkpointPath[512];
+        Checkpoint checkpoint;
+        spoolPath(checkpointPath, sizeof(checkpointPath), spoolDir, job.name, ".ckpt");
+        long savedLine = openCheckpoint(&checkpoint, checkpointPath, job.program.data, job.program.length);
+        checkpoint.resumeLine = savedLine;
+
+        TransportStats stats;
+        startTransportStats(&stats, job.name, statsFile);
+        int sent = SetFeedRate(job.profile->feedRate);
+        if (sent == 0) {
+            sent = SendProgram(job.program.data, job.program.length, &checkpoint);
+        }
+        if (sent != 0) {
+            SafeStop();
+        }
+        closeCheckpoint(&checkpoint, sent == 0);
+        stats.jobMemory = (long long)arenaPeakBytes(job.arena);
+        printTransportSummary(&stats);
+        reportTransportStats(&stats, 1);
+        stopTransportStats(&stats);
+        destroyArena(job.arena);
+        atomic_fetch_sub(&heldJobs, 1);
+
+        if (sent != 0) {
+            // The robot needs the operator; the job stays .active and resumes from its checkpoint on the next start
+            writeResult(spoolDir, job.name, "interrupted", &job.estimate, &stats);
+            printf("Job %s was interrupted, stopping the spool daemon\n", job.name);
+            result = -1;
+            break;
+        }
+        moveJob(spoolDir, job.name, ".active", ".done");
+        writeResult(spoolDir, job.name, "done", &job.estimate, &stats);
+    }
+
+    if (claiming) {
+        claiming = 0;
+        pthread_join(claimThread, NULL);
+    }
+
+    // Hand any jobs we had claimed back to the spool for the next run
+    SpoolJob *compiled;
+    while ((compiled = popJob(&compiledJobs, NULL)) != NULL) {
+        pending[numPending++] = compiled;  // Never more than MAX_PENDING_JOBS are held
+    }
+    for (int i = 0; i < numPending; i++) {
+        moveJob(spoolDir, pending[i]->name, ".queued", ".job");
+        destroyArena(pending[i]->arena);
+        free(pending[i]);
+    }
+    freeRenderCache(&renderCache);
+
+    if (statsFile) {
+        fclose(statsFile);
+    }
+    printf("Spool daemon stopped\n");
+    return result;
+}
@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include "profile.h"
+
+
+#ifndef SPOOL_H_INCLUDED
+#define SPOOL_H_INCLUDED
+
+
+#define SPOOL_POLL_MS 500           // How often the spool directory is checked for new jobs
+#define SPOOL_IDLE_MS 20            // How often an idle robot checks for newly compiled jobs
+#define MAX_PENDING_JOBS 64         // Jobs compiled and held in memory at once
+#define SPOOL_RESULTS_FILE "results.txt"   // Per-job status, inside the spool directory
+#define SPOOL_STATS_FILE "stats.jsonl"     // Transport stats lines, inside the spool directory
+#define SPOOL_STOP_FILE "stop"      // Create this file in the spool directory to stop the daemon
+
+/*
+ A job file is named <anything>.job and holds "key value" option lines, a blank
+ line, then the text to draw:
+
+     profile a4
+     priority urgent
+     height 5
+     width 100
+     spacing 5
+
+     The waves crashed into
+     the side of the cliff
+
+ The profile, from profiles.cfg, sets the page, pen and feed rate; without one
+ the daemon's own profile is used. Height is required; width, spacing, align,
+ breaking, hyphenate and kerning override the profile (see profile.h). Priority
+ is urgent, normal (the default) or low; the robot draws every waiting urgent
+ job before any normal one, and so on, and the shortest waiting job first
+ within a priority.
+
+ Jobs are compiled through a render cache (see gcode.h), so a document sent
+ again after a small edit only has its changed paragraphs laid out afresh, and
+ a document compiled before, by the daemon or any other run, is read back from
+ the job cache (see jobcache.h) instead. Jobs are claimed and compiled on a
+ thread of their own while the robot draws, and handed over through the job
+ queue (see jobqueue.h), so the next job is ready as soon as the robot is.
+
+ Claimed jobs are renamed to .queued, then .active while drawing, then .done or
+ .failed. Jobs left .queued or .active by a crash are picked up again on start,
+ and carry on from the line recorded in their <name>.ckpt checkpoint. If the
+ robot stops accepting lines the pen is lifted and parked, the job is left
+ .active and the daemon stops, so the operator can fix the robot and restart.
+*/
+
+int runSpoolDaemon(const char *spoolDir, const Profile *defaultProfile);   // Draw jobs until the stop file appears; -1 if a job was interrupted
+
+#endif // SPOOL_H_INCLUDED
@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+#include "stats.h"
+#include "status.h"
+
+// Stats the sender is currently recording into
+static TransportStats *currentStats = NULL;
+
+// Function to read a monotonic clock in microseconds
+long long getMonotonicMicros(void) {
+#if defined(__linux__) || defined(__FreeBSD__)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long)now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+#else
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER now;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&now);
+    return (long long)(now.QuadPart / frequency.QuadPart) * 1000000LL + (now.QuadPart % frequency.QuadPart) * 1000000LL / frequency.QuadPart;
+#endif
+}
+
+// Function to find the histogram bucket for a value: linear below 16, then 16 steps per power of two
+static int histogramBucket(long long micros) {
+    unsigned long long value = micros > 0 ? (unsigned long long)micros : 0ULL;
+    if (value < (1ULL << HISTOGRAM_SUB_BITS)) {
+        return (int)value;
+    }
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - HISTOGRAM_SUB_BITS;
+    int index = ((shift + 1) << HISTOGRAM_SUB_BITS) + (int)((value >> shift) & ((1ULL << HISTOGRAM_SUB_BITS) - 1));
+    return index < HISTOGRAM_BUCKETS ? index : HISTOGRAM_BUCKETS - 1;
+}
+
+// Function to find the largest value that falls in a bucket
+static long long bucketUpperValue(int index) {
+    int magnitude = index >> HISTOGRAM_SUB_BITS;
+    long long sub = index & ((1 << HISTOGRAM_SUB_BITS) - 1);
+    if (magnitude == 0) {
+        return sub;
+    }
+    int shift = magnitude - 1;
+    return (((1LL << HISTOGRAM_SUB_BITS) + sub + 1) << shift) - 1;
+}
+
+// Function to add one latency to a histogram
+void recordLatency(LatencyHistogram *histogram, long long micros) {
+    histogram->counts[histogramBucket(micros)]++;
+    histogram->total++;
+    histogram->sum += micros;
+    if (micros > histogram->max) {
+        histogram->max = micros;
+    }
+}
+
+// Function to read a percentile (0-100) from a histogram, to within one bucket
+long long latencyPercentile(const LatencyHistogram *histogram, double percentile) {
+    if (histogram->total == 0) {
+        return 0;
+    }
+    long long wanted = (long long)((double)histogram->total * percentile / 100.0 + 0.5);
+    if (wanted < 1) {
+        wanted = 1;
+    }
+    long long seen = 0;
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += histogram->counts[i];
+        if (seen >= wanted) {
+            long long value = bucketUpperValue(i);
+            return value < histogram->max ? value : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+// Function to reset the stats for a new job and make them the ones the sender records into
+void startTransportStats(TransportStats *stats, const char *jobName, FILE *output) {
+    memset(stats, 0, sizeof(*stats));
+    stats->jobName = jobName;
+    stats->output = output;
+    stats->startMicros = getMonotonicMicros();
+    stats->lastReportMicros = stats->startMicros;
+    currentStats = stats;
+}
+
+// Function to stop recording into a set of stats
+void stopTransportStats(TransportStats *stats) {
+    if (currentStats == stats) {
+        currentStats = NULL;
+    }
+}
+
+// Function to return the stats the sender should update, if any
+TransportStats *activeTransportStats(void) {
+    return currentStats;
+}
+
+// Function to write a string as a JSON string, escaping quotes, backslashes and control characters
+static void writeJsonString(FILE *output, const char *text) {
+    fputc('"', output);
+    for (const unsigned char *ptr = (const unsigned char *)text; *ptr != '\0'; ptr++) {
+        if (*ptr == '"' || *ptr == '\\') {
+            fprintf(output, "\\%c", *ptr);
+        } else if (*ptr < 0x20 || *ptr == 0x7f) {
+            fprintf(output, "\\u%04x", *ptr);
+        } else {
+            fputc(*ptr, output);
+        }
+    }
+    fputc('"', output);
+}
+
+// Function to write one machine-readable stats line
+void reportTransportStats(TransportStats *stats, int final) {
+    long long now = getMonotonicMicros();
+    double elapsed = (double)(now - stats->startMicros) / 1e6;
+    double rate = elapsed > 0.0 ? 1.0 / elapsed : 0.0;
+
+    stats->lastReportMicros = now;
+    if (!stats->output) {
+        return;
+    }
+    fprintf(stats->output, "{\"type\":\"%s\",\"job\":", final ? "summary" : "stats");
+    writeJsonString(stats->output, stats->jobName ? stats->jobName : "");  // Spooled job names come from file names
+    fprintf(stats->output,
+            ",\"time\":%ld,\"elapsed_s\":%.3f,\"lines\":%ld,\"bytes\":%lld,"
+            "\"lines_per_s\":%.2f,\"bytes_per_s\":%.1f,\"queue_depth\":%ld,\"max_queue_depth\":%ld,"
+            "\"send_s\":%.3f,\"blocked_s\":%.3f,\"idle_s\":%.3f,\"job_memory_bytes\":%lld,"
+            "\"latency_us\":{\"mean\":%lld,\"p50\":%lld,\"p90\":%lld,\"p99\":%lld,\"p999\":%lld,\"max\":%lld}",
+            (long)time(NULL), elapsed,
+            stats->lines, stats->bytes, (double)stats->lines * rate, (double)stats->bytes * rate,
+            stats->queueDepth, stats->maxQueueDepth,
+            (double)stats->sendMicros / 1e6, (double)stats->blockedMicros / 1e6, (double)stats->idleMicros / 1e6, stats->jobMemory,
+            stats->latency.total ? stats->latency.sum / stats->latency.total : 0LL,
+            latencyPercentile(&stats->latency, 50.0), latencyPercentile(&stats->latency, 90.0),
+            latencyPercentile(&stats->latency, 99.0), latencyPercentile(&stats->latency, 99.9), stats->latency.max);
+
+    // Where the robot says it is, when the status poller is running
+    MachineStatus machine;
+    getMachineStatus(&machine);
+    if (machine.reports > 0) {
+        fprintf(stats->output, ",\"machine\":{\"state\":\"%s\",\"x\":%.3f,\"y\":%.3f,\"feed\":%.0f,\"planner_free\":%d,\"held_s\":%.3f,\"stalled\":%s}",
+                machineStateName(machine.state), machine.x, machine.y, machine.feed, machine.plannerFree,
+                (double)machine.heldMicros / 1e6, machineStalled(&machine, now) ? "true" : "false");
+    }
+    fprintf(stats->output, "}\n");
+    fflush(stats->output);
+}
+
+// Function to print where the time went for the operator
+void printTransportSummary(const TransportStats *stats) {
+    double elapsed = (double)(getMonotonicMicros() - stats->startMicros) / 1e6;
+    double rate = elapsed > 0.0 ? 1.0 / elapsed : 0.0;
+
+    printf("\nJob %s: %ld lines, %lld bytes in %.1fs (%.1f lines/s, %.0f bytes/s)\n", stats->jobName ? stats->jobName : "",
+           stats->lines, stats->bytes, elapsed, (double)stats->lines * rate, (double)stats->bytes * rate);
+    printf("  writing %.1fs, waiting for ok %.1fs, idle %.1fs\n",
+           (double)stats->sendMicros / 1e6, (double)stats->blockedMicros / 1e6, (double)stats->idleMicros / 1e6);
+    printf("  ack latency: p50 %.1fms, p90 %.1fms, p99 %.1fms, max %.1fms\n",
+           (double)latencyPercentile(&stats->latency, 50.0) / 1000.0, (double)latencyPercentile(&stats->latency, 90.0) / 1000.0,
+           (double)latencyPercentile(&stats->latency, 99.0) / 1000.0, (double)stats->latency.max / 1000.0);
+    if (stats->jobMemory > 0) {
+        printf("  job memory: %.1f MB at its peak\n", (double)stats->jobMemory / (1024.0 * 1024.0));
+    }
+}
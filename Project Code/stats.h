@@ -0,0 +1,48 @@
+#include <stdio.h>
+
+
+#ifndef STATS_H_INCLUDED
+#define STATS_H_INCLUDED
+
+
+#define HISTOGRAM_SUB_BITS 4        // 16 linear steps per power of two, about 6% precision
+#define HISTOGRAM_MAGNITUDES 36     // Covers 1 us up to about 19 hours
+#define HISTOGRAM_BUCKETS (HISTOGRAM_MAGNITUDES << HISTOGRAM_SUB_BITS)
+#define STATS_INTERVAL_MS 5000      // How often a running job reports a JSON stats line
+
+// Log-linear (HDR-style) histogram of latencies in microseconds
+typedef struct {
+    long long counts[HISTOGRAM_BUCKETS];
+    long long total;                // Number of values recorded
+    long long sum;                  // Sum of all values, for the mean
+    long long max;                  // Largest value recorded
+} LatencyHistogram;
+
+// Counters kept by the sender while a program is streaming
+typedef struct {
+    LatencyHistogram latency;       // Send-to-ack time per line
+    FILE *output;                   // Where the periodic JSON lines go (NULL = none)
+    const char *jobName;            // Included in the JSON lines
+    long long startMicros;          // When the job started
+    long long lastReportMicros;     // When the last JSON line was written
+    long long sendMicros;           // Time spent writing to the port
+    long long blockedMicros;        // Time blocked waiting for the controller to acknowledge
+    long long idleMicros;           // Time the link sat idle between an ack and the next line
+    long long bytes;                // Bytes sent
+    long lines;                     // Lines acknowledged
+    long queueDepth;                // Lines of the program still waiting to be sent
+    long maxQueueDepth;
+    long long jobMemory;            // Peak bytes held by the job's arena, filled in by the caller
+} TransportStats;
+
+long long getMonotonicMicros(void);                      // Monotonic clock in microseconds
+void recordLatency(LatencyHistogram *histogram, long long micros);
+long long latencyPercentile(const LatencyHistogram *histogram, double percentile);
+
+void startTransportStats(TransportStats *stats, const char *jobName, FILE *output);  // Also makes these the active stats
+void stopTransportStats(TransportStats *stats);
+TransportStats *activeTransportStats(void);              // Stats the sender should update, or NULL
+void reportTransportStats(TransportStats *stats, int final);   // Write one JSON line
+void printTransportSummary(const TransportStats *stats);  // End-of-job summary for the operator
+
+#endif // STATS_H_INCLUDED
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "serial.h"
+#include "stats.h"
+#include "status.h"
+
+// Live state shared between the reader and anyone asking for it
+static MachineStatus machineStatus = {MACHINE_UNKNOWN, 0.0, 0.0, 0.0, 0.0, -1, -1, 0, 0, 0, 0};
+static pthread_mutex_t statusLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Background thread sending '?'
+static pthread_t pollerThread;
+static volatile int pollerRunning = 0;
+static int pollInterval = STATUS_POLL_MS;
+
+// State names as GRBL spells them, in MachineState order
+static const char *stateNames[] = {"Unknown", "Idle", "Run", "Hold", "Jog", "Alarm", "Door", "Check", "Home", "Sleep"};
+
+// Function to return the name of a machine state
+const char *machineStateName(MachineState state) {
+    return stateNames[state];
+}
+
+// Function to pick the state, position, feed and buffer fill out of a status report; fields that are missing keep their old values
+int parseStatusReport(const char *report, MachineStatus *status) {
+    if (report[0] != '<') {
+        return -1;
+    }
+
+    // The state runs up to the first separator; Hold and Door carry a sub-state after a colon
+    size_t nameLength = strcspn(report + 1, "|,:>");
+    status->state = MACHINE_UNKNOWN;
+    for (int i = 1; i < (int)(sizeof(stateNames) / sizeof(stateNames[0])); i++) {
+        if (strlen(stateNames[i]) == nameLength && strncmp(report + 1, stateNames[i], nameLength) == 0) {
+            status->state = (MachineState)i;
+        }
+    }
+
+    const char *field = strstr(report, "MPos:");
+    if (!field) {
+        field = strstr(report, "WPos:");
+    }
+    if (field) {
+        sscanf(field + 5, "%lf,%lf,%lf", &status->x, &status->y, &status->z);
+    }
+    if ((field = strstr(report, "FS:")) != NULL || (field = strstr(report, "|F:")) != NULL) {
+        sscanf(strchr(field, ':') + 1, "%lf", &status->feed);
+    }
+    if ((field = strstr(report, "Bf:")) != NULL) {
+        sscanf(field + 3, "%d,%d", &status->plannerFree, &status->rxFree);
+    }
+    return 0;
+}
+
+// Function to fold a report from the controller into the live state
+void updateMachineStatus(const char *report) {
+    long long now = getMonotonicMicros();
+
+    pthread_mutex_lock(&statusLock);
+    MachineStatus previous = machineStatus;
+    if (parseStatusReport(report, &machineStatus) == 0) {
+        machineStatus.reports++;
+        machineStatus.updatedMicros = now;
+        if (previous.reports == 0 || previous.x != machineStatus.x || previous.y != machineStatus.y || previous.z != machineStatus.z) {
+            machineStatus.movedMicros = now;
+        }
+        if (previous.reports > 0 && (previous.state == MACHINE_HOLD || previous.state == MACHINE_DOOR)) {
+            machineStatus.heldMicros += now - previous.updatedMicros;
+        }
+        if (machineStatus.state != MACHINE_RUN) {
+            machineStatus.movedMicros = now;  // Only a running machine can stall
+        }
+    }
+    pthread_mutex_unlock(&statusLock);
+}
+
+// Function to drop the state after a reset, so a report from before it is not taken as current
+void forgetMachineState(void) {
+    pthread_mutex_lock(&statusLock);
+    machineStatus.state = MACHINE_UNKNOWN;
+    pthread_mutex_unlock(&statusLock);
+}
+
+// Function to copy the live state
+void getMachineStatus(MachineStatus *status) {
+    pthread_mutex_lock(&statusLock);
+    *status = machineStatus;
+    pthread_mutex_unlock(&statusLock);
+}
+
+// Function to check whether the machine says it is running but has not moved for a while
+int machineStalled(const MachineStatus *status, long long nowMicros) {
+    return status->reports > 0 && status->state == MACHINE_RUN && nowMicros - status->movedMicros >= STATUS_STALL_MS * 1000LL;
+}
+
+// Thread function sending a status request every interval until stopped
+static void *statusPoller(void *arg) {
+    (void)arg;
+    while (pollerRunning) {
+        if (SendRealtimeByte('?') != 0) {
+            break;  // The port has gone; the sender will report it
+        }
+        for (int waited = 0; waited < pollInterval && pollerRunning; waited += 20) {
+            Sleep(20);  // Short naps so stopping is quick
+            DrainReplies();  // Between jobs nobody else reads the reports
+        }
+    }
+    return NULL;
+}
+
+// Function to start polling the controller for status reports in the background
+int startStatusPoller(int intervalMs) {
+    if (intervalMs <= 0 || pollerRunning) {
+        return 0;
+    }
+    pollInterval = intervalMs;
+    pollerRunning = 1;
+    if (pthread_create(&pollerThread, NULL, statusPoller, NULL) != 0) {
+        pollerRunning = 0;
+        printf("Warning: Unable to start the status poller.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to stop the background poller
+void stopStatusPoller(void) {
+    if (!pollerRunning) {
+        return;
+    }
+    pollerRunning = 0;
+    pthread_join(pollerThread, NULL);
+}
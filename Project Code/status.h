@@ -0,0 +1,60 @@
+#include <stdio.h>
+
+
+#ifndef STATUS_H_INCLUDED
+#define STATUS_H_INCLUDED
+
+
+#define STATUS_POLL_MS 200          // Default time between '?' status requests
+#define STATUS_STALL_MS 5000        // Running this long without moving counts as a stall
+
+// Controller states named in GRBL status reports
+typedef enum {
+    MACHINE_UNKNOWN,    // No report received yet
+    MACHINE_IDLE,
+    MACHINE_RUN,
+    MACHINE_HOLD,
+    MACHINE_JOG,
+    MACHINE_ALARM,
+    MACHINE_DOOR,
+    MACHINE_CHECK,
+    MACHINE_HOME,
+    MACHINE_SLEEP
+} MachineState;
+
+// Live machine state built from the status reports
+typedef struct {
+    MachineState state;
+    double x, y, z;             // Machine position (MPos), or work position if that is all that is reported
+    double feed;                // Current feed rate in mm/min, from FS: or F:
+    int plannerFree;            // Free planner blocks from Bf:, -1 if not reported
+    int rxFree;                 // Free bytes in the controller's receive buffer from Bf:, -1 if not reported
+    long reports;               // Status reports received
+    long long updatedMicros;    // When the last report arrived
+    long long movedMicros;      // When the position last changed
+    long long heldMicros;       // Total time spent in Hold or Door
+} MachineStatus;
+
+/*
+ The poller only writes GRBL's real-time '?' byte, which the controller acts on
+ straight away and never stores in its receive buffer, so it does not take a
+ slot from the command stream. The reports come back interleaved with the ok
+ replies and are picked out by WaitForReply(), which hands each one to
+ updateMachineStatus(). While no command is waiting for its reply, between
+ jobs or at a prompt, the poller reads them itself with DrainReplies(), so
+ the state stays live and no backlog of old reports builds up in the port.
+
+ GRBL 1.1 reports look like <Idle|MPos:0.000,0.000,0.000|Bf:15,128|FS:0,0>
+ and 0.9 reports like <Idle,MPos:0.000,0.000,0.000,WPos:0.000,0.000,0.000>.
+*/
+
+int parseStatusReport(const char *report, MachineStatus *status);  // Returns 0 if the line was a status report
+void updateMachineStatus(const char *report);           // Fold one report into the live state
+void getMachineStatus(MachineStatus *status);           // Copy of the live state
+void forgetMachineState(void);                          // State back to unknown, after the robot was reset
+const char *machineStateName(MachineState state);
+int machineStalled(const MachineStatus *status, long long nowMicros);  // 1 if running but not moving
+int startStatusPoller(int intervalMs);                  // Request reports every intervalMs (0 = off)
+void stopStatusPoller(void);
+
+#endif // STATUS_H_INCLUDED
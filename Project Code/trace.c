@@ -0,0 +1,337 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__linux__) || defined(__FreeBSD__)
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif
+
+#include "trace.h"
+#include "serial.h"
+#include "stats.h"
+#include "status.h"
+#include "control.h"
+
+#define TRACE_PENDING_LINES 256     // Lines the replay keeps waiting for an ok; GRBL's receive buffer holds far fewer
+
+// Ring of records waiting for the writer thread; the positions count every byte ever written, so they never wrap
+static unsigned char ring[TRACE_RING_BYTES];
+static size_t ringHead = 0;         // End of the last record recorded
+static size_t ringTail = 0;         // End of the last byte written to the file
+static long droppedRecords = 0;     // Records lost to a full ring since the writer last looked
+static pthread_mutex_t ringLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Writer thread and the file it writes to
+static FILE *traceFile = NULL;
+static pthread_t writerThread;
+static volatile int traceRunning = 0;
+
+// A line sent during the replay, waiting for its ok
+typedef struct {
+    long number;
+    long long sentMicros;
+    int bytes;                      // Line length with its newline, as the controller's buffer holds it
+    int inFlight;                   // Bytes waiting in the controller when it was sent, this line included
+    int plannerUsed;                // Planner blocks in use by the last status report, -1 if unknown
+    char text[TRACE_TEXT_MAX + 1];
+} PendingLine;
+
+// Function to store a little-endian integer of the given size
+static void putLittleEndian(unsigned char *out, unsigned long long value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out[i] = (unsigned char)(value >> (8 * i));
+    }
+}
+
+static unsigned long long getLittleEndian(const unsigned char *in, int bytes) {
+    unsigned long long value = 0;
+    for (int i = bytes - 1; i >= 0; i--) {
+        value = value << 8 | in[i];
+    }
+    return value;
+}
+
+// Function to build the fixed part of a record
+static void makeRecord(unsigned char *record, TraceType type, size_t length) {
+    putLittleEndian(record, (unsigned long long)getMonotonicMicros(), 8);
+    record[8] = (unsigned char)type;
+    record[9] = 0;
+    putLittleEndian(record + 10, length, 2);
+}
+
+// Function to copy bytes into the ring at a position, wrapping round its end
+static void copyIntoRing(size_t position, const void *data, size_t size) {
+    size_t offset = position % TRACE_RING_BYTES;
+    size_t first = size < TRACE_RING_BYTES - offset ? size : TRACE_RING_BYTES - offset;
+    memcpy(ring + offset, data, first);
+    memcpy(ring, (const unsigned char *)data + first, size - first);
+}
+
+// Function to record one event; only copies it into the ring, so it is cheap enough for the sender
+void traceEvent(TraceType type, const char *text, size_t length) {
+    unsigned char record[TRACE_RECORD_SIZE];
+
+    if (!traceRunning) {
+        return;
+    }
+    while (length > 0 && (text[length - 1] == '\n' || text[length - 1] == '\r')) {
+        length--;
+    }
+    if (length > TRACE_TEXT_MAX) {
+        length = TRACE_TEXT_MAX;
+    }
+    makeRecord(record, type, length);
+
+    pthread_mutex_lock(&ringLock);
+    if (TRACE_RING_BYTES - (ringHead - ringTail) < sizeof(record) + length) {
+        droppedRecords++;  // The disk has fallen behind; losing a record beats holding up the robot
+    } else {
+        copyIntoRing(ringHead, record, sizeof(record));
+        copyIntoRing(ringHead + sizeof(record), text, length);
+        ringHead += sizeof(record) + length;
+    }
+    pthread_mutex_unlock(&ringLock);
+}
+
+// Function to write out everything recorded so far; the records between tail and head are left alone by traceEvent(), so no lock is held while writing
+static void writeRing(void) {
+    pthread_mutex_lock(&ringLock);
+    size_t head = ringHead;
+    size_t tail = ringTail;
+    long dropped = droppedRecords;
+    droppedRecords = 0;
+    pthread_mutex_unlock(&ringLock);
+
+    while (tail < head) {
+        size_t offset = tail % TRACE_RING_BYTES;
+        size_t chunk = head - tail < TRACE_RING_BYTES - offset ? head - tail : TRACE_RING_BYTES - offset;
+        fwrite(ring + offset, 1, chunk, traceFile);
+        tail += chunk;
+    }
+
+    pthread_mutex_lock(&ringLock);
+    ringTail = tail;
+    pthread_mutex_unlock(&ringLock);
+
+    if (dropped > 0) {
+        char text[32];
+        unsigned char record[TRACE_RECORD_SIZE];
+        int length = snprintf(text, sizeof(text), "%ld", dropped);
+        makeRecord(record, TRACE_DROPPED, (size_t)length);
+        fwrite(record, 1, sizeof(record), traceFile);
+        fwrite(text, 1, (size_t)length, traceFile);
+    }
+    fflush(traceFile);
+}
+
+// Thread writing the ring to the trace file until the trace is stopped
+static void *traceWriter(void *arg) {
+    (void)arg;
+    while (traceRunning) {
+        Sleep(TRACE_FLUSH_MS);
+        writeRing();
+    }
+    writeRing();  // Whatever was recorded before the stop
+    return NULL;
+}
+
+// Function to open the trace file and start the writer thread
+int startTrace(const char *filename) {
+    unsigned char header[TRACE_HEADER_SIZE];
+
+    if (traceRunning) {
+        return 0;
+    }
+    traceFile = fopen(filename, "wb");
+    if (!traceFile) {
+        printf("Error opening file: %s\n", filename);
+        return -1;
+    }
+    memcpy(header, TRACE_MAGIC, 4);
+    putLittleEndian(header + 4, TRACE_VERSION, 4);
+    fwrite(header, 1, sizeof(header), traceFile);
+
+    ringHead = 0;
+    ringTail = 0;
+    droppedRecords = 0;
+    traceRunning = 1;
+    if (pthread_create(&writerThread, NULL, traceWriter, NULL) != 0) {
+        traceRunning = 0;
+        fclose(traceFile);
+        traceFile = NULL;
+        printf("Error: Unable to start the trace writer thread.\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Function to stop recording, write out the rest of the ring and close the file
+void stopTrace(void) {
+    if (!traceRunning) {
+        return;
+    }
+    traceRunning = 0;
+    pthread_join(writerThread, NULL);
+    fclose(traceFile);
+    traceFile = NULL;
+}
+
+// Function to say whether a trace is being recorded
+int tracing(void) {
+    return traceRunning;
+}
+
+// Function to replay a trace: match every ok to the line it acknowledges and follow how full the controller's buffers were
+int analyseTrace(const char *traceFileName, const char *linesFileName) {
+    unsigned char header[TRACE_HEADER_SIZE];
+    unsigned char record[TRACE_RECORD_SIZE];
+    char text[TRACE_TEXT_MAX + 1];
+    LatencyHistogram latency;
+    long sent = 0, acked = 0, rejected = 0, lost = 0, resets = 0, realtime = 0, dropped = 0, reports = 0;
+    long long firstMicros = -1, lastMicros = 0, inFlightArea = 0, plannerSum = 0;
+    int inFlight = 0, maxInFlight = 0, plannerUsed = -1, maxPlannerUsed = 0;
+    size_t oldest = 0, waiting = 0;
+
+    FILE *file = fopen(traceFileName, "rb");
+    if (!file) {
+        printf("Error opening file: %s\n", traceFileName);
+        return -1;
+    }
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, TRACE_MAGIC, 4) != 0 ||
+        getLittleEndian(header + 4, 4) != TRACE_VERSION) {
+        printf("Error: %s is not a trace written by --trace\n", traceFileName);
+        fclose(file);
+        return -1;
+    }
+    FILE *linesFile = NULL;
+    if (linesFileName) {
+        linesFile = fopen(linesFileName, "w");
+        if (!linesFile) {
+            printf("Error opening file: %s\n", linesFileName);
+            fclose(file);
+            return -1;
+        }
+        fprintf(linesFile, "line,sent_s,latency_ms,in_flight_bytes,planner_used,reply,text\n");
+    }
+    PendingLine *pending = malloc(TRACE_PENDING_LINES * sizeof(PendingLine));
+    if (!pending) {
+        printf("Error: Out of memory replaying %s\n", traceFileName);
+        fclose(file);
+        if (linesFile) {
+            fclose(linesFile);
+        }
+        return -1;
+    }
+    memset(&latency, 0, sizeof(latency));
+
+    while (fread(record, 1, sizeof(record), file) == sizeof(record)) {
+        long long micros = (long long)getLittleEndian(record, 8);
+        TraceType type = (TraceType)record[8];
+        size_t length = (size_t)getLittleEndian(record + 10, 2);
+        if (length > TRACE_TEXT_MAX || fread(text, 1, length, file) != length) {
+            printf("Warning: %s ends with a damaged record\n", traceFileName);
+            break;
+        }
+        text[length] = '\0';
+
+        if (firstMicros < 0) {
+            firstMicros = micros;
+        } else if (micros > lastMicros) {
+            inFlightArea += (long long)inFlight * (micros - lastMicros);  // For the time-weighted mean
+        }
+        if (micros > lastMicros) {
+            lastMicros = micros;
+        }
+
+        if (type == TRACE_TX) {
+            if (waiting == TRACE_PENDING_LINES) {
+                inFlight -= pending[oldest].bytes;  // Far more than GRBL could hold; the oldest was never answered
+                oldest = (oldest + 1) % TRACE_PENDING_LINES;
+                waiting--;
+                lost++;
+            }
+            PendingLine *line = &pending[(oldest + waiting) % TRACE_PENDING_LINES];
+            waiting++;
+            line->number = ++sent;
+            line->sentMicros = micros;
+            line->bytes = (int)length + 1;
+            inFlight += line->bytes;
+            line->inFlight = inFlight;
+            line->plannerUsed = plannerUsed;
+            memcpy(line->text, text, length + 1);
+            if (inFlight > maxInFlight) {
+                maxInFlight = inFlight;
+            }
+        } else if (type == TRACE_RX && text[0] == '<') {
+            MachineStatus status;
+            memset(&status, 0, sizeof(status));
+            status.plannerFree = -1;
+            if (parseStatusReport(text, &status) == 0 && status.plannerFree >= 0) {
+                plannerUsed = status.plannerFree <= PLANNER_BLOCKS ? PLANNER_BLOCKS - status.plannerFree : 0;
+                plannerSum += plannerUsed;
+                reports++;
+                if (plannerUsed > maxPlannerUsed) {
+                    maxPlannerUsed = plannerUsed;
+                }
+            }
+        } else if (type == TRACE_RX && (strncmp(text, "ok", 2) == 0 || strncmp(text, "error", 5) == 0)) {
+            if (waiting == 0) {
+                continue;  // An answer to something sent before the trace started
+            }
+            PendingLine *line = &pending[oldest];
+            oldest = (oldest + 1) % TRACE_PENDING_LINES;
+            waiting--;
+            inFlight -= line->bytes;
+            recordLatency(&latency, micros - line->sentMicros);
+            if (text[0] == 'o') {
+                acked++;
+            } else {
+                rejected++;
+            }
+            if (linesFile) {
+                fprintf(linesFile, "%ld,%.6f,%.3f,%d,%d,%s,\"%s\"\n", line->number, (double)(line->sentMicros - firstMicros) / 1e6,
+                        (double)(micros - line->sentMicros) / 1000.0, line->inFlight, line->plannerUsed,
+                        text[0] == 'o' ? "ok" : "error", line->text);
+            }
+        } else if (type == TRACE_RX && strncmp(text, "Grbl", 4) == 0) {
+            resets++;  // The controller restarted and threw away whatever it held
+            lost += (long)waiting;
+            waiting = 0;
+            inFlight = 0;
+        } else if (type == TRACE_REALTIME) {
+            realtime++;
+        } else if (type == TRACE_DROPPED) {
+            dropped += atol(text);
+        }
+    }
+    fclose(file);
+    free(pending);
+    if (linesFile) {
+        fclose(linesFile);
+    }
+
+    double elapsed = firstMicros >= 0 ? (double)(lastMicros - firstMicros) / 1e6 : 0.0;
+    printf("Trace %s: %ld lines sent in %.1fs (%.1f lines/s), %ld acknowledged, %ld rejected, %ld never answered\n",
+           traceFileName, sent, elapsed, elapsed > 0.0 ? (double)sent / elapsed : 0.0, acked, rejected, lost + (long)waiting);
+    printf("  ack latency: mean %.1fms, p50 %.1fms, p90 %.1fms, p99 %.1fms, max %.1fms\n",
+           latency.total ? (double)latency.sum / (double)latency.total / 1000.0 : 0.0,
+           (double)latencyPercentile(&latency, 50.0) / 1000.0, (double)latencyPercentile(&latency, 90.0) / 1000.0,
+           (double)latencyPercentile(&latency, 99.0) / 1000.0, (double)latency.max / 1000.0);
+    printf("  receive buffer: %.1f bytes waiting on average, %d at most\n",
+           lastMicros > firstMicros ? (double)inFlightArea / (double)(lastMicros - firstMicros) : 0.0, maxInFlight);
+    if (reports > 0) {
+        printf("  planner: %.1f of %d blocks in use on average, %d at most, from %ld status report%s\n",
+               (double)plannerSum / (double)reports, PLANNER_BLOCKS, maxPlannerUsed, reports, reports == 1 ? "" : "s");
+    } else {
+        printf("  planner: no Bf: status reports in the trace\n");
+    }
+    printf("  %ld reset%s, %ld real-time command%s, %ld record%s dropped\n", resets, resets == 1 ? "" : "s",
+           realtime, realtime == 1 ? "" : "s", dropped, dropped == 1 ? "" : "s");
+    if (linesFileName) {
+        printf("Per-line latencies written to %s\n", linesFileName);
+    }
+    return 0;
+}
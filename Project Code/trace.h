@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include <stddef.h>
+
+
+#ifndef TRACE_H_INCLUDED
+#define TRACE_H_INCLUDED
+
+
+#define TRACE_MAGIC "RWTR"
+#define TRACE_VERSION 1
+#define TRACE_HEADER_SIZE 8
+#define TRACE_RECORD_SIZE 12        // Bytes in front of each record's text
+#define TRACE_TEXT_MAX 255          // Longer lines are cut short in the trace
+#define TRACE_RING_BYTES (1 << 20)  // Records waiting to be written; when full, new records are counted and dropped
+#define TRACE_FLUSH_MS 100          // How often the writer thread empties the ring
+
+// What a trace record holds
+typedef enum {
+    TRACE_TX = 1,       // A line written to the controller
+    TRACE_RX,           // A line the controller sent back, status reports included
+    TRACE_REALTIME,     // A real-time command byte such as '?' or '!'
+    TRACE_DROPPED       // The text is how many records were lost to a full ring
+} TraceType;
+
+/*
+ --trace <file> records every line sent to and received from the robot with
+ the time it happened. Recording only copies the line into a ring in memory;
+ a thread of its own writes the ring to the file every TRACE_FLUSH_MS, so the
+ sender never waits on the disk, and while tracing the lines are no longer
+ echoed to the terminal. The file is an 8 byte header, "RWTR" then the
+ version (u32), followed by little-endian records:
+
+     0   monotonic time, microseconds (u64)
+     8   type (u8)      9   unused (u8)      10  text length (u16)
+     12  text, without its line ending
+
+ --trace-report <file> [lines.csv] replays a trace. Each ok or error
+ acknowledges the oldest line still waiting, as GRBL does, which gives the
+ latency of every line; the bytes sent but not yet acknowledged are what the
+ controller's receive buffer holds, and the Bf: field of the status reports,
+ when the poller is on, gives how full its planner is. The report prints the
+ totals, and the CSV has one row per line sent.
+*/
+
+int startTrace(const char *filename);       // Start recording; -1 if the file cannot be created
+void stopTrace(void);                       // Write everything recorded and close the file
+int tracing(void);                          // 1 while a trace is being recorded
+void traceEvent(TraceType type, const char *text, size_t length);  // Record one event; does nothing when not tracing
+int analyseTrace(const char *traceFile, const char *linesFile);    // Print the replayed totals, and per-line rows if linesFile is not NULL
+
+#endif // TRACE_H_INCLUDED